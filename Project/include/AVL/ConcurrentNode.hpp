@@ -0,0 +1,93 @@
+#ifndef CONCURRENT_NODE_HPP
+#define CONCURRENT_NODE_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+
+/**
+ * @brief Estrutura de nó para a árvore AVL concorrente.
+ *
+ * @tparam Key Tipo da chave armazenada no nó.
+ * @tparam Value Tipo do valor associado à chave.
+ *
+ * Todos os campos mutáveis são atômicos, pois leitores percorrem a árvore sem bloqueios enquanto
+ * escritores a alteram. A chave é imutável. O valor é mantido por ponteiro: um ponteiro nulo indica
+ * um nó de roteamento (chave removida logicamente, mas nó ainda necessário para a estrutura).
+ */
+template <typename Key, typename Value>
+struct ConcurrentNode {
+    /**
+     * @brief Alias para ponteiro de ConcurrentNode.
+     */
+    using Nodeptr = ConcurrentNode<Key, Value>*;
+
+    /**
+     * @brief Bits da versão do nó.
+     *
+     * - UNLINKED: o nó foi removido da árvore (valor final da versão).
+     * - SHRINKING: uma rotação está movendo o nó para baixo; leitores abaixo dele devem esperar.
+     * - SHRINK_INCR: incremento aplicado ao fim de cada rotação, invalidando leituras em andamento.
+     */
+    static constexpr uint64_t UNLINKED = 1;
+    static constexpr uint64_t SHRINKING = 2;
+    static constexpr uint64_t SHRINK_INCR = 4;
+
+    /**
+     * @brief Chave do nó (nunca muda depois da criação).
+     */
+    const Key key;
+
+    /**
+     * @brief Valor associado à chave, ou nullptr se o nó for apenas de roteamento.
+     */
+    std::atomic<Value*> value;
+
+    /**
+     * @brief Altura do nó (pode estar temporariamente desatualizada: balanceamento relaxado).
+     */
+    std::atomic<int> height;
+
+    /**
+     * @brief Versão usada na validação otimista dos leitores.
+     */
+    std::atomic<uint64_t> version;
+
+    /**
+     * @brief Ponteiros para o pai e para os filhos esquerdo e direito.
+     */
+    std::atomic<Nodeptr> parent;
+    std::atomic<Nodeptr> left;
+    std::atomic<Nodeptr> right;
+
+    /**
+     * @brief Trava do nó, usada apenas por escritores que reestruturam este nó.
+     */
+    std::mutex lock;
+
+    /**
+     * @brief Construtor do nó concorrente.
+     *
+     * @param key Chave do nó.
+     * @param value Valor alocado (posse transferida ao nó) ou nullptr para um nó de roteamento.
+     * @param parent Ponteiro para o pai.
+     * @param height Altura inicial do nó.
+     */
+    ConcurrentNode(const Key& key, Value* value, Nodeptr parent, int height = 1)
+        : key(key), value(value), height(height), version(0), parent(parent), left(nullptr), right(nullptr) {}
+
+    /**
+     * @brief Retorna o filho na direção indicada (negativa: esquerda; positiva: direita).
+     */
+    Nodeptr child(int dir) const { return dir < 0 ? left.load() : right.load(); }
+
+    /**
+     * @brief Substitui o filho na direção indicada (negativa: esquerda; positiva: direita).
+     */
+    void setChild(int dir, Nodeptr node) {
+        if (dir < 0) left.store(node);
+        else right.store(node);
+    }
+};
+
+#endif
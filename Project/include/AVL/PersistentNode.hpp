@@ -0,0 +1,65 @@
+#ifndef PERSISTENT_NODE_HPP
+#define PERSISTENT_NODE_HPP
+
+#include <memory>
+#include <utility>
+
+/**
+ * @brief Estrutura de nó para a árvore AVL persistente.
+ *
+ * @tparam Key Tipo da chave armazenada no nó.
+ * @tparam Value Tipo do valor associado à chave.
+ *
+ * Diferente do Node da AVL comum, os filhos são ponteiros compartilhados (std::shared_ptr),
+ * de modo que várias versões da árvore podem compartilhar as mesmas subárvores. Um nó só é
+ * liberado quando nenhuma versão (árvore atual ou snapshot) o referencia mais.
+ */
+template <typename Key, typename Value>
+struct PersistentNode {
+    /**
+     * @brief Alias para ponteiro compartilhado de PersistentNode.
+     */
+    using Nodeptr = std::shared_ptr<PersistentNode<Key, Value>>;
+
+    /**
+     * @brief Par contendo a chave e o valor armazenados no nó.
+     */
+    std::pair<Key, Value> data;
+
+    /**
+     * @brief Altura do nó na árvore AVL.
+     */
+    int height;
+
+    /**
+     * @brief Geração em que o nó foi criado. Nós da geração corrente ainda não
+     * pertencem a nenhum snapshot e podem ser alterados no próprio lugar.
+     */
+    unsigned long long generation;
+
+    /**
+     * @brief Ponteiro para o filho esquerdo.
+     */
+    Nodeptr left;
+
+    /**
+     * @brief Ponteiro para o filho direito.
+     */
+    Nodeptr right;
+
+    /**
+     * @brief Construtor do nó persistente.
+     *
+     * @param data Par chave-valor a ser armazenado.
+     * @param height Altura inicial do nó.
+     * @param generation Geração da árvore no momento da criação.
+     * @param left Ponteiro para o filho esquerdo (padrão: nullptr).
+     * @param right Ponteiro para o filho direito (padrão: nullptr).
+     */
+    PersistentNode(std::pair<Key, Value> data, int height, unsigned long long generation,
+                   Nodeptr left = nullptr, Nodeptr right = nullptr)
+        : data(std::move(data)), height(height), generation(generation),
+          left(std::move(left)), right(std::move(right)) {}
+};
+
+#endif
@@ -3,10 +3,15 @@
 
 #include <iostream>
 #include <stack>
+#include <type_traits>
 #include <algorithm>
 #include <vector>
 #include "Node.hpp"
 #include "../Dictionaty/IDictionary.hpp"
+#include "../utils/threeWayCompare.hpp"
+#include "../Frozen/frozenTree.hpp"
+#include "../utils/frontCache.hpp"
+#include "../utils/nodePool.hpp"
 
 /**
  * @brief Classe que implementa uma Árvore AVL (Adelson-Velsky e Landis).
@@ -17,6 +22,7 @@
  * 
  * @tparam Chave Tipo da chave utilizada para ordenação dos nós na árvore.
  * @tparam Valor Tipo do valor associado a cada chave armazenada na árvore.
+ * @tparam Compare Política de comparação em três vias (padrão: ThreeWayCompare<Key>).
  * 
  * Principais atributos privados:
  * - Nodeptr root: Ponteiro para o nó raiz da árvore AVL.
@@ -27,24 +33,35 @@
  * A classe oferece métodos para inserção, remoção, busca, impressão e obtenção de métricas
  * relacionadas ao desempenho das operações (como número de comparações e rotações).
  */
-template <typename Key, typename Value>
+template <typename Key, typename Value, typename Compare = ThreeWayCompare<Key>>
 class AVL : public IDictionary<Key, Value> {
 private:
     using Nodeptr = Node<Key, Value>*;
 
     Nodeptr root;
+    NodePool<Node<Key, Value>> m_pool; // Blocos de onde os nós são alocados
     
     int nodeCount = 0; // Contador de nós
     mutable long long comparisons = 0; // Contador de comparações
     long long rotations = 0; // Contador de rotações
+    Compare m_compare; // Comparação em três vias das chaves
+    mutable FrontCache<Key, Nodeptr> m_cache; // Cache opcional de chaves frequentes
+    Nodeptr lastTouched = nullptr; // Último nó inserido ou atualizado por _insert
+    Nodeptr m_rightmost = nullptr; // Nó de maior chave, válido enquanto m_appendRun for verdadeiro
+    bool m_appendRun = false; // A última inserção foi no fim da ordem: tenta o atalho pelo maior nó
+    bool m_pathAllRight = false; // A descida de _insert só seguiu para a direita
 
     // Funções auxiliares
     Nodeptr minValueNode(Nodeptr node);
     Nodeptr _remove(Nodeptr node, const Key& key);
     Nodeptr _insert(Nodeptr node, const Key& key, const Value& value_to_add);
+    Nodeptr _append(Nodeptr node, const Key& key, const Value& value_to_add);
+    void _add(const Key& key, const Value& value_to_add);
+    Nodeptr rebalance(Nodeptr node);
     Nodeptr leftRotate(Nodeptr node);
     Nodeptr rightRotate(Nodeptr node);
     Nodeptr findNode(Nodeptr node, const Key& key) const;
+    Nodeptr lookup(const Key& key) const;
     int height(Nodeptr node);
     int getBalance(Nodeptr node);
     void destroy(Nodeptr node);
@@ -57,11 +74,13 @@ private:
 
     // Função auxiliar para ordenação
     void in_Order_vec(Nodeptr node, std::vector<Key>& keys) const;
+    void in_Order_pairs(Nodeptr node, std::vector<std::pair<Key, Value>>& pairs) const;
     
 public:
     AVL() : root(nullptr), nodeCount(0), comparisons(0), rotations(0) {}
     ~AVL() {
         destroy(root);
+        m_pool.release();
     }
     
     void clear();
@@ -74,12 +93,19 @@ public:
     const Value& get(const Key& key) const override;
 
     std::vector<Key> get_all_keys_sorted() const override;
+    FrozenTree<Key, Value, Compare> freeze() const;
+    void enable_front_cache(size_t slots = 1024);
 
     // Funções para obter métricas
     long long get_comparisons() const override;
     long long get_rotations() const override;
     long long get_colors() const override;
     long long get_collisions() const override;
+    size_t get_node_bytes() const override;
+    long long get_rehashes() const override;
+    void reserve(size_t n) override;
+    long long get_cache_hits() const;
+    long long get_cache_misses() const;
 };
 
 //------------- Implementação --------------
@@ -97,8 +123,8 @@ public:
 * @note Esta função é recursiva e utiliza a propriedade de percurso in-ordem
 *       para garantir que as chaves sejam adicionadas ao vetor na ordem correta.
 */
-template <typename Key, typename Value>
-void AVL<Key, Value>::in_Order_vec(Nodeptr node, std::vector<Key>& keys_vec) const{
+template <typename Key, typename Value, typename Compare>
+void AVL<Key, Value, Compare>::in_Order_vec(Nodeptr node, std::vector<Key>& keys_vec) const{
     if (!node) return;
     
     in_Order_vec(node->left, keys_vec);
@@ -117,8 +143,8 @@ void AVL<Key, Value>::in_Order_vec(Nodeptr node, std::vector<Key>& keys_vec) con
  * @tparam Value Tipo do valor associado à chave nos nós da árvore.
  * @return std::vector<Key> Vetor contendo todas as chaves em ordem crescente.
  */
-template <typename Key, typename Value>
-std::vector<Key> AVL<Key, Value>::get_all_keys_sorted() const {
+template <typename Key, typename Value, typename Compare>
+std::vector<Key> AVL<Key, Value, Compare>::get_all_keys_sorted() const {
     std::vector<Key> keys_vec;
     if (this->isEmpty()) {
         return {}; 
@@ -131,23 +157,52 @@ std::vector<Key> AVL<Key, Value>::get_all_keys_sorted() const {
 }
 
 /**
- * @brief Libera recursivamente toda a memória alocada pelos nós da árvore AVL a partir do nó fornecido.
+ * @brief Coleta os pares (chave, valor) da árvore AVL em ordem crescente de chave.
  *
- * Esta função percorre a subárvore enraizada em 'node' utilizando pós-ordem (primeiro filhos, depois o nó),
- * garantindo que todos os nós filhos sejam deletados antes do próprio nó. É utilizada internamente para
- * destruir a árvore ao chamar o destrutor da classe ou o método clear(), evitando vazamentos de memória.
+ * @param node Ponteiro para o nó atual da árvore/subárvore.
+ * @param pairs Vetor onde os pares serão armazenados em ordem.
+ */
+template <typename Key, typename Value, typename Compare>
+void AVL<Key, Value, Compare>::in_Order_pairs(Nodeptr node, std::vector<std::pair<Key, Value>>& pairs) const{
+    if (!node) return;
+
+    in_Order_pairs(node->left, pairs);
+    pairs.push_back(node->data);
+    in_Order_pairs(node->right, pairs);
+}
+
+/**
+ * @brief Gera uma cópia imutável da árvore em layout contíguo otimizado para leitura.
+ *
+ * Indicada quando a ingestão terminou e o dicionário passa a ser apenas consultado. A árvore
+ * original não é alterada e pode continuar sendo usada.
+ *
+ * @return FrozenTree<Key, Value, Compare> Estrutura congelada com as mesmas chaves e valores.
+ */
+template <typename Key, typename Value, typename Compare>
+FrozenTree<Key, Value, Compare> AVL<Key, Value, Compare>::freeze() const {
+    std::vector<std::pair<Key, Value>> pairs;
+    pairs.reserve(this->size());
+    in_Order_pairs(root, pairs);
+    return FrozenTree<Key, Value, Compare>(std::move(pairs));
+}
+
+/**
+ * @brief Chama os destrutores de todos os nós da subárvore a partir do nó fornecido.
  *
- * Exemplo de uso:
- * - destroy(root); // Remove todos os nós da árvore a partir da raiz.
+ * Esta função percorre a subárvore enraizada em 'node' utilizando pós-ordem (primeiro filhos, depois o nó).
+ * A memória dos nós pertence ao pool e é devolvida de uma vez por m_pool.release(), chamado em seguida
+ * pelo destrutor e por clear(). Se os nós forem trivialmente destrutíveis, não há nada a percorrer.
  *
  * @param node Ponteiro para o nó raiz da subárvore a ser destruída. Se for nullptr, nada é feito.
  */
-template <typename Key, typename Value>
-void AVL<Key, Value>::destroy(Nodeptr node){
+template <typename Key, typename Value, typename Compare>
+void AVL<Key, Value, Compare>::destroy(Nodeptr node){
+    if (std::is_trivially_destructible<Node<Key, Value>>::value) return;
     if (node){
         destroy(node->left);
         destroy(node->right);
-        delete node;
+        node->~Node();
     }
 }
 
@@ -156,7 +211,7 @@ void AVL<Key, Value>::destroy(Nodeptr node){
  *
  * Esta função busca um nó cujo valor da chave seja igual ao parâmetro fornecido.
  * Se o nó for encontrado, retorna um ponteiro para ele; caso contrário, retorna nullptr.
- * Durante a busca, o contador de comparações é incrementado para cada comparação realizada.
+ * Cada nó visitado custa uma única comparação em três vias, contabilizada no contador de comparações.
  *
  * @tparam Key Tipo da chave armazenada nos nós da árvore.
  * @tparam Value Tipo do valor associado à chave.
@@ -164,25 +219,52 @@ void AVL<Key, Value>::destroy(Nodeptr node){
  * @param key Chave a ser buscada na árvore.
  * @return Nodeptr Ponteiro para o nó encontrado ou nullptr se não existir.
  */
-template <typename Key, typename Value>
-typename AVL<Key, Value>::Nodeptr AVL<Key, Value>::findNode(Nodeptr node, const Key& key) const {
+template <typename Key, typename Value, typename Compare>
+typename AVL<Key, Value, Compare>::Nodeptr AVL<Key, Value, Compare>::findNode(Nodeptr node, const Key& key) const {
     if (!node) {
         return node; // Retorna o nullptr se não encontrado
     }
 
     comparisons++; // Incrementa o contador de comparações
-    if (key < node->data.first){
+    int cmp = m_compare(key, node->data.first);
+    if (cmp < 0){
         return findNode(node->left, key);
     }
-    
-    comparisons++;
-    if (key > node->data.first){
+    if (cmp > 0){
         return findNode(node->right, key);
     }
 
     return node; // Retorna o nó se a chave for encontrada
 }
 
+/**
+ * @brief Procura a chave consultando primeiro o cache de chaves frequentes, se ativo.
+ *
+ * Em caso de acerto, a descida pela árvore é evitada. Em caso de falta, a busca normal é
+ * feita e o nó encontrado passa a ocupar a posição da chave no cache.
+ *
+ * @param key Chave a ser buscada na árvore.
+ * @return Nodeptr Ponteiro para o nó encontrado ou nullptr se não existir.
+ */
+template <typename Key, typename Value, typename Compare>
+typename AVL<Key, Value, Compare>::Nodeptr AVL<Key, Value, Compare>::lookup(const Key& key) const {
+    if (!m_cache.enabled()) {
+        return findNode(root, key);
+    }
+
+    size_t slot = m_cache.slot_of(key);
+    Nodeptr node = m_cache.lookup(key, slot);
+    if (node) {
+        return node;
+    }
+
+    node = findNode(root, key);
+    if (node) {
+        m_cache.store(slot, node);
+    }
+    return node;
+}
+
 /**
  * @brief Retorna a altura de um nó na árvore AVL.
  *
@@ -194,8 +276,8 @@ typename AVL<Key, Value>::Nodeptr AVL<Key, Value>::findNode(Nodeptr node, const
  * @param node Ponteiro para o nó cuja altura será retornada.
  * @return int Altura do nó, ou 0 se o nó for nulo.
  */
-template <typename Key, typename Value>
-int AVL<Key, Value>::height(Nodeptr node) {
+template <typename Key, typename Value, typename Compare>
+int AVL<Key, Value, Compare>::height(Nodeptr node) {
     return node ? node->height : 0;
 }
 
@@ -212,8 +294,8 @@ int AVL<Key, Value>::height(Nodeptr node) {
  * @return int Fator de balanceamento do nó (altura do filho direito - altura do filho esquerdo).
  *             Retorna 0 se o nó for nulo.
  */
-template <typename Key, typename Value>
-int AVL<Key, Value>::getBalance(Nodeptr node) {
+template <typename Key, typename Value, typename Compare>
+int AVL<Key, Value, Compare>::getBalance(Nodeptr node) {
     return node ? height(node->right) - height(node->left) : 0;
 }
 
@@ -228,8 +310,8 @@ int AVL<Key, Value>::getBalance(Nodeptr node) {
  * @param node Ponteiro para o nó onde a rotação à esquerda será realizada.
  * @return Nodeptr Novo nó raiz da subárvore após a rotação.
  */
-template <typename Key, typename Value>
-typename AVL<Key, Value>::Nodeptr AVL<Key, Value>::leftRotate(Nodeptr node) {
+template <typename Key, typename Value, typename Compare>
+typename AVL<Key, Value, Compare>::Nodeptr AVL<Key, Value, Compare>::leftRotate(Nodeptr node) {
     rotations++; // Incrementa o contador de rotações
 
     Nodeptr u = node->right;
@@ -253,8 +335,8 @@ typename AVL<Key, Value>::Nodeptr AVL<Key, Value>::leftRotate(Nodeptr node) {
  * @param node Ponteiro para o nó em torno do qual a rotação será realizada.
  * @return Nodeptr Novo nó raiz da subárvore após a rotação.
  */
-template <typename Key, typename Value>
-typename AVL<Key, Value>::Nodeptr AVL<Key, Value>::rightRotate(Nodeptr node) {
+template <typename Key, typename Value, typename Compare>
+typename AVL<Key, Value, Compare>::Nodeptr AVL<Key, Value, Compare>::rightRotate(Nodeptr node) {
     rotations++; // Incrementa o contador de rotações
 
     Nodeptr u = node->left;
@@ -277,8 +359,8 @@ typename AVL<Key, Value>::Nodeptr AVL<Key, Value>::rightRotate(Nodeptr node) {
  * @param node Ponteiro para o nó a partir do qual a busca será realizada.
  * @return Nodeptr Ponteiro para o nó com o menor valor encontrado, ou nullptr se o nó fornecido for nulo.
  */
-template <typename Key, typename Value>
-typename AVL<Key, Value>::Nodeptr AVL<Key, Value>::minValueNode(Nodeptr node) {
+template <typename Key, typename Value, typename Compare>
+typename AVL<Key, Value, Compare>::Nodeptr AVL<Key, Value, Compare>::minValueNode(Nodeptr node) {
     Nodeptr current = node;
     while (current && current->left != nullptr)
         current = current->left;
@@ -299,27 +381,40 @@ typename AVL<Key, Value>::Nodeptr AVL<Key, Value>::minValueNode(Nodeptr node) {
  * @param value_to_add Valor a ser associado à chave.
  * @return Nodeptr Ponteiro para o nó raiz da subárvore após a inserção e possíveis rotações.
  */
-template <typename Key, typename Value>
-typename AVL<Key, Value>::Nodeptr AVL<Key, Value>::_insert(Nodeptr node, const Key& key, const Value& value_to_add) {
+template <typename Key, typename Value, typename Compare>
+typename AVL<Key, Value, Compare>::Nodeptr AVL<Key, Value, Compare>::_insert(Nodeptr node, const Key& key, const Value& value_to_add) {
     if (!node){
         nodeCount++; // Incrementa o contador de nós
-        return new Node<Key, Value>(std::make_pair(key, value_to_add), 1);
+        lastTouched = m_pool.create(std::make_pair(key, value_to_add), 1);
+        return lastTouched;
     }
 
-    if (key < node->data.first){
-        comparisons++; // Incrementa o contador de comparações
+    comparisons++; // Incrementa o contador de comparações
+    int cmp = m_compare(key, node->data.first);
+    if (cmp < 0){
+        m_pathAllRight = false;
         node->left = _insert(node->left, key, value_to_add);
     }
-    else if (key > node->data.first){
-        comparisons+= 2; // Incrementa o contador de comparações
+    else if (cmp > 0){
         node->right = _insert(node->right, key, value_to_add);
     }
     else {
-        comparisons+= 2; // Incrementa o contador de comparações
         node->data.second = value_to_add; // Atualiza o valor se a chave já existir
+        lastTouched = node;
         return node;
     }
 
+    return rebalance(node);
+}
+
+/**
+ * @brief Atualiza a altura do nó e aplica a rotação (simples ou dupla) necessária após uma inserção abaixo dele.
+ *
+ * @param node Ponteiro para o nó cuja subárvore recebeu um novo nó.
+ * @return Nodeptr Ponteiro para o nó raiz da subárvore após possíveis rotações.
+ */
+template <typename Key, typename Value, typename Compare>
+typename AVL<Key, Value, Compare>::Nodeptr AVL<Key, Value, Compare>::rebalance(Nodeptr node) {
     node->height = 1 + std::max(height(node->left), height(node->right));
 
     int bal = getBalance(node);
@@ -344,6 +439,66 @@ typename AVL<Key, Value>::Nodeptr AVL<Key, Value>::_insert(Nodeptr node, const K
     return node;
 }
 
+/**
+ * @brief Insere uma chave maior que todas as da árvore, descendo apenas pelo caminho mais à direita.
+ *
+ * Não há comparações na descida: a chave já foi comparada com o maior nó. Como os nós da AVL não
+ * guardam o pai, o caminho ainda é percorrido (O(log n) ponteiros) para atualizar alturas e rotacionar.
+ *
+ * @param node Ponteiro para o nó atual do caminho mais à direita.
+ * @param key Chave a ser inserida.
+ * @param value_to_add Valor a ser associado à chave.
+ * @return Nodeptr Ponteiro para o nó raiz da subárvore após a inserção e possíveis rotações.
+ */
+template <typename Key, typename Value, typename Compare>
+typename AVL<Key, Value, Compare>::Nodeptr AVL<Key, Value, Compare>::_append(Nodeptr node, const Key& key, const Value& value_to_add) {
+    if (!node) {
+        nodeCount++;
+        lastTouched = m_pool.create(std::make_pair(key, value_to_add), 1);
+        return lastTouched;
+    }
+
+    node->right = _append(node->right, key, value_to_add);
+    return rebalance(node);
+}
+
+/**
+ * @brief Insere ou atualiza a chave a partir da raiz, detectando sequências crescentes.
+ *
+ * Se a inserção anterior criou a nova maior chave, a chave é comparada primeiro com o maior nó; sendo
+ * maior, é anexada por _append com uma única comparação. Caso contrário, segue a descida normal de
+ * _insert, que registra se o novo nó ficou no fim da ordem. O nó afetado fica em lastTouched.
+ *
+ * @param key Chave a ser inserida ou atualizada.
+ * @param value_to_add Valor a ser associado à chave.
+ */
+template <typename Key, typename Value, typename Compare>
+void AVL<Key, Value, Compare>::_add(const Key& key, const Value& value_to_add) {
+    if (m_appendRun) {
+        comparisons++;
+        int cmp = m_compare(key, m_rightmost->data.first);
+        if (cmp > 0) {
+            root = _append(root, key, value_to_add);
+            m_rightmost = lastTouched;
+            return;
+        }
+        if (cmp == 0) {
+            m_rightmost->data.second = value_to_add;
+            lastTouched = m_rightmost;
+            return;
+        }
+        m_appendRun = false;
+    }
+
+    int before = nodeCount;
+    m_pathAllRight = true;
+    root = _insert(root, key, value_to_add);
+    if (nodeCount != before && m_pathAllRight) {
+        m_rightmost = lastTouched;
+        m_appendRun = true;
+    }
+}
+
 /**
  * @brief Remove um nó com a chave especificada da árvore AVL.
  *
@@ -360,25 +515,25 @@ typename AVL<Key, Value>::Nodeptr AVL<Key, Value>::_insert(Nodeptr node, const K
  * @param key Chave do nó a ser removido.
  * @return Nodeptr Ponteiro para o nó raiz da subárvore após a remoção e rebalanceamento.
  */
-template <typename Key, typename Value>
-typename AVL<Key, Value>::Nodeptr AVL<Key, Value>::_remove(Nodeptr node, const Key& key) {
+template <typename Key, typename Value, typename Compare>
+typename AVL<Key, Value, Compare>::Nodeptr AVL<Key, Value, Compare>::_remove(Nodeptr node, const Key& key) {
     if (!node) {
         return node;
     }
 
-    if (key < node->data.first){
-        comparisons++; // Incrementa o contador de comparações
+    comparisons++; // Incrementa o contador de comparações
+    int cmp = m_compare(key, node->data.first);
+    if (cmp < 0){
         node->left = _remove(node->left, key);
     }
-    else if (key > node->data.first){
-        comparisons+= 2; // Incrementa o contador de comparações
+    else if (cmp > 0){
         node->right = _remove(node->right, key);}
     else {
-        comparisons+= 2; // Incrementa o contador de comparações
         if (!node->left || !node->right) {
             Nodeptr temp = node->left ? node->left : node->right;
             nodeCount--; // Decrementa o contador de nós
-            delete node;
+            m_cache.invalidate(node->data.first); // O nó deixará de existir
+            m_pool.destroy(node);
             return temp;
         } else {
             Nodeptr temp = minValueNode(node->right);
@@ -418,10 +573,13 @@ typename AVL<Key, Value>::Nodeptr AVL<Key, Value>::_remove(Nodeptr node, const K
  *
  * @note Após chamar esta função, a árvore estará vazia e pronta para reutilização.
  */
-template <typename Key, typename Value>
-void AVL<Key, Value>::clear(){
+template <typename Key, typename Value, typename Compare>
+void AVL<Key, Value, Compare>::clear(){
     destroy(root);
+    m_pool.release();
     root = nullptr;
+    m_appendRun = false;
+    m_cache.invalidate_all();
     nodeCount = 0; // Reseta o contador de nós
     comparisons = 0; // Reseta o contador de comparações
     rotations = 0; // Reseta o contador de rotações
@@ -437,9 +595,22 @@ void AVL<Key, Value>::clear(){
  * @param key Chave a ser inserida na árvore.
  * @param value_to_add Valor associado à chave a ser inserido.
  */
-template <typename Key, typename Value>
-void AVL<Key, Value>::add(const Key& key, const Value& value_to_add){
-    root = _insert(root, key, value_to_add);
+template <typename Key, typename Value, typename Compare>
+void AVL<Key, Value, Compare>::add(const Key& key, const Value& value_to_add){
+    if (!m_cache.enabled()) {
+        _add(key, value_to_add);
+        return;
+    }
+
+    size_t slot = m_cache.slot_of(key);
+    Nodeptr node = m_cache.lookup(key, slot);
+    if (node) {
+        node->data.second = value_to_add; // Acerto no cache: atualiza sem descer a árvore
+        return;
+    }
+
+    _add(key, value_to_add);
+    m_cache.store(slot, lastTouched);
 }
 
 /**
@@ -450,8 +621,10 @@ void AVL<Key, Value>::add(const Key& key, const Value& value_to_add){
  *
  * @param key A chave do nó a ser removido.
  */
-template <typename Key, typename Value>
-void AVL<Key, Value>::remove(const Key& key) {
+template <typename Key, typename Value, typename Compare>
+void AVL<Key, Value, Compare>::remove(const Key& key) {
+    m_cache.invalidate(key); // O nó da chave pode receber os dados do sucessor
+    m_appendRun = false;     // O maior nó pode ser removido
     root = _remove(root, key);
 }
 
@@ -466,8 +639,8 @@ void AVL<Key, Value>::remove(const Key& key) {
  * @tparam Value Tipo do valor associado à chave nos nós da árvore.
  * @return std::string Uma string contendo as chaves da árvore em ordem, separadas por espaço.
  */
-template <typename Key, typename Value>
-std::string AVL<Key, Value>::in_Order() const {
+template <typename Key, typename Value, typename Compare>
+std::string AVL<Key, Value, Compare>::in_Order() const {
     std::stack<Nodeptr> s;
     Nodeptr curr = root;
     std::string res;
@@ -496,8 +669,8 @@ std::string AVL<Key, Value>::in_Order() const {
  * @return Uma string contendo as chaves dos nós em ordem de percurso pré-ordem,
  *         separadas por espaço. Retorna uma string vazia se a árvore estiver vazia.
  */
-template <typename Key, typename Value>
-std::string AVL<Key, Value>::pre_Ordem() const {
+template <typename Key, typename Value, typename Compare>
+std::string AVL<Key, Value, Compare>::pre_Ordem() const {
     if (!root) return "";
     std::stack<Nodeptr> s;
     s.push(root);
@@ -521,8 +694,8 @@ std::string AVL<Key, Value>::pre_Ordem() const {
  *
  * @return std::string String contendo as chaves dos nós em ordem pós-ordem, separadas por espaço.
  */
-template <typename Key, typename Value>
-std::string AVL<Key, Value>::pos_Ordem() const {
+template <typename Key, typename Value, typename Compare>
+std::string AVL<Key, Value, Compare>::pos_Ordem() const {
     if (!root) return "";
     std::stack<Nodeptr> s1, s2;
     s1.push(root);
@@ -557,8 +730,8 @@ std::string AVL<Key, Value>::pos_Ordem() const {
  * @param prefix String utilizada para formatar a indentação dos nós.
  * @param isLeft Indica se o nó atual é filho à esquerda do seu pai.
  */
-template <typename Key, typename Value>
-void AVL<Key, Value>::printTree(Nodeptr node, std::string prefix, bool isLeft) const {
+template <typename Key, typename Value, typename Compare>
+void AVL<Key, Value, Compare>::printTree(Nodeptr node, std::string prefix, bool isLeft) const {
     if (!node) return;
     std::cout << prefix;
     std::cout << (isLeft ? "├──" : "└──");
@@ -578,9 +751,9 @@ void AVL<Key, Value>::printTree(Nodeptr node, std::string prefix, bool isLeft) c
  * @return O valor associado à chave fornecida.
  * @throws std::runtime_error Se a chave não for encontrada na árvore.
  */
-template <typename Key, typename Value>
-const Value& AVL<Key, Value>::get(const Key& key) const {
-    Nodeptr node = findNode(root, key);
+template <typename Key, typename Value, typename Compare>
+const Value& AVL<Key, Value, Compare>::get(const Key& key) const {
+    Nodeptr node = lookup(key);
 
     if (node) {
         return node->data.second; // Retorna o valor associado à chave
@@ -598,9 +771,9 @@ const Value& AVL<Key, Value>::get(const Key& key) const {
  * @param key A chave a ser buscada na árvore.
  * @return true se a chave estiver presente na árvore, false caso contrário.
  */
-template <typename Key, typename Value>
-bool AVL<Key, Value>::contains(const Key& key) const {
-    Nodeptr node = findNode(root, key);
+template <typename Key, typename Value, typename Compare>
+bool AVL<Key, Value, Compare>::contains(const Key& key) const {
+    Nodeptr node = lookup(key);
     return node != nullptr; // Retorna true se o nó for encontrado, false caso contrário
 }
 
@@ -613,8 +786,8 @@ bool AVL<Key, Value>::contains(const Key& key) const {
  *
  * @note Esta função é destinada principalmente para fins de depuração e visualização da árvore.
  */
-template <typename Key, typename Value>
-void AVL<Key, Value>::print() const {
+template <typename Key, typename Value, typename Compare>
+void AVL<Key, Value, Compare>::print() const {
     std::cout << "In-order: " << in_Order() << std::endl;
     std::cout << "Pré-ordem: " << pre_Ordem() << std::endl;
     std::cout << "Pós-ordem: " << pos_Ordem() << std::endl;
@@ -629,8 +802,8 @@ void AVL<Key, Value>::print() const {
  *
  * @return int Número de nós na árvore.
  */
-template <typename Key, typename Value>
-size_t AVL<Key, Value>::size() const  {
+template <typename Key, typename Value, typename Compare>
+size_t AVL<Key, Value, Compare>::size() const  {
     return nodeCount; // Retorna o número de nós na árvore
 }
 
@@ -642,8 +815,8 @@ size_t AVL<Key, Value>::size() const  {
  *
  * @return true se a árvore estiver vazia, false caso contrário.
  */
-template <typename Key, typename Value>
-bool AVL<Key, Value>::isEmpty() const {
+template <typename Key, typename Value, typename Compare>
+bool AVL<Key, Value, Compare>::isEmpty() const {
     return nodeCount == 0;
 }
 
@@ -655,8 +828,8 @@ bool AVL<Key, Value>::isEmpty() const {
  *
  * @return O número total de comparações realizadas como um valor do tipo long long.
  */
-template <typename Key, typename Value>
-long long AVL<Key, Value>::get_comparisons() const {
+template <typename Key, typename Value, typename Compare>
+long long AVL<Key, Value, Compare>::get_comparisons() const {
     return comparisons; // Retorna o número de comparações realizadas
 }
 
@@ -669,19 +842,70 @@ long long AVL<Key, Value>::get_comparisons() const {
  *
  * @return long long O número total de rotações realizadas.
  */
-template <typename Key, typename Value>
-long long AVL<Key, Value>::get_rotations() const {
+template <typename Key, typename Value, typename Compare>
+long long AVL<Key, Value, Compare>::get_rotations() const {
     return rotations; // Retorna o número de rotações realizadas
 }
 
-template <typename Key, typename Value>
-long long AVL<Key, Value>::get_colors() const {
+/**
+ * @brief Ativa o cache direto de chaves frequentes (ou o desativa, com slots = 0).
+ *
+ * Com o cache ativo, get, contains e add consultam primeiro uma tabela pequena de ponteiros
+ * para nós indexada pelo hash da chave; acertos evitam a descida pela árvore. Indicado para
+ * entradas com distribuição de Zipf, como textos em linguagem natural.
+ *
+ * @param slots Número de posições do cache (arredondado para potência de 2).
+ */
+template <typename Key, typename Value, typename Compare>
+void AVL<Key, Value, Compare>::enable_front_cache(size_t slots) {
+    m_cache.enable(slots);
+}
+
+/**
+ * @brief Retorna o número de acessos resolvidos pelo cache de chaves frequentes.
+ */
+template <typename Key, typename Value, typename Compare>
+long long AVL<Key, Value, Compare>::get_cache_hits() const {
+    return m_cache.get_hits();
+}
+
+/**
+ * @brief Retorna o número de acessos que não foram resolvidos pelo cache e desceram a árvore.
+ */
+template <typename Key, typename Value, typename Compare>
+long long AVL<Key, Value, Compare>::get_cache_misses() const {
+    return m_cache.get_misses();
+}
+
+template <typename Key, typename Value, typename Compare>
+long long AVL<Key, Value, Compare>::get_colors() const {
     return 0; // Retorna 0, pois AVL não utiliza cores como RB-Tree
 }
 
-template <typename Key, typename Value>
-long long AVL<Key, Value>::get_collisions() const {
+template <typename Key, typename Value, typename Compare>
+long long AVL<Key, Value, Compare>::get_collisions() const {
     return 0; // Retorna 0, pois AVL não utiliza colisões como RB-Tree
 }
 
+/**
+ * @brief Retorna o tamanho em bytes de cada nó da árvore.
+ */
+template <typename Key, typename Value, typename Compare>
+size_t AVL<Key, Value, Compare>::get_node_bytes() const {
+    return sizeof(Node<Key, Value>);
+}
+
+template <typename Key, typename Value, typename Compare>
+long long AVL<Key, Value, Compare>::get_rehashes() const {
+    return 0; // Retorna 0, pois uma árvore não é redimensionada
+}
+
+/**
+ * @brief Aloca antecipadamente no pool os blocos para n nós, de modo que as próximas inserções não chamem new.
+ */
+template <typename Key, typename Value, typename Compare>
+void AVL<Key, Value, Compare>::reserve(size_t n) {
+    m_pool.reserve(n);
+}
+
 #endif
\ No newline at end of file
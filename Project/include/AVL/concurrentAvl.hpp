@@ -0,0 +1,928 @@
+#ifndef CONCURRENT_AVL_HPP
+#define CONCURRENT_AVL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+#include "ConcurrentNode.hpp"
+#include "../utils/epoch.hpp"
+#include "../utils/threeWayCompare.hpp"
+
+/**
+ * @brief Árvore AVL concorrente com controle otimista de versões (Bronson et al., "A Practical
+ * Concurrent Binary Search Tree", PPoPP 2010).
+ *
+ * Várias threads podem ler e escrever ao mesmo tempo:
+ * - Leitores não usam travas. Cada nó tem uma versão que muda sempre que uma rotação o move para
+ *   baixo; a descida valida, mão sobre mão, que a versão do nó pai não mudou depois de ler o filho.
+ *   Se mudou, a busca recomeça a partir do nível anterior.
+ * - Escritores travam apenas os nós que alteram: o pai de um novo nó, o nó cujo valor muda, ou os
+ *   (no máximo quatro) nós envolvidos em uma rotação, sempre de cima para baixo.
+ * - O balanceamento é relaxado: alturas podem ficar temporariamente desatualizadas e cada thread
+ *   corrige, subindo pela árvore, o dano que causou. Sem concorrência, a árvore volta a ser AVL.
+ * - Remover uma chave de um nó com dois filhos apenas anula o seu valor (nó de roteamento); nós de
+ *   roteamento com menos de dois filhos são desconectados durante o rebalanceamento.
+ * - Nós desconectados e valores substituídos são liberados por épocas (EpochManager), pois um leitor
+ *   ainda pode estar passando por eles.
+ *
+ * Diferente de IDictionary, get() devolve uma cópia do valor: uma referência para o valor interno
+ * poderia ser invalidada por uma atualização concorrente. Para não criar um contador compartilhado
+ * disputado a cada nó visitado, a árvore não conta comparações.
+ *
+ * @tparam Key Tipo da chave (deve possuir construtor padrão, usado pelo nó sentinela).
+ * @tparam Value Tipo do valor associado a cada chave.
+ * @tparam Compare Política de comparação em três vias (padrão: ThreeWayCompare<Key>).
+ */
+template <typename Key, typename Value, typename Compare = ThreeWayCompare<Key>>
+class ConcurrentAVL {
+private:
+    using NodeType = ConcurrentNode<Key, Value>;
+    using Nodeptr = NodeType*;
+
+    // Resultado de uma tentativa: RETRY pede para repetir a partir do nível anterior
+    enum class Status { RETRY, NOT_FOUND, FOUND };
+
+    // Nós danificados por uma rotação que serão revisitados depois do nó mais profundo
+    using Pending = std::vector<Nodeptr>;
+
+    // Condições devolvidas por nodeCondition (valores >= 0 são a altura correta do nó)
+    static constexpr int UNLINK_REQUIRED = -1;
+    static constexpr int REBALANCE_REQUIRED = -2;
+    static constexpr int NOTHING_REQUIRED = -3;
+
+    static constexpr int SPIN_LIMIT = 100; // tentativas antes de esperar pela trava do nó em rotação
+
+    mutable NodeType rootHolder; // Sentinela: a raiz da árvore é o seu filho direito
+    std::atomic<long long> nodeCount{0}; // Chaves presentes (nós de roteamento não contam)
+    std::atomic<long long> rotations{0}; // Contador de rotações
+    Compare m_compare; // Comparação em três vias das chaves
+    mutable EpochManager m_epoch; // Liberação segura de nós e valores removidos
+
+    // Funções auxiliares de leitura e escrita
+    void waitUntilNotChanging(Nodeptr node) const;
+    Status attemptGet(const Key& key, Nodeptr node, int dir, uint64_t nodeV, Value& out) const;
+    Status attemptPut(const Key& key, const Value& value, Nodeptr node, int dir, uint64_t nodeV);
+    Status attemptInsert(const Key& key, const Value& value, Nodeptr node, int dir, uint64_t nodeV);
+    Status attemptUpdate(Nodeptr node, const Value& value);
+    Status attemptRemove(const Key& key, Nodeptr node, int dir, uint64_t nodeV);
+    Status attemptRmNode(Nodeptr parent, Nodeptr node);
+
+    // Funções auxiliares de balanceamento (sufixo _nl: chamadas com as travas necessárias já obtidas)
+    int nodeCondition(Nodeptr node) const;
+    void fixHeightAndRebalance(Nodeptr node);
+    Nodeptr fixHeight_nl(Nodeptr node);
+    Nodeptr rebalance_nl(Nodeptr nParent, Nodeptr n, Pending& pending);
+    Nodeptr rebalanceToRight_nl(Nodeptr nParent, Nodeptr n, Nodeptr nL, int hR0, Pending& pending);
+    Nodeptr rebalanceToLeft_nl(Nodeptr nParent, Nodeptr n, Nodeptr nR, int hL0, Pending& pending);
+    Nodeptr rotateRight_nl(Nodeptr nParent, Nodeptr n, Nodeptr nL, int hR, int hLL, Nodeptr nLR, int hLR, Pending& pending);
+    Nodeptr rotateLeft_nl(Nodeptr nParent, Nodeptr n, int hL, Nodeptr nR, Nodeptr nRL, int hRL, int hRR, Pending& pending);
+    Nodeptr rotateRightOverLeft_nl(Nodeptr nParent, Nodeptr n, Nodeptr nL, int hR, int hLL, Nodeptr nLR, int hLRL, Pending& pending);
+    Nodeptr rotateLeftOverRight_nl(Nodeptr nParent, Nodeptr n, int hL, Nodeptr nR, Nodeptr nRL, int hRR, int hRLR, Pending& pending);
+    bool attemptUnlink_nl(Nodeptr parent, Nodeptr node);
+
+    // Funções auxiliares de memória e percurso
+    void retireNode(Nodeptr node);
+    void retireValue(Value* value);
+    void destroy(Nodeptr node);
+    void in_Order_vec(Nodeptr node, std::vector<Key>& keys_vec) const;
+    int validate(Nodeptr node, Nodeptr parent, const Key* low, const Key* high) const;
+
+    static int height(Nodeptr node) { return node ? node->height.load() : 0; }
+    static bool canUnlink(Nodeptr node) { return !node->left.load() || !node->right.load(); }
+    static uint64_t beginChange(uint64_t version) { return version | NodeType::SHRINKING; }
+    static uint64_t endChange(uint64_t version) { return version + NodeType::SHRINK_INCR; }
+
+public:
+    ConcurrentAVL() : rootHolder(Key{}, nullptr, nullptr, 0) {}
+    ~ConcurrentAVL() {
+        destroy(rootHolder.right.load());
+    }
+    ConcurrentAVL(const ConcurrentAVL&) = delete;
+    ConcurrentAVL& operator=(const ConcurrentAVL&) = delete;
+
+    void add(const Key& key, const Value& value);
+    void remove(const Key& key);
+    bool find(const Key& key, Value& out) const;
+    bool contains(const Key& key) const;
+    Value get(const Key& key) const;
+    bool isEmpty() const;
+    size_t size() const;
+
+    std::vector<Key> get_all_keys_sorted() const;
+    bool validate() const;
+
+    // Funções para obter métricas
+    long long get_rotations() const;
+    long long get_reclaimed() const;
+};
+
+//------------- Leitura e escrita otimistas --------------
+
+/**
+ * @brief Espera o fim de uma rotação que está movendo o nó para baixo.
+ *
+ * Tenta algumas vezes observar a mudança de versão; depois disso espera pela trava do nó, que a
+ * thread que rotaciona mantém até terminar.
+ */
+template <typename Key, typename Value, typename Compare>
+void ConcurrentAVL<Key, Value, Compare>::waitUntilNotChanging(Nodeptr node) const {
+    uint64_t version = node->version.load();
+    if (version & NodeType::SHRINKING) {
+        for (int i = 0; i < SPIN_LIMIT; ++i) {
+            if (node->version.load() != version) return;
+        }
+        std::lock_guard<std::mutex> lock(node->lock);
+    }
+}
+
+/**
+ * @brief Busca a chave abaixo de node, na direção dir, validando a versão de node a cada passo.
+ *
+ * @param key Chave buscada.
+ * @param node Nó corrente (já validado pelo nível anterior).
+ * @param dir Direção do filho a ser visitado (negativa: esquerda; positiva: direita).
+ * @param nodeV Versão de node observada pelo nível anterior.
+ * @param out Recebe uma cópia do valor, se a chave for encontrada.
+ * @return Status RETRY se node mudou e a busca deve recomeçar no nível anterior.
+ */
+template <typename Key, typename Value, typename Compare>
+typename ConcurrentAVL<Key, Value, Compare>::Status
+ConcurrentAVL<Key, Value, Compare>::attemptGet(const Key& key, Nodeptr node, int dir, uint64_t nodeV, Value& out) const {
+    while (true) {
+        Nodeptr child = node->child(dir);
+        if (node->version.load() != nodeV) return Status::RETRY;
+        if (!child) return Status::NOT_FOUND;
+
+        int nextD = m_compare(key, child->key);
+        if (nextD == 0) {
+            Value* value = child->value.load();
+            if (!value) return Status::NOT_FOUND; // nó de roteamento
+            out = *value;
+            return Status::FOUND;
+        }
+
+        uint64_t chV = child->version.load();
+        if (chV & NodeType::SHRINKING) {
+            waitUntilNotChanging(child);
+        } else if (chV != NodeType::UNLINKED && child == node->child(dir)) {
+            if (node->version.load() != nodeV) return Status::RETRY;
+            Status status = attemptGet(key, child, nextD, chV, out);
+            if (status != Status::RETRY) return status;
+        }
+        // Caso contrário, relê o filho de node e tenta novamente neste nível
+    }
+}
+
+/**
+ * @brief Insere ou atualiza a chave abaixo de node, com a mesma validação de attemptGet.
+ *
+ * @return Status NOT_FOUND se a chave foi inserida, FOUND se o valor foi atualizado.
+ */
+template <typename Key, typename Value, typename Compare>
+typename ConcurrentAVL<Key, Value, Compare>::Status
+ConcurrentAVL<Key, Value, Compare>::attemptPut(const Key& key, const Value& value, Nodeptr node, int dir, uint64_t nodeV) {
+    Status status = Status::RETRY;
+    do {
+        Nodeptr child = node->child(dir);
+        if (node->version.load() != nodeV) return Status::RETRY;
+
+        if (!child) {
+            status = attemptInsert(key, value, node, dir, nodeV);
+        } else {
+            int nextD = m_compare(key, child->key);
+            if (nextD == 0) {
+                status = attemptUpdate(child, value);
+            } else {
+                uint64_t chV = child->version.load();
+                if (chV & NodeType::SHRINKING) {
+                    waitUntilNotChanging(child);
+                } else if (chV != NodeType::UNLINKED && child == node->child(dir)) {
+                    if (node->version.load() != nodeV) return Status::RETRY;
+                    status = attemptPut(key, value, child, nextD, chV);
+                }
+            }
+        }
+    } while (status == Status::RETRY);
+    return status;
+}
+
+/**
+ * @brief Pendura um novo nó como filho de node, travando apenas node.
+ */
+template <typename Key, typename Value, typename Compare>
+typename ConcurrentAVL<Key, Value, Compare>::Status
+ConcurrentAVL<Key, Value, Compare>::attemptInsert(const Key& key, const Value& value, Nodeptr node, int dir, uint64_t nodeV) {
+    {
+        std::lock_guard<std::mutex> lock(node->lock);
+        if (node->version.load() != nodeV || node->child(dir)) return Status::RETRY;
+        node->setChild(dir, new NodeType(key, new Value(value), node));
+    }
+    nodeCount++; // Incrementa o contador de chaves
+
+    fixHeightAndRebalance(node);
+    return Status::NOT_FOUND;
+}
+
+/**
+ * @brief Troca o valor de um nó existente (reativando-o, se for de roteamento).
+ */
+template <typename Key, typename Value, typename Compare>
+typename ConcurrentAVL<Key, Value, Compare>::Status
+ConcurrentAVL<Key, Value, Compare>::attemptUpdate(Nodeptr node, const Value& value) {
+    Value* old;
+    {
+        std::lock_guard<std::mutex> lock(node->lock);
+        if (node->version.load() == NodeType::UNLINKED) return Status::RETRY;
+        old = node->value.exchange(new Value(value));
+    }
+
+    if (old) {
+        retireValue(old);
+        return Status::FOUND;
+    }
+    nodeCount++; // Nó de roteamento voltou a conter uma chave
+    return Status::NOT_FOUND;
+}
+
+/**
+ * @brief Localiza e remove a chave abaixo de node, com a mesma validação de attemptGet.
+ */
+template <typename Key, typename Value, typename Compare>
+typename ConcurrentAVL<Key, Value, Compare>::Status
+ConcurrentAVL<Key, Value, Compare>::attemptRemove(const Key& key, Nodeptr node, int dir, uint64_t nodeV) {
+    Status status = Status::RETRY;
+    do {
+        Nodeptr child = node->child(dir);
+        if (node->version.load() != nodeV) return Status::RETRY;
+        if (!child) return Status::NOT_FOUND;
+
+        int nextD = m_compare(key, child->key);
+        if (nextD == 0) {
+            status = attemptRmNode(node, child);
+        } else {
+            uint64_t chV = child->version.load();
+            if (chV & NodeType::SHRINKING) {
+                waitUntilNotChanging(child);
+            } else if (chV != NodeType::UNLINKED && child == node->child(dir)) {
+                if (node->version.load() != nodeV) return Status::RETRY;
+                status = attemptRemove(key, child, nextD, chV);
+            }
+        }
+    } while (status == Status::RETRY);
+    return status;
+}
+
+/**
+ * @brief Remove a chave do nó n, filho de parent.
+ *
+ * Se n tem dois filhos, apenas o seu valor é anulado (n vira nó de roteamento, travando só n).
+ * Caso contrário, n é desconectado travando parent e n, e o dano é corrigido a partir de parent.
+ */
+template <typename Key, typename Value, typename Compare>
+typename ConcurrentAVL<Key, Value, Compare>::Status
+ConcurrentAVL<Key, Value, Compare>::attemptRmNode(Nodeptr parent, Nodeptr n) {
+    if (!n->value.load()) return Status::NOT_FOUND;
+
+    Value* prev;
+    bool unlinked = false;
+    if (!canUnlink(n)) {
+        std::lock_guard<std::mutex> lock(n->lock);
+        if (n->version.load() == NodeType::UNLINKED || canUnlink(n)) return Status::RETRY;
+        prev = n->value.exchange(nullptr);
+        if (!prev) return Status::NOT_FOUND;
+    } else {
+        std::lock_guard<std::mutex> parentLock(parent->lock);
+        if (parent->version.load() == NodeType::UNLINKED || n->parent.load() != parent
+            || n->version.load() == NodeType::UNLINKED) {
+            return Status::RETRY;
+        }
+
+        std::lock_guard<std::mutex> lock(n->lock);
+        prev = n->value.load();
+        if (!prev) return Status::NOT_FOUND;
+        if (!canUnlink(n)) return Status::RETRY;
+
+        Nodeptr splice = n->left.load() ? n->left.load() : n->right.load();
+        if (parent->left.load() == n) parent->left.store(splice);
+        else parent->right.store(splice);
+        if (splice) splice->parent.store(parent);
+
+        n->value.store(nullptr);
+        n->version.store(NodeType::UNLINKED);
+        unlinked = true;
+    }
+
+    retireValue(prev);
+    nodeCount--; // Decrementa o contador de chaves
+
+    if (unlinked) {
+        retireNode(n);
+        fixHeightAndRebalance(parent);
+    }
+    return Status::FOUND;
+}
+
+//------------- Balanceamento relaxado --------------
+
+/**
+ * @brief Classifica o reparo que o nó precisa, a partir de uma leitura não atômica dos filhos.
+ *
+ * @return int UNLINK_REQUIRED, REBALANCE_REQUIRED, NOTHING_REQUIRED ou a nova altura do nó.
+ */
+template <typename Key, typename Value, typename Compare>
+int ConcurrentAVL<Key, Value, Compare>::nodeCondition(Nodeptr node) const {
+    Nodeptr nL = node->left.load();
+    Nodeptr nR = node->right.load();
+
+    if ((!nL || !nR) && !node->value.load()) return UNLINK_REQUIRED;
+
+    int hN = node->height.load();
+    int hL0 = height(nL);
+    int hR0 = height(nR);
+    int hNRepl = 1 + std::max(hL0, hR0);
+    int bal = hL0 - hR0;
+
+    if (bal < -1 || bal > 1) return REBALANCE_REQUIRED;
+    return hN != hNRepl ? hNRepl : NOTHING_REQUIRED;
+}
+
+/**
+ * @brief Sobe a partir de node corrigindo alturas, rotacionando e desconectando nós de roteamento.
+ *
+ * Correções de altura travam só o nó; rotações e desconexões travam o pai e depois o nó.
+ * Uma rotação pode danificar mais de um nó: o mais profundo é reparado primeiro e os demais
+ * ficam em pending, de modo que nenhum dano causado por esta thread seja esquecido.
+ * Termina quando nada mais precisa ser feito.
+ */
+template <typename Key, typename Value, typename Compare>
+void ConcurrentAVL<Key, Value, Compare>::fixHeightAndRebalance(Nodeptr node) {
+    Pending pending;
+    while (true) {
+        if (!node || !node->parent.load()) { // nada a reparar aqui (ou sentinela alcançada)
+            if (pending.empty()) return;
+            node = pending.back();
+            pending.pop_back();
+            continue;
+        }
+
+        int condition = nodeCondition(node);
+        if (condition == NOTHING_REQUIRED || node->version.load() == NodeType::UNLINKED) {
+            node = nullptr;
+            continue;
+        }
+
+        if (condition != UNLINK_REQUIRED && condition != REBALANCE_REQUIRED) {
+            std::lock_guard<std::mutex> lock(node->lock);
+            node = fixHeight_nl(node);
+        } else {
+            Nodeptr nParent = node->parent.load();
+            std::lock_guard<std::mutex> parentLock(nParent->lock);
+            if (nParent->version.load() != NodeType::UNLINKED && node->parent.load() == nParent) {
+                std::lock_guard<std::mutex> lock(node->lock);
+                node = rebalance_nl(nParent, node, pending);
+            }
+            // Caso contrário, o pai mudou: tenta novamente
+        }
+    }
+}
+
+/**
+ * @brief Corrige a altura de um nó travado.
+ *
+ * @return Nodeptr Próximo nó a ser reparado (o pai, se a altura mudou), ou nullptr.
+ */
+template <typename Key, typename Value, typename Compare>
+typename ConcurrentAVL<Key, Value, Compare>::Nodeptr ConcurrentAVL<Key, Value, Compare>::fixHeight_nl(Nodeptr node) {
+    int condition = nodeCondition(node);
+    switch (condition) {
+        case REBALANCE_REQUIRED:
+        case UNLINK_REQUIRED:
+            return node; // não pode ser reparado só com a trava do nó
+        case NOTHING_REQUIRED:
+            return nullptr;
+        default:
+            node->height.store(condition);
+            return node->parent.load();
+    }
+}
+
+/**
+ * @brief Repara o nó n com n e o seu pai travados.
+ *
+ * @return Nodeptr Próximo nó danificado, ou nullptr se não há mais nada a fazer.
+ */
+template <typename Key, typename Value, typename Compare>
+typename ConcurrentAVL<Key, Value, Compare>::Nodeptr ConcurrentAVL<Key, Value, Compare>::rebalance_nl(Nodeptr nParent, Nodeptr n, Pending& pending) {
+    Nodeptr nL = n->left.load();
+    Nodeptr nR = n->right.load();
+
+    if ((!nL || !nR) && !n->value.load()) {
+        if (attemptUnlink_nl(nParent, n)) {
+            return fixHeight_nl(nParent);
+        }
+        return n;
+    }
+
+    int hN = n->height.load();
+    int hL0 = height(nL);
+    int hR0 = height(nR);
+    int hNRepl = 1 + std::max(hL0, hR0);
+    int bal = hL0 - hR0;
+
+    if (bal > 1) return rebalanceToRight_nl(nParent, n, nL, hR0, pending);
+    if (bal < -1) return rebalanceToLeft_nl(nParent, n, nR, hL0, pending);
+    if (hNRepl != hN) {
+        n->height.store(hNRepl);
+        return fixHeight_nl(nParent);
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Trata um nó pesado à esquerda: rotação simples à direita ou dupla (esquerda-direita).
+ *
+ * Trava o filho esquerdo (e o neto, se necessário) e confirma as alturas lidas antes de rotacionar.
+ */
+template <typename Key, typename Value, typename Compare>
+typename ConcurrentAVL<Key, Value, Compare>::Nodeptr
+ConcurrentAVL<Key, Value, Compare>::rebalanceToRight_nl(Nodeptr nParent, Nodeptr n, Nodeptr nL, int hR0, Pending& pending) {
+    std::lock_guard<std::mutex> leftLock(nL->lock);
+    int hL = nL->height.load();
+    if (hL - hR0 <= 1) return n; // alturas mudaram: tenta novamente
+
+    Nodeptr nLR = nL->right.load();
+    int hLL0 = height(nL->left.load());
+    int hLR0 = height(nLR);
+    if (hLL0 >= hLR0) {
+        return rotateRight_nl(nParent, n, nL, hR0, hLL0, nLR, hLR0, pending);
+    }
+
+    {
+        std::lock_guard<std::mutex> leftRightLock(nLR->lock);
+        int hLR = nLR->height.load();
+        if (hLL0 >= hLR) {
+            return rotateRight_nl(nParent, n, nL, hR0, hLL0, nLR, hLR, pending);
+        }
+
+        // A rotação dupla só é feita se nL não ficar desbalanceado depois dela
+        int hLRL = height(nLR->left.load());
+        int b = hLL0 - hLRL;
+        if (b >= -1 && b <= 1) {
+            return rotateRightOverLeft_nl(nParent, n, nL, hR0, hLL0, nLR, hLRL, pending);
+        }
+    }
+
+    // Corrige primeiro nL; n será rebalanceado depois, se preciso
+    return rebalanceToLeft_nl(n, nL, nLR, hLL0, pending);
+}
+
+/**
+ * @brief Trata um nó pesado à direita: rotação simples à esquerda ou dupla (direita-esquerda).
+ */
+template <typename Key, typename Value, typename Compare>
+typename ConcurrentAVL<Key, Value, Compare>::Nodeptr
+ConcurrentAVL<Key, Value, Compare>::rebalanceToLeft_nl(Nodeptr nParent, Nodeptr n, Nodeptr nR, int hL0, Pending& pending) {
+    std::lock_guard<std::mutex> rightLock(nR->lock);
+    int hR = nR->height.load();
+    if (hL0 - hR >= -1) return n; // alturas mudaram: tenta novamente
+
+    Nodeptr nRL = nR->left.load();
+    int hRL0 = height(nRL);
+    int hRR0 = height(nR->right.load());
+    if (hRR0 >= hRL0) {
+        return rotateLeft_nl(nParent, n, hL0, nR, nRL, hRL0, hRR0, pending);
+    }
+
+    {
+        std::lock_guard<std::mutex> rightLeftLock(nRL->lock);
+        int hRL = nRL->height.load();
+        if (hRR0 >= hRL) {
+            return rotateLeft_nl(nParent, n, hL0, nR, nRL, hRL, hRR0, pending);
+        }
+
+        int hRLR = height(nRL->right.load());
+        int b = hRR0 - hRLR;
+        if (b >= -1 && b <= 1) {
+            return rotateLeftOverRight_nl(nParent, n, hL0, nR, nRL, hRR0, hRLR, pending);
+        }
+    }
+
+    return rebalanceToRight_nl(n, nR, nRL, hRR0, pending);
+}
+
+/**
+ * @brief Rotação à direita em n, com nParent, n e nL travados.
+ *
+ * A versão de n (que desce) é marcada como SHRINKING durante a troca de ponteiros e incrementada ao
+ * final, forçando leitores que passaram por n a revalidar.
+ *
+ * @return Nodeptr O nó mais profundo que ainda precisa de reparo, ou nullptr.
+ */
+template <typename Key, typename Value, typename Compare>
+typename ConcurrentAVL<Key, Value, Compare>::Nodeptr
+ConcurrentAVL<Key, Value, Compare>::rotateRight_nl(Nodeptr nParent, Nodeptr n, Nodeptr nL, int hR, int hLL, Nodeptr nLR, int hLR, Pending& pending) {
+    rotations++; // Incrementa o contador de rotações
+
+    uint64_t nodeV = n->version.load();
+    Nodeptr nPL = nParent->left.load();
+
+    n->version.store(beginChange(nodeV));
+
+    n->left.store(nLR);
+    if (nLR) nLR->parent.store(n);
+
+    nL->right.store(n);
+    n->parent.store(nL);
+
+    if (nPL == n) nParent->left.store(nL);
+    else nParent->right.store(nL);
+    nL->parent.store(nParent);
+
+    int hNRepl = 1 + std::max(hLR, hR);
+    n->height.store(hNRepl);
+    nL->height.store(1 + std::max(hLL, hNRepl));
+
+    n->version.store(endChange(nodeV));
+
+    // nParent e nL também podem ter sido danificados; n, o mais profundo, é reparado primeiro
+    pending.push_back(nParent);
+    pending.push_back(nL);
+
+    // n pode continuar desbalanceado ou ter virado um nó de roteamento com um só filho
+    int balN = hLR - hR;
+    if (balN < -1 || balN > 1) return n;
+    if ((!nLR || hR == 0) && !n->value.load()) return n;
+
+    int balL = hLL - hNRepl;
+    if (balL < -1 || balL > 1) return nL;
+    if (hLL == 0 && !nL->value.load()) return nL;
+
+    return fixHeight_nl(nParent);
+}
+
+/**
+ * @brief Rotação à esquerda em n, com nParent, n e nR travados (simétrica a rotateRight_nl).
+ */
+template <typename Key, typename Value, typename Compare>
+typename ConcurrentAVL<Key, Value, Compare>::Nodeptr
+ConcurrentAVL<Key, Value, Compare>::rotateLeft_nl(Nodeptr nParent, Nodeptr n, int hL, Nodeptr nR, Nodeptr nRL, int hRL, int hRR, Pending& pending) {
+    rotations++; // Incrementa o contador de rotações
+
+    uint64_t nodeV = n->version.load();
+    Nodeptr nPL = nParent->left.load();
+
+    n->version.store(beginChange(nodeV));
+
+    n->right.store(nRL);
+    if (nRL) nRL->parent.store(n);
+
+    nR->left.store(n);
+    n->parent.store(nR);
+
+    if (nPL == n) nParent->left.store(nR);
+    else nParent->right.store(nR);
+    nR->parent.store(nParent);
+
+    int hNRepl = 1 + std::max(hL, hRL);
+    n->height.store(hNRepl);
+    nR->height.store(1 + std::max(hNRepl, hRR));
+
+    n->version.store(endChange(nodeV));
+
+    pending.push_back(nParent);
+    pending.push_back(nR);
+
+    int balN = hRL - hL;
+    if (balN < -1 || balN > 1) return n;
+    if ((!nRL || hL == 0) && !n->value.load()) return n;
+
+    int balR = hRR - hNRepl;
+    if (balR < -1 || balR > 1) return nR;
+    if (hRR == 0 && !nR->value.load()) return nR;
+
+    return fixHeight_nl(nParent);
+}
+
+/**
+ * @brief Rotação dupla (esquerda em nL, direita em n), com nParent, n, nL e nLR travados.
+ */
+template <typename Key, typename Value, typename Compare>
+typename ConcurrentAVL<Key, Value, Compare>::Nodeptr
+ConcurrentAVL<Key, Value, Compare>::rotateRightOverLeft_nl(Nodeptr nParent, Nodeptr n, Nodeptr nL, int hR, int hLL, Nodeptr nLR, int hLRL, Pending& pending) {
+    rotations += 2; // Rotação dupla conta como duas rotações
+
+    uint64_t nodeV = n->version.load();
+    uint64_t leftV = nL->version.load();
+
+    Nodeptr nPL = nParent->left.load();
+    Nodeptr nLRL = nLR->left.load();
+    Nodeptr nLRR = nLR->right.load();
+    int hLRR = height(nLRR);
+
+    n->version.store(beginChange(nodeV));
+    nL->version.store(beginChange(leftV));
+
+    n->left.store(nLRR);
+    if (nLRR) nLRR->parent.store(n);
+
+    nL->right.store(nLRL);
+    if (nLRL) nLRL->parent.store(nL);
+
+    nLR->left.store(nL);
+    nL->parent.store(nLR);
+    nLR->right.store(n);
+    n->parent.store(nLR);
+
+    if (nPL == n) nParent->left.store(nLR);
+    else nParent->right.store(nLR);
+    nLR->parent.store(nParent);
+
+    int hNRepl = 1 + std::max(hLRR, hR);
+    n->height.store(hNRepl);
+    int hLRepl = 1 + std::max(hLL, hLRL);
+    nL->height.store(hLRepl);
+    nLR->height.store(1 + std::max(hLRepl, hNRepl));
+
+    n->version.store(endChange(nodeV));
+    nL->version.store(endChange(leftV));
+
+    // Se nL é de roteamento e ficou com menos de dois filhos, ele é desconectado agora, enquanto
+    // nLR (seu novo pai) e nL ainda estão travados; deixá-lo para depois poderia perder o reparo de n.
+    if ((hLL == 0 || hLRL == 0) && !nL->value.load()) {
+        attemptUnlink_nl(nLR, nL);
+        hLRepl--;
+        nLR->height.store(1 + std::max(hLRepl, hNRepl));
+    }
+
+    pending.push_back(nParent);
+    pending.push_back(nLR);
+
+    int balN = hLRR - hR;
+    if (balN < -1 || balN > 1) return n;
+    if ((!nLRR || hR == 0) && !n->value.load()) return n;
+
+    int balLR = hLRepl - hNRepl;
+    if (balLR < -1 || balLR > 1) return nLR;
+
+    return fixHeight_nl(nParent);
+}
+
+/**
+ * @brief Rotação dupla (direita em nR, esquerda em n), com nParent, n, nR e nRL travados.
+ */
+template <typename Key, typename Value, typename Compare>
+typename ConcurrentAVL<Key, Value, Compare>::Nodeptr
+ConcurrentAVL<Key, Value, Compare>::rotateLeftOverRight_nl(Nodeptr nParent, Nodeptr n, int hL, Nodeptr nR, Nodeptr nRL, int hRR, int hRLR, Pending& pending) {
+    rotations += 2; // Rotação dupla conta como duas rotações
+
+    uint64_t nodeV = n->version.load();
+    uint64_t rightV = nR->version.load();
+
+    Nodeptr nPL = nParent->left.load();
+    Nodeptr nRLL = nRL->left.load();
+    Nodeptr nRLR = nRL->right.load();
+    int hRLL = height(nRLL);
+
+    n->version.store(beginChange(nodeV));
+    nR->version.store(beginChange(rightV));
+
+    n->right.store(nRLL);
+    if (nRLL) nRLL->parent.store(n);
+
+    nR->left.store(nRLR);
+    if (nRLR) nRLR->parent.store(nR);
+
+    nRL->right.store(nR);
+    nR->parent.store(nRL);
+    nRL->left.store(n);
+    n->parent.store(nRL);
+
+    if (nPL == n) nParent->left.store(nRL);
+    else nParent->right.store(nRL);
+    nRL->parent.store(nParent);
+
+    int hNRepl = 1 + std::max(hL, hRLL);
+    n->height.store(hNRepl);
+    int hRRepl = 1 + std::max(hRLR, hRR);
+    nR->height.store(hRRepl);
+    nRL->height.store(1 + std::max(hNRepl, hRRepl));
+
+    n->version.store(endChange(nodeV));
+    nR->version.store(endChange(rightV));
+
+    // Mesmo tratamento de rotateRightOverLeft_nl para nR de roteamento com menos de dois filhos
+    if ((hRR == 0 || hRLR == 0) && !nR->value.load()) {
+        attemptUnlink_nl(nRL, nR);
+        hRRepl--;
+        nRL->height.store(1 + std::max(hNRepl, hRRepl));
+    }
+
+    pending.push_back(nParent);
+    pending.push_back(nRL);
+
+    int balN = hRLL - hL;
+    if (balN < -1 || balN > 1) return n;
+    if ((!nRLL || hL == 0) && !n->value.load()) return n;
+
+    int balRL = hRRepl - hNRepl;
+    if (balRL < -1 || balRL > 1) return nRL;
+
+    return fixHeight_nl(nParent);
+}
+
+/**
+ * @brief Desconecta um nó de roteamento com no máximo um filho, com parent e node travados.
+ *
+ * @return bool false se node deixou de ser filho de parent ou passou a ter dois filhos.
+ */
+template <typename Key, typename Value, typename Compare>
+bool ConcurrentAVL<Key, Value, Compare>::attemptUnlink_nl(Nodeptr parent, Nodeptr node) {
+    Nodeptr parentL = parent->left.load();
+    Nodeptr parentR = parent->right.load();
+    if (parentL != node && parentR != node) return false;
+
+    Nodeptr left = node->left.load();
+    Nodeptr right = node->right.load();
+    if (left && right) return false;
+
+    Nodeptr splice = left ? left : right;
+    if (parentL == node) parent->left.store(splice);
+    else parent->right.store(splice);
+    if (splice) splice->parent.store(parent);
+
+    node->version.store(NodeType::UNLINKED);
+    retireNode(node);
+    return true;
+}
+
+//------------- Memória e percursos --------------
+
+/**
+ * @brief Agenda a liberação de um nó já desconectado (leitores podem ainda estar nele).
+ */
+template <typename Key, typename Value, typename Compare>
+void ConcurrentAVL<Key, Value, Compare>::retireNode(Nodeptr node) {
+    m_epoch.retire([node]() { delete node; });
+}
+
+/**
+ * @brief Agenda a liberação de um valor substituído ou removido.
+ */
+template <typename Key, typename Value, typename Compare>
+void ConcurrentAVL<Key, Value, Compare>::retireValue(Value* value) {
+    m_epoch.retire([value]() { delete value; });
+}
+
+/**
+ * @brief Libera recursivamente os nós ainda conectados (usado apenas pelo destrutor).
+ */
+template <typename Key, typename Value, typename Compare>
+void ConcurrentAVL<Key, Value, Compare>::destroy(Nodeptr node) {
+    if (!node) return;
+    destroy(node->left.load());
+    destroy(node->right.load());
+    delete node->value.load();
+    delete node;
+}
+
+/**
+ * @brief Percurso in-ordem auxiliar usado por get_all_keys_sorted() (ignora nós de roteamento).
+ */
+template <typename Key, typename Value, typename Compare>
+void ConcurrentAVL<Key, Value, Compare>::in_Order_vec(Nodeptr node, std::vector<Key>& keys_vec) const {
+    if (!node) return;
+
+    in_Order_vec(node->left.load(), keys_vec);
+    if (node->value.load()) keys_vec.push_back(node->key);
+    in_Order_vec(node->right.load(), keys_vec);
+}
+
+/**
+ * @brief Verifica recursivamente ordem, ponteiros para o pai, alturas e balanceamento.
+ *
+ * @return int Altura da subárvore, ou -1 se alguma propriedade for violada.
+ */
+template <typename Key, typename Value, typename Compare>
+int ConcurrentAVL<Key, Value, Compare>::validate(Nodeptr node, Nodeptr parent, const Key* low, const Key* high) const {
+    if (!node) return 0;
+
+    if (node->parent.load() != parent) return -1;
+    if ((low && m_compare(node->key, *low) <= 0) || (high && m_compare(node->key, *high) >= 0)) return -1;
+    if (canUnlink(node) && !node->value.load()) return -1; // roteamento com menos de dois filhos
+
+    int hL = validate(node->left.load(), node, low, &node->key);
+    int hR = validate(node->right.load(), node, &node->key, high);
+    if (hL < 0 || hR < 0 || hL - hR < -1 || hL - hR > 1) return -1;
+
+    int h = 1 + std::max(hL, hR);
+    return node->height.load() == h ? h : -1;
+}
+
+//------------- Interface pública --------------
+
+/**
+ * @brief Insere um novo par chave-valor ou atualiza o valor de uma chave existente.
+ */
+template <typename Key, typename Value, typename Compare>
+void ConcurrentAVL<Key, Value, Compare>::add(const Key& key, const Value& value) {
+    EpochGuard guard(m_epoch);
+    while (attemptPut(key, value, &rootHolder, 1, 0) == Status::RETRY) {}
+}
+
+/**
+ * @brief Remove a chave da árvore, se ela existir.
+ */
+template <typename Key, typename Value, typename Compare>
+void ConcurrentAVL<Key, Value, Compare>::remove(const Key& key) {
+    EpochGuard guard(m_epoch);
+    while (attemptRemove(key, &rootHolder, 1, 0) == Status::RETRY) {}
+}
+
+/**
+ * @brief Busca a chave sem travas.
+ *
+ * @param key Chave buscada.
+ * @param out Recebe uma cópia do valor, se a chave existir.
+ * @return bool true se a chave foi encontrada.
+ */
+template <typename Key, typename Value, typename Compare>
+bool ConcurrentAVL<Key, Value, Compare>::find(const Key& key, Value& out) const {
+    EpochGuard guard(m_epoch);
+    Status status;
+    while ((status = attemptGet(key, &rootHolder, 1, 0, out)) == Status::RETRY) {}
+    return status == Status::FOUND;
+}
+
+template <typename Key, typename Value, typename Compare>
+bool ConcurrentAVL<Key, Value, Compare>::contains(const Key& key) const {
+    Value ignored{};
+    return find(key, ignored);
+}
+
+/**
+ * @brief Retorna uma cópia do valor associado à chave.
+ *
+ * @throws std::runtime_error Se a chave não for encontrada na árvore.
+ */
+template <typename Key, typename Value, typename Compare>
+Value ConcurrentAVL<Key, Value, Compare>::get(const Key& key) const {
+    Value value{};
+    if (!find(key, value)) {
+        throw std::runtime_error("Chave não encontrada");
+    }
+    return value;
+}
+
+template <typename Key, typename Value, typename Compare>
+bool ConcurrentAVL<Key, Value, Compare>::isEmpty() const {
+    return nodeCount.load() == 0;
+}
+
+template <typename Key, typename Value, typename Compare>
+size_t ConcurrentAVL<Key, Value, Compare>::size() const {
+    return static_cast<size_t>(nodeCount.load());
+}
+
+/**
+ * @brief Retorna todas as chaves em ordem crescente.
+ *
+ * O percurso é seguro durante escritas concorrentes, mas só é uma fotografia exata da árvore
+ * quando não há escritores ativos.
+ */
+template <typename Key, typename Value, typename Compare>
+std::vector<Key> ConcurrentAVL<Key, Value, Compare>::get_all_keys_sorted() const {
+    EpochGuard guard(m_epoch);
+    std::vector<Key> keys_vec;
+    keys_vec.reserve(size());
+    in_Order_vec(rootHolder.right.load(), keys_vec);
+    return keys_vec;
+}
+
+/**
+ * @brief Verifica se, sem escritores ativos, a árvore é uma AVL válida.
+ *
+ * Checa a ordem das chaves, os ponteiros para o pai, as alturas armazenadas, o fator de
+ * balanceamento e a ausência de nós de roteamento com menos de dois filhos.
+ */
+template <typename Key, typename Value, typename Compare>
+bool ConcurrentAVL<Key, Value, Compare>::validate() const {
+    EpochGuard guard(m_epoch);
+    return validate(rootHolder.right.load(), &rootHolder, nullptr, nullptr) >= 0;
+}
+
+template <typename Key, typename Value, typename Compare>
+long long ConcurrentAVL<Key, Value, Compare>::get_rotations() const {
+    return rotations.load(); // Retorna o número de rotações realizadas
+}
+
+/**
+ * @brief Retorna quantos nós e valores removidos já foram liberados pelas épocas.
+ */
+template <typename Key, typename Value, typename Compare>
+long long ConcurrentAVL<Key, Value, Compare>::get_reclaimed() const {
+    return m_epoch.get_reclaimed();
+}
+
+#endif
@@ -0,0 +1,573 @@
+#ifndef PERSISTENT_AVL_HPP
+#define PERSISTENT_AVL_HPP
+
+#include <iostream>
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+#include "PersistentNode.hpp"
+#include "../Dictionaty/IDictionary.hpp"
+#include "../utils/threeWayCompare.hpp"
+
+/**
+ * @brief Versão imutável de uma PersistentAVL, obtida em O(1) por PersistentAVL::snapshot().
+ *
+ * O snapshot guarda apenas a raiz da versão e o seu tamanho. Como nenhum nó alcançável a partir
+ * dessa raiz volta a ser modificado, qualquer thread pode percorrê-lo sem bloqueios enquanto a
+ * thread de ingestão continua alterando a árvore. Os nós são liberados por contagem de referências
+ * quando o último snapshot (ou a própria árvore) deixa de referenciá-los.
+ *
+ * @tparam Key Tipo da chave.
+ * @tparam Value Tipo do valor.
+ * @tparam Compare Política de comparação em três vias (padrão: ThreeWayCompare<Key>).
+ */
+template <typename Key, typename Value, typename Compare = ThreeWayCompare<Key>>
+class AVLSnapshot {
+private:
+    using Nodeptr = std::shared_ptr<const PersistentNode<Key, Value>>;
+
+    Nodeptr root;
+    size_t nodeCount = 0;
+    Compare m_compare;
+
+    const PersistentNode<Key, Value>* findNode(const Key& key) const;
+    void in_Order_vec(const PersistentNode<Key, Value>* node, std::vector<Key>& keys_vec) const;
+
+public:
+    AVLSnapshot() = default;
+    AVLSnapshot(Nodeptr root, size_t nodeCount) : root(std::move(root)), nodeCount(nodeCount) {}
+
+    bool isEmpty() const { return nodeCount == 0; }
+    size_t size() const { return nodeCount; }
+    bool contains(const Key& key) const;
+    const Value& get(const Key& key) const;
+    std::vector<Key> get_all_keys_sorted() const;
+};
+
+/**
+ * @brief Árvore AVL persistente por cópia de caminho (path copying).
+ *
+ * Funciona como a AVL comum, mas cada add/remove que alcança um nó pertencente a algum snapshot
+ * copia esse nó em vez de alterá-lo. Assim, apenas o caminho O(log n) da raiz até o ponto
+ * modificado (e os nós envolvidos em rotações) é duplicado, e snapshot() devolve uma versão
+ * imutável em O(1).
+ *
+ * Cada nó guarda a geração em que foi criado; snapshot() avança a geração. Nós da geração corrente
+ * ainda não foram publicados e são alterados no lugar, de modo que entre dois snapshots a árvore
+ * se comporta como uma AVL comum, sem cópias.
+ *
+ * @note add, remove e snapshot devem ser chamados pela mesma thread (a de ingestão). Os snapshots
+ *       devolvidos podem ser lidos por qualquer número de threads.
+ *
+ * @tparam Key Tipo da chave utilizada para ordenação dos nós na árvore.
+ * @tparam Value Tipo do valor associado a cada chave armazenada na árvore.
+ * @tparam Compare Política de comparação em três vias (padrão: ThreeWayCompare<Key>).
+ */
+template <typename Key, typename Value, typename Compare = ThreeWayCompare<Key>>
+class PersistentAVL : public IDictionary<Key, Value> {
+private:
+    using Nodeptr = typename PersistentNode<Key, Value>::Nodeptr;
+
+    Nodeptr root;
+
+    int nodeCount = 0; // Contador de nós
+    unsigned long long generation = 0; // Geração corrente (avança a cada snapshot)
+    mutable long long comparisons = 0; // Contador de comparações
+    long long rotations = 0; // Contador de rotações
+    long long copies = 0; // Contador de nós copiados por pertencerem a um snapshot
+    Compare m_compare; // Comparação em três vias das chaves
+
+    // Funções auxiliares
+    Nodeptr own(const Nodeptr& node);
+    const PersistentNode<Key, Value>* minValueNode(const PersistentNode<Key, Value>* node);
+    Nodeptr _remove(const Nodeptr& node, const Key& key);
+    Nodeptr _insert(const Nodeptr& node, const Key& key, const Value& value_to_add);
+    Nodeptr leftRotate(Nodeptr node);
+    Nodeptr rightRotate(Nodeptr node);
+    Nodeptr rebalance(Nodeptr node);
+    const PersistentNode<Key, Value>* findNode(const Key& key) const;
+    int height(const Nodeptr& node);
+    int getBalance(const Nodeptr& node);
+    void in_Order_vec(const PersistentNode<Key, Value>* node, std::vector<Key>& keys_vec) const;
+
+public:
+    PersistentAVL() : root(nullptr), nodeCount(0), generation(0), comparisons(0), rotations(0), copies(0) {}
+
+    void clear();
+    AVLSnapshot<Key, Value, Compare> snapshot();
+    void add(const Key& key, const Value& value_to_add) override;
+    void remove(const Key& key) override;
+    bool isEmpty() const override;
+    bool contains(const Key& key) const override;
+    size_t size() const override;
+    const Value& get(const Key& key) const override;
+
+    std::vector<Key> get_all_keys_sorted() const override;
+
+    // Funções para obter métricas
+    long long get_comparisons() const override;
+    long long get_rotations() const override;
+    long long get_colors() const override;
+    long long get_collisions() const override;
+    size_t get_node_bytes() const override;
+    long long get_rehashes() const override;
+    void reserve(size_t n) override;
+    long long get_copies() const;
+};
+
+//------------- Implementação do Snapshot --------------
+
+/**
+ * @brief Procura iterativamente o nó com a chave fornecida na versão congelada.
+ *
+ * @param key Chave a ser buscada.
+ * @return Ponteiro para o nó encontrado ou nullptr se a chave não existir nesta versão.
+ */
+template <typename Key, typename Value, typename Compare>
+const PersistentNode<Key, Value>* AVLSnapshot<Key, Value, Compare>::findNode(const Key& key) const {
+    const PersistentNode<Key, Value>* node = root.get();
+    while (node) {
+        int cmp = m_compare(key, node->data.first);
+        if (cmp < 0) {
+            node = node->left.get();
+        } else if (cmp > 0) {
+            node = node->right.get();
+        } else {
+            return node;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Verifica se a chave está presente nesta versão da árvore.
+ */
+template <typename Key, typename Value, typename Compare>
+bool AVLSnapshot<Key, Value, Compare>::contains(const Key& key) const {
+    return findNode(key) != nullptr;
+}
+
+/**
+ * @brief Retorna o valor associado à chave nesta versão da árvore.
+ *
+ * @throws std::runtime_error Se a chave não existir no snapshot.
+ */
+template <typename Key, typename Value, typename Compare>
+const Value& AVLSnapshot<Key, Value, Compare>::get(const Key& key) const {
+    const PersistentNode<Key, Value>* node = findNode(key);
+    if (!node) {
+        throw std::runtime_error("Chave não encontrada no snapshot");
+    }
+    return node->data.second;
+}
+
+/**
+ * @brief Percurso in-ordem auxiliar usado por get_all_keys_sorted().
+ */
+template <typename Key, typename Value, typename Compare>
+void AVLSnapshot<Key, Value, Compare>::in_Order_vec(const PersistentNode<Key, Value>* node, std::vector<Key>& keys_vec) const {
+    if (!node) return;
+
+    in_Order_vec(node->left.get(), keys_vec);
+    keys_vec.push_back(node->data.first);
+    in_Order_vec(node->right.get(), keys_vec);
+}
+
+/**
+ * @brief Retorna todas as chaves do snapshot em ordem crescente.
+ */
+template <typename Key, typename Value, typename Compare>
+std::vector<Key> AVLSnapshot<Key, Value, Compare>::get_all_keys_sorted() const {
+    std::vector<Key> keys_vec;
+    keys_vec.reserve(nodeCount);
+    in_Order_vec(root.get(), keys_vec);
+    return keys_vec;
+}
+
+//------------- Implementação da PersistentAVL --------------
+
+/**
+ * @brief Garante que o nó pode ser alterado sem afetar nenhum snapshot.
+ *
+ * Se o nó foi criado na geração corrente, ele ainda não foi publicado e é devolvido como está.
+ * Caso contrário, ele pertence a pelo menos um snapshot e uma cópia rasa (que compartilha os
+ * mesmos filhos) é criada na geração corrente.
+ *
+ * @param node Nó a ser reivindicado pela versão corrente.
+ * @return Nodeptr Nó que pode ser modificado no lugar.
+ */
+template <typename Key, typename Value, typename Compare>
+typename PersistentAVL<Key, Value, Compare>::Nodeptr PersistentAVL<Key, Value, Compare>::own(const Nodeptr& node) {
+    if (!node || node->generation == generation) {
+        return node;
+    }
+    copies++; // Incrementa o contador de cópias
+    return std::make_shared<PersistentNode<Key, Value>>(node->data, node->height, generation, node->left, node->right);
+}
+
+/**
+ * @brief Procura iterativamente por um nó com a chave fornecida na versão corrente.
+ *
+ * @param key Chave a ser buscada na árvore.
+ * @return Ponteiro para o nó encontrado ou nullptr se não existir.
+ */
+template <typename Key, typename Value, typename Compare>
+const PersistentNode<Key, Value>* PersistentAVL<Key, Value, Compare>::findNode(const Key& key) const {
+    const PersistentNode<Key, Value>* node = root.get();
+    while (node) {
+        comparisons++; // Incrementa o contador de comparações
+        int cmp = m_compare(key, node->data.first);
+        if (cmp < 0) {
+            node = node->left.get();
+        } else if (cmp > 0) {
+            node = node->right.get();
+        } else {
+            return node;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Retorna a altura de um nó, ou 0 se ele for nulo.
+ */
+template <typename Key, typename Value, typename Compare>
+int PersistentAVL<Key, Value, Compare>::height(const Nodeptr& node) {
+    return node ? node->height : 0;
+}
+
+/**
+ * @brief Calcula o fator de balanceamento (altura direita - altura esquerda) de um nó.
+ */
+template <typename Key, typename Value, typename Compare>
+int PersistentAVL<Key, Value, Compare>::getBalance(const Nodeptr& node) {
+    return node ? height(node->right) - height(node->left) : 0;
+}
+
+/**
+ * @brief Realiza uma rotação para a esquerda, copiando o filho direito se ele pertencer a um snapshot.
+ *
+ * @param node Nó (já pertencente à versão corrente) onde a rotação será realizada.
+ * @return Nodeptr Novo nó raiz da subárvore após a rotação.
+ */
+template <typename Key, typename Value, typename Compare>
+typename PersistentAVL<Key, Value, Compare>::Nodeptr PersistentAVL<Key, Value, Compare>::leftRotate(Nodeptr node) {
+    rotations++; // Incrementa o contador de rotações
+
+    Nodeptr u = own(node->right);
+    node->right = u->left;
+    u->left = node;
+
+    node->height = 1 + std::max(height(node->left), height(node->right));
+    u->height = 1 + std::max(height(u->left), height(u->right));
+
+    return u;
+}
+
+/**
+ * @brief Realiza uma rotação para a direita, copiando o filho esquerdo se ele pertencer a um snapshot.
+ *
+ * @param node Nó (já pertencente à versão corrente) onde a rotação será realizada.
+ * @return Nodeptr Novo nó raiz da subárvore após a rotação.
+ */
+template <typename Key, typename Value, typename Compare>
+typename PersistentAVL<Key, Value, Compare>::Nodeptr PersistentAVL<Key, Value, Compare>::rightRotate(Nodeptr node) {
+    rotations++; // Incrementa o contador de rotações
+
+    Nodeptr u = own(node->left);
+    node->left = u->right;
+    u->right = node;
+
+    node->height = 1 + std::max(height(node->left), height(node->right));
+    u->height = 1 + std::max(height(u->left), height(u->right));
+
+    return u;
+}
+
+/**
+ * @brief Atualiza a altura do nó e aplica as rotações AVL necessárias.
+ *
+ * Os casos são os mesmos da AVL comum. Filhos que precisam ser rotacionados são
+ * reivindicados com own() antes de serem alterados.
+ *
+ * @param node Nó (já pertencente à versão corrente) a ser rebalanceado.
+ * @return Nodeptr Raiz da subárvore após o rebalanceamento.
+ */
+template <typename Key, typename Value, typename Compare>
+typename PersistentAVL<Key, Value, Compare>::Nodeptr PersistentAVL<Key, Value, Compare>::rebalance(Nodeptr node) {
+    node->height = 1 + std::max(height(node->left), height(node->right));
+
+    int bal = getBalance(node);
+
+    // Caso Esquerda-Esquerda
+    if (bal < -1 && getBalance(node->left) <= 0)
+        return rightRotate(node);
+    // Caso Esquerda-Direita
+    if (bal < -1 && getBalance(node->left) > 0) {
+        node->left = leftRotate(own(node->left));
+        return rightRotate(node);
+    }
+    // Caso Direita-Direita
+    if (bal > 1 && getBalance(node->right) >= 0)
+        return leftRotate(node);
+    // Caso Direita-Esquerda
+    if (bal > 1 && getBalance(node->right) < 0) {
+        node->right = rightRotate(own(node->right));
+        return leftRotate(node);
+    }
+
+    return node;
+}
+
+/**
+ * @brief Retorna o nó com a menor chave da subárvore.
+ */
+template <typename Key, typename Value, typename Compare>
+const PersistentNode<Key, Value>* PersistentAVL<Key, Value, Compare>::minValueNode(const PersistentNode<Key, Value>* node) {
+    while (node && node->left) {
+        node = node->left.get();
+    }
+    return node;
+}
+
+/**
+ * @brief Insere (ou atualiza) uma chave copiando apenas o caminho até ela.
+ *
+ * Cada nó visitado é reivindicado com own(): se pertence a um snapshot, é copiado; caso contrário,
+ * é alterado no lugar. Os contadores de comparações seguem o mesmo critério da AVL comum.
+ *
+ * @param subtree Raiz da subárvore atual.
+ * @param key Chave a ser inserida ou atualizada.
+ * @param value_to_add Valor a ser associado à chave.
+ * @return Nodeptr Raiz da subárvore na versão corrente.
+ */
+template <typename Key, typename Value, typename Compare>
+typename PersistentAVL<Key, Value, Compare>::Nodeptr PersistentAVL<Key, Value, Compare>::_insert(const Nodeptr& subtree, const Key& key, const Value& value_to_add) {
+    if (!subtree) {
+        nodeCount++; // Incrementa o contador de nós
+        return std::make_shared<PersistentNode<Key, Value>>(std::make_pair(key, value_to_add), 1, generation);
+    }
+
+    Nodeptr node = own(subtree);
+
+    comparisons++; // Incrementa o contador de comparações
+    int cmp = m_compare(key, node->data.first);
+    if (cmp < 0) {
+        node->left = _insert(node->left, key, value_to_add);
+    }
+    else if (cmp > 0) {
+        node->right = _insert(node->right, key, value_to_add);
+    }
+    else {
+        node->data.second = value_to_add; // Atualiza o valor se a chave já existir
+        return node;
+    }
+
+    return rebalance(node);
+}
+
+/**
+ * @brief Remove uma chave copiando apenas o caminho até ela.
+ *
+ * Segue o algoritmo da AVL comum (substituição pelo sucessor quando o nó tem dois filhos).
+ * Nós removidos não são apagados aqui: eles continuam vivos enquanto algum snapshot os referenciar.
+ *
+ * @param subtree Raiz da subárvore atual.
+ * @param key Chave a ser removida.
+ * @return Nodeptr Raiz da subárvore na versão corrente.
+ */
+template <typename Key, typename Value, typename Compare>
+typename PersistentAVL<Key, Value, Compare>::Nodeptr PersistentAVL<Key, Value, Compare>::_remove(const Nodeptr& subtree, const Key& key) {
+    if (!subtree) {
+        return subtree;
+    }
+
+    Nodeptr node;
+    comparisons++; // Incrementa o contador de comparações
+    int cmp = m_compare(key, subtree->data.first);
+    if (cmp < 0) {
+        int before = nodeCount;
+        Nodeptr left = _remove(subtree->left, key);
+        if (nodeCount == before) return subtree; // Chave ausente: nada mudou nesta subárvore
+        node = own(subtree);
+        node->left = std::move(left);
+    }
+    else if (cmp > 0) {
+        int before = nodeCount;
+        Nodeptr right = _remove(subtree->right, key);
+        if (nodeCount == before) return subtree; // Chave ausente: nada mudou nesta subárvore
+        node = own(subtree);
+        node->right = std::move(right);
+    }
+    else {
+        if (!subtree->left || !subtree->right) {
+            nodeCount--; // Decrementa o contador de nós
+            return subtree->left ? subtree->left : subtree->right;
+        }
+        const PersistentNode<Key, Value>* temp = minValueNode(subtree->right.get());
+        node = own(subtree);
+        node->data = temp->data;
+        node->right = _remove(node->right, node->data.first);
+    }
+
+    return rebalance(node);
+}
+
+/**
+ * @brief Retorna uma versão imutável da árvore em O(1).
+ *
+ * A raiz corrente passa a ser compartilhada com o snapshot e a geração avança, de forma que
+ * qualquer alteração posterior copie os nós afetados em vez de modificá-los.
+ *
+ * @return AVLSnapshot<Key, Value, Compare> Versão congelada da árvore.
+ */
+template <typename Key, typename Value, typename Compare>
+AVLSnapshot<Key, Value, Compare> PersistentAVL<Key, Value, Compare>::snapshot() {
+    generation++;
+    return AVLSnapshot<Key, Value, Compare>(root, nodeCount);
+}
+
+/**
+ * @brief Remove todos os elementos da versão corrente e reseta os contadores.
+ *
+ * Snapshots obtidos anteriormente continuam válidos.
+ */
+template <typename Key, typename Value, typename Compare>
+void PersistentAVL<Key, Value, Compare>::clear() {
+    root = nullptr;
+    nodeCount = 0; // Reseta o contador de nós
+    comparisons = 0; // Reseta o contador de comparações
+    rotations = 0; // Reseta o contador de rotações
+    copies = 0; // Reseta o contador de cópias
+}
+
+/**
+ * @brief Insere um novo par chave-valor na versão corrente da árvore.
+ */
+template <typename Key, typename Value, typename Compare>
+void PersistentAVL<Key, Value, Compare>::add(const Key& key, const Value& value_to_add) {
+    root = _insert(root, key, value_to_add);
+}
+
+/**
+ * @brief Remove a chave da versão corrente da árvore, se ela existir.
+ */
+template <typename Key, typename Value, typename Compare>
+void PersistentAVL<Key, Value, Compare>::remove(const Key& key) {
+    root = _remove(root, key);
+}
+
+/**
+ * @brief Percurso in-ordem auxiliar usado por get_all_keys_sorted().
+ */
+template <typename Key, typename Value, typename Compare>
+void PersistentAVL<Key, Value, Compare>::in_Order_vec(const PersistentNode<Key, Value>* node, std::vector<Key>& keys_vec) const {
+    if (!node) return;
+
+    in_Order_vec(node->left.get(), keys_vec);
+    keys_vec.push_back(node->data.first);
+    in_Order_vec(node->right.get(), keys_vec);
+}
+
+/**
+ * @brief Retorna todas as chaves da versão corrente em ordem crescente.
+ */
+template <typename Key, typename Value, typename Compare>
+std::vector<Key> PersistentAVL<Key, Value, Compare>::get_all_keys_sorted() const {
+    std::vector<Key> keys_vec;
+    if (this->isEmpty()) {
+        return {};
+    }
+
+    keys_vec.reserve(this->size());
+    in_Order_vec(root.get(), keys_vec);
+
+    return keys_vec;
+}
+
+/**
+ * @brief Retorna o valor associado à chave na versão corrente.
+ *
+ * @throws std::runtime_error Se a chave não for encontrada na árvore.
+ */
+template <typename Key, typename Value, typename Compare>
+const Value& PersistentAVL<Key, Value, Compare>::get(const Key& key) const {
+    const PersistentNode<Key, Value>* node = findNode(key);
+
+    if (node) {
+        return node->data.second; // Retorna o valor associado à chave
+    } else {
+        throw std::runtime_error("Chave não encontrada");
+    }
+}
+
+/**
+ * @brief Verifica se a chave está presente na versão corrente.
+ */
+template <typename Key, typename Value, typename Compare>
+bool PersistentAVL<Key, Value, Compare>::contains(const Key& key) const {
+    return findNode(key) != nullptr;
+}
+
+template <typename Key, typename Value, typename Compare>
+size_t PersistentAVL<Key, Value, Compare>::size() const {
+    return nodeCount; // Retorna o número de nós na versão corrente
+}
+
+template <typename Key, typename Value, typename Compare>
+bool PersistentAVL<Key, Value, Compare>::isEmpty() const {
+    return nodeCount == 0;
+}
+
+template <typename Key, typename Value, typename Compare>
+long long PersistentAVL<Key, Value, Compare>::get_comparisons() const {
+    return comparisons; // Retorna o número de comparações realizadas
+}
+
+template <typename Key, typename Value, typename Compare>
+long long PersistentAVL<Key, Value, Compare>::get_rotations() const {
+    return rotations; // Retorna o número de rotações realizadas
+}
+
+template <typename Key, typename Value, typename Compare>
+long long PersistentAVL<Key, Value, Compare>::get_colors() const {
+    return 0; // Retorna 0, pois AVL não utiliza cores como RB-Tree
+}
+
+template <typename Key, typename Value, typename Compare>
+long long PersistentAVL<Key, Value, Compare>::get_collisions() const {
+    return 0; // Retorna 0, pois AVL não possui colisões
+}
+
+/**
+ * @brief Retorna o tamanho em bytes de cada nó, incluindo o bloco de controle do shared_ptr (dois contadores).
+ */
+template <typename Key, typename Value, typename Compare>
+size_t PersistentAVL<Key, Value, Compare>::get_node_bytes() const {
+    return sizeof(PersistentNode<Key, Value>) + 2 * sizeof(long) + sizeof(void*);
+}
+
+template <typename Key, typename Value, typename Compare>
+long long PersistentAVL<Key, Value, Compare>::get_rehashes() const {
+    return 0; // Retorna 0, pois uma árvore não é redimensionada
+}
+
+/**
+ * @brief Sem efeito: cada nó é um shared_ptr com o seu próprio bloco de controle e pode sobreviver à
+ * árvore dentro de um snapshot, então não há um pool que possa ser alocado antecipadamente.
+ */
+template <typename Key, typename Value, typename Compare>
+void PersistentAVL<Key, Value, Compare>::reserve(size_t) {}
+
+/**
+ * @brief Retorna o número de nós copiados por pertencerem a algum snapshot.
+ *
+ * Mede o custo real da persistência: sem snapshots, o valor permanece zero.
+ */
+template <typename Key, typename Value, typename Compare>
+long long PersistentAVL<Key, Value, Compare>::get_copies() const {
+    return copies;
+}
+
+#endif
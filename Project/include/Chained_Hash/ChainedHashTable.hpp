@@ -5,6 +5,8 @@
 #include <cmath>
 #include <string>
 #include <list>
+#include <set>
+#include <memory>
 #include <vector>
 #include <utility>
 #include <functional>
@@ -12,8 +14,27 @@
 #include <locale>
 
 #include "../Dictionaty/IDictionary.hpp"
+#include "../utils/sizingPolicy.hpp"
+#include "../utils/threeWayCompare.hpp"
 
-template <typename Key, typename Value, typename Hash = std::hash<Key>>
+/**
+ * @brief Tabela hash com encadeamento separado (uma std::list por slot).
+ *
+ * Slots cuja lista passa de m_treeify_threshold entradas sao "arborizados", como no HashMap do Java:
+ * a lista continua guardando as entradas, mas ganha um indice em arvore rubro-negra (std::set de
+ * iteradores da lista, ordenado pelo hash guardado e depois pela chave). Buscas, insercoes e remocoes
+ * nesse slot custam O(log n) em vez de O(n), o que protege a tabela de entradas adversarias ou de um
+ * hash fraco que concentre muitas chaves no mesmo slot. Abaixo de 3/4 do limite o indice eh descartado.
+ * A chave precisa de ordem (operador < ou compare), o que get_all_keys_sorted ja exigia.
+ *
+ * @tparam Key Tipo da chave.
+ * @tparam Value Tipo do valor.
+ * @tparam Hash Functor de hash utilizado para calcular o codigo hash das chaves.
+ * @tparam Sizing Politica de dimensionamento (ver sizingPolicy.hpp): escolhe o numero de slots e
+ *         reduz o codigo hash a um slot. O padrao reproduz o comportamento original: proximo primo
+ *         por divisao por tentativa e h % primo.
+ */
+template <typename Key, typename Value, typename Hash = std::hash<Key>, typename Sizing = TrialDivisionPrimeSizing>
 class ChainedHashTable : public IDictionary<Key, Value>{
 private:
     // quantidade de pares (chave,valor)
@@ -22,8 +43,14 @@ private:
     // tamanho atual da tabela
     size_t m_table_size;
 
+    // politica de dimensionamento da tabela atual (e da antiga, durante um rehash incremental)
+    Sizing m_sizing;
+    Sizing m_old_sizing;
+
     mutable long long comparisons = 0; // contador de comparacoes, usado para analise de desempenho
     mutable long long collisions = 0;  // contador de colisões, usado para analise de desempenho
+    mutable long long skipped = 0;     // comparacoes de chave evitadas porque o hash guardado ja era diferente
+    long long rehashes = 0;            // quantidade de redimensionamentos da tabela
 
     // O maior valor que o fator de carga pode ter.
     // Seja load_factor = m_number_of_elements/m_table_size.
@@ -32,16 +59,84 @@ private:
     // eh preciso executar a operacao de rehashing.
     float m_max_load_factor;
 
+    // Entrada de uma lista: o par e o hash completo da chave, calculado uma unica vez na insercao.
+    // Nas buscas o hash guardado eh comparado antes da chave, e o rehash o reutiliza.
+    struct Entry {
+        std::pair<Key, Value> data;
+        size_t hash;
+    };
+
+    using Chain = std::list<Entry>;
+    using ChainIt = typename Chain::iterator;
+
+    // Chave procurada num slot arborizado. Carrega os contadores da tabela, entao o comparador nao
+    // guarda estado e cada no visitado conta uma comparacao, como cada entrada visitada na lista.
+    struct Probe {
+        const Key *key;
+        size_t hash;
+        long long *comparisons;
+        long long *skipped;
+    };
+
+    // Ordem do indice: hash guardado e, entre hashes iguais, a chave. Hashes diferentes decidem
+    // sem comparar chaves (contados em skipped, como em matches()).
+    struct TreeOrder {
+        using is_transparent = void;
+
+        static int order(const Entry &e, const Probe &p) {
+            (*p.comparisons)++;
+            if (e.hash != p.hash) {
+                (*p.skipped)++;
+                return e.hash < p.hash ? -1 : 1;
+            }
+            return ThreeWayCompare<Key>{}(e.data.first, *p.key);
+        }
+
+        bool operator()(ChainIt a, ChainIt b) const {
+            return a->hash != b->hash ? a->hash < b->hash : ThreeWayCompare<Key>{}(a->data.first, b->data.first) < 0;
+        }
+        bool operator()(ChainIt a, const Probe &p) const { return order(*a, p) < 0; }
+        bool operator()(const Probe &p, ChainIt a) const { return order(*a, p) > 0; }
+    };
+
+    using Tree = std::set<ChainIt, TreeOrder>;
+
+    // Slot: a lista de entradas e, se o slot estiver arborizado, o indice em arvore sobre ela.
+    // O splice do rehash mantem os iteradores validos, entao o indice sobrevive a migracao dos nos.
+    struct Bucket {
+        Chain chain;
+        std::unique_ptr<Tree> tree;
+    };
+
+    // Limites de arborizacao: acima de m_treeify_threshold entradas o slot ganha o indice; abaixo de
+    // m_untreeify_threshold ele volta a ser so a lista. 0 desativa a arborizacao.
+    size_t m_treeify_threshold;
+    size_t m_untreeify_threshold;
+
     // tabela
-    std::vector<std::list<std::pair<Key, Value>>> m_table;
+    std::vector<Bucket> m_table;
+
+    // Rehash incremental: enquanto m_old_table nao estiver vazia, um rehash esta em andamento e os
+    // slots ainda nao migrados da tabela antiga sao consultados junto com os da tabela nova.
+    std::vector<Bucket> m_old_table;
+    size_t m_migrate_pos = 0;  // proximo slot da tabela antiga a ser migrado
+    size_t m_migrate_step = 0; // slots migrados por operacao de escrita (0 = rehash de uma vez)
 
     // referencia para a funcao de codificacao
     Hash m_hashing;
 
-    size_t get_next_prime(size_t x);
     size_t hash_code(const Key &k) const;
+    size_t slot_of(size_t h) const;
+    bool matches(const Entry &e, const Key &k, size_t h) const;
+    const Entry* find_in(const Bucket &b, const Key &k, size_t h) const;
+    const Entry* find_entry(const Key &k, size_t h) const;
+    Entry* find_entry(const Key &k, size_t h);
+    bool erase_from(Bucket &b, const Key &k, size_t h);
+    void attach_last(Bucket &b);
+    void treeify(Bucket &b);
     size_t bucket(const Key &k) const;
     void rehash(size_t m);
+    void migrate(size_t buckets);
     Value &operator[] (const Key &k);
     const Value &operator[] (const Key &k) const;
     void set_max_load_factor(float lf);
@@ -62,10 +157,18 @@ public:
 
     long long get_comparisons() const override;
     long long get_collisions() const override;
+    long long get_skipped_comparisons() const;
+    size_t get_node_bytes() const override;
     long long get_colors() const override;
     long long get_rotations() const override;
-    void reserve(size_t n) const;
+    long long get_rehashes() const override;
+    void reserve(size_t n) override;
+    void enable_incremental_rehash(size_t buckets_per_op = 8);
+    bool is_rehashing() const;
+    void set_treeify_threshold(size_t threshold);
+    size_t get_treeified_buckets() const;
     std::vector<Key> get_all_keys_sorted() const override;
+    template <typename Visit> void for_each(Visit &&visit) const;
 };
 
 /**
@@ -80,17 +183,19 @@ public:
  * @tparam Hash Functor de hash utilizado para calcular o índice das chaves.
  * @return std::vector<Key> Vetor contendo todas as chaves presentes na tabela, ordenadas.
  */
-template <typename Key, typename Value, typename Hash>
-std::vector<Key> ChainedHashTable<Key, Value, Hash>::get_all_keys_sorted() const {
+template <typename Key, typename Value, typename Hash, typename Sizing>
+std::vector<Key> ChainedHashTable<Key, Value, Hash, Sizing>::get_all_keys_sorted() const {
     std::vector<Key> keys;
 
     if (this->isEmpty()) return keys;
 
     keys.reserve(this->size());
 
-    for (const auto& bucket : m_table) {
-        for (const auto& pair : bucket) {
-            keys.push_back(pair.first);
+    for (const auto* table : {&m_table, &m_old_table}) {
+        for (const auto& bucket : *table) {
+            for (const auto& entry : bucket.chain) {
+                keys.push_back(entry.data.first);
+            }
         }
     }
 
@@ -100,34 +205,19 @@ std::vector<Key> ChainedHashTable<Key, Value, Hash>::get_all_keys_sorted() const
 }
 
 /**
- * @brief Retorna o menor numero primo que eh maior que ou igual
- * a x e maior que 2.
- *
- * @param x := um numero nao negativo
- * @return size_t := um numero primo
+ * @brief Chama visit(chave, valor) para cada par da tabela, sem ordem definida e sem copiar as chaves.
+ * Usado, por exemplo, para fundir contagens de varias tabelas.
  */
-
-template <typename Key, typename Value, typename Hash>
-size_t ChainedHashTable<Key, Value, Hash>:: get_next_prime(size_t x){
-    if (x <= 2)
-        return 3;
-
-    x = (x % 2 == 0) ? x + 1 : x;
-
-    bool not_prime = true;
-    while (not_prime){
-        not_prime = false;
-
-        for (int i = 3; i <= sqrt(x); i += 2){
-
-            if (x % i == 0){
-                not_prime = true;
-                break;
+template <typename Key, typename Value, typename Hash, typename Sizing>
+template <typename Visit>
+void ChainedHashTable<Key, Value, Hash, Sizing>::for_each(Visit &&visit) const {
+    for (const auto* table : {&m_table, &m_old_table}) {
+        for (const auto& bucket : *table) {
+            for (const auto& entry : bucket.chain) {
+                visit(entry.data.first, entry.data.second);
             }
         }
-        x += 2;
     }
-    return x - 2;
 }
 
 /**
@@ -135,27 +225,163 @@ size_t ChainedHashTable<Key, Value, Hash>:: get_next_prime(size_t x){
  * Esta funcao recebe uma chave k e faz o seguinte:
  * (1) computa o codigo hash h(k) usando a
  *     funcao no atributo privado m_hashing
- * (2) computa um indice no intervalo [0 ... m_table_size-1]
- *     aplicando o metodo da divisao: h(k) % m_table_size
+ * (2) reduz h(k) a um indice no intervalo [0 ... m_table_size-1]
+ *     com a politica de dimensionamento (slot_of)
  *
  * @param k := um valor de chave do tipo Key
  * @return size_t := um inteiro no intervalo [0 ... m_table_size-1]
  */
-template <typename Key, typename Value, typename Hash>
-size_t ChainedHashTable<Key, Value, Hash>:: hash_code(const Key &k) const{
-    return m_hashing(k) % m_table_size;
+template <typename Key, typename Value, typename Hash, typename Sizing>
+size_t ChainedHashTable<Key, Value, Hash, Sizing>:: hash_code(const Key &k) const{
+    return slot_of(m_hashing(k));
 }
 
 /**
- * @brief Construtor: cria uma tabela hash com um numero primo de slots.
+ * @brief Retorna o slot de um codigo hash ja calculado, segundo a politica de dimensionamento.
+ *
+ * @param h := codigo hash completo de uma chave
+ * @return size_t := um inteiro no intervalo [0 ... m_table_size-1]
+ */
+template <typename Key, typename Value, typename Hash, typename Sizing>
+size_t ChainedHashTable<Key, Value, Hash, Sizing>:: slot_of(size_t h) const{
+    return m_sizing.index(h);
+}
+
+/**
+ * @brief Retorna true se a entrada e guarda a chave k, cujo hash completo eh h.
+ * A chave so eh comparada quando os hashes coincidem; caso contrario a comparacao
+ * evitada eh contada em skipped.
+ */
+template <typename Key, typename Value, typename Hash, typename Sizing>
+bool ChainedHashTable<Key, Value, Hash, Sizing>:: matches(const Entry &e, const Key &k, size_t h) const{
+    if (e.hash != h){
+        skipped++;
+        return false;
+    }
+    return e.data.first == k;
+}
+
+/**
+ * @brief Procura a entrada da chave k (hash completo h) no slot b: pelo indice em arvore, se o
+ * slot estiver arborizado, ou percorrendo a lista. Conta uma comparacao por entrada ou no visitado.
+ *
+ * @return const Entry* := a entrada encontrada ou nullptr
+ */
+template <typename Key, typename Value, typename Hash, typename Sizing>
+const typename ChainedHashTable<Key, Value, Hash, Sizing>::Entry* ChainedHashTable<Key, Value, Hash, Sizing>:: find_in(const Bucket &b, const Key &k, size_t h) const{
+    if (b.tree){
+        auto it = b.tree->find(Probe{&k, h, &comparisons, &skipped});
+        return (it != b.tree->end() && (*it)->data.first == k) ? &**it : nullptr;
+    }
+
+    for (auto &p : b.chain){
+        comparisons++; // incrementa o contador de comparações
+        if (matches(p, k, h)){
+            return &p;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Procura a entrada da chave k (hash completo h) no slot da tabela atual e, durante
+ * um rehash incremental, tambem no slot correspondente da tabela antiga (vazio se ja migrado).
+ * Conta uma comparacao por entrada visitada.
+ *
+ * @return const Entry* := a entrada encontrada ou nullptr
+ */
+template <typename Key, typename Value, typename Hash, typename Sizing>
+const typename ChainedHashTable<Key, Value, Hash, Sizing>::Entry* ChainedHashTable<Key, Value, Hash, Sizing>:: find_entry(const Key &k, size_t h) const{
+    if (const Entry* p = find_in(m_table[slot_of(h)], k, h)){
+        return p;
+    }
+
+    if (is_rehashing()){
+        return find_in(m_old_table[m_old_sizing.index(h)], k, h);
+    }
+
+    return nullptr;
+}
+
+template <typename Key, typename Value, typename Hash, typename Sizing>
+typename ChainedHashTable<Key, Value, Hash, Sizing>::Entry* ChainedHashTable<Key, Value, Hash, Sizing>:: find_entry(const Key &k, size_t h){
+    return const_cast<Entry*>(static_cast<const ChainedHashTable&>(*this).find_entry(k, h));
+}
+
+/**
+ * @brief Remove do slot b a entrada da chave k, se existir.
+ * Conta uma comparacao por entrada ou no visitado. Se o slot arborizado ficar abaixo de
+ * m_untreeify_threshold entradas, o indice em arvore eh descartado.
+ *
+ * @return bool := true se a entrada foi removida
+ */
+template <typename Key, typename Value, typename Hash, typename Sizing>
+bool ChainedHashTable<Key, Value, Hash, Sizing>:: erase_from(Bucket &b, const Key &k, size_t h){
+    if (b.tree){
+        auto it = b.tree->find(Probe{&k, h, &comparisons, &skipped});
+        if (it == b.tree->end() || !((*it)->data.first == k)){
+            return false;
+        }
+        b.chain.erase(*it);
+        b.tree->erase(it);
+        if (b.chain.size() < m_untreeify_threshold){
+            b.tree.reset();
+        }
+        return true;
+    }
+
+    for (auto it = b.chain.begin(); it != b.chain.end(); ++it){
+        comparisons++; // incrementa o contador de comparações
+        if (matches(*it, k, h)){
+            b.chain.erase(it);
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Registra a ultima entrada da lista do slot b no indice em arvore e, se o slot
+ * ainda for so uma lista e tiver passado de m_treeify_threshold entradas, arboriza o slot.
+ * Chamada depois de cada entrada acrescentada ao fim da lista (insercao ou migracao).
+ */
+template <typename Key, typename Value, typename Hash, typename Sizing>
+void ChainedHashTable<Key, Value, Hash, Sizing>:: attach_last(Bucket &b){
+    if (b.tree){
+        b.tree->insert(std::prev(b.chain.end()));
+    }
+    else if (m_treeify_threshold > 0 && b.chain.size() > m_treeify_threshold){
+        treeify(b);
+    }
+}
+
+/**
+ * @brief Constroi o indice em arvore do slot b sobre as entradas da lista.
+ * Os nos da lista nao sao movidos nem copiados; a construcao nao altera as metricas.
+ */
+template <typename Key, typename Value, typename Hash, typename Sizing>
+void ChainedHashTable<Key, Value, Hash, Sizing>:: treeify(Bucket &b){
+    b.tree = std::make_unique<Tree>();
+    for (auto it = b.chain.begin(); it != b.chain.end(); ++it){
+        b.tree->insert(it);
+    }
+}
+
+/**
+ * @brief Construtor: cria uma tabela hash com pelo menos tableSize slots
+ * (um numero primo, com a politica padrao).
+ * O limite de arborizacao eh 8 entradas (o do HashMap do Java) vezes o fator de carga maximo,
+ * quando este passa de 1: com fatores altos, listas longas sao esperadas e nao indicam colisoes
+ * anormais.
  *
  * @param tableSize := o numero de slots da tabela.
  */
-template <typename Key, typename Value, typename Hash>
-ChainedHashTable<Key, Value, Hash>::ChainedHashTable(size_t tableSize, float load_factor){
+template <typename Key, typename Value, typename Hash, typename Sizing>
+ChainedHashTable<Key, Value, Hash, Sizing>::ChainedHashTable(size_t tableSize, float load_factor)
+    : m_sizing(tableSize), m_old_sizing(tableSize){
 
     m_number_of_elements = 0;
-    m_table_size = get_next_prime(tableSize);
+    m_table_size = m_sizing.size();
     m_table.resize(m_table_size);
 
     if (load_factor <= 0){
@@ -164,21 +390,24 @@ ChainedHashTable<Key, Value, Hash>::ChainedHashTable(size_t tableSize, float loa
     else{
         m_max_load_factor = load_factor;
     }
+
+    m_treeify_threshold = static_cast<size_t>(std::ceil(8 * std::max(1.0f, m_max_load_factor)));
+    m_untreeify_threshold = m_treeify_threshold - m_treeify_threshold / 4;
 }
 
 /**
  * @brief Retorna o numero de elementos na tabela hash
  */
-template <typename Key, typename Value, typename Hash>
-size_t ChainedHashTable<Key, Value, Hash>:: size() const{
+template <typename Key, typename Value, typename Hash, typename Sizing>
+size_t ChainedHashTable<Key, Value, Hash, Sizing>:: size() const{
     return m_number_of_elements;
 }
 
 /**
  * @brief Retorna um booleano indicando se a tabela esta vazia
  */
-template <typename Key, typename Value, typename Hash>
-bool ChainedHashTable<Key, Value, Hash>:: isEmpty() const{
+template <typename Key, typename Value, typename Hash, typename Sizing>
+bool ChainedHashTable<Key, Value, Hash, Sizing>:: isEmpty() const{
     return m_number_of_elements == 0;
 }
 
@@ -191,8 +420,8 @@ bool ChainedHashTable<Key, Value, Hash>:: isEmpty() const{
  *
  * @return size_t := o numero de slots
  */
-template <typename Key, typename Value, typename Hash>
-size_t ChainedHashTable<Key, Value, Hash>::bucket_count() const{
+template <typename Key, typename Value, typename Hash, typename Sizing>
+size_t ChainedHashTable<Key, Value, Hash, Sizing>::bucket_count() const{
     return m_table_size;
 }
 
@@ -203,15 +432,15 @@ size_t ChainedHashTable<Key, Value, Hash>::bucket_count() const{
  * @param n := numero do slot
  * @return size_t := numero de elementos no slot n
  */
-template <typename Key, typename Value, typename Hash>
-size_t ChainedHashTable<Key, Value, Hash>::bucket_size(size_t n) const{
+template <typename Key, typename Value, typename Hash, typename Sizing>
+size_t ChainedHashTable<Key, Value, Hash, Sizing>::bucket_size(size_t n) const{
 
     if (n >= m_table_size)
     {
         throw std::out_of_range("invalid index");
     }
 
-    return m_table[n].size();
+    return m_table[n].chain.size();
 }
 
 /**
@@ -220,24 +449,24 @@ size_t ChainedHashTable<Key, Value, Hash>::bucket_size(size_t n) const{
  * @param k := chave
  * @return size_t := numero do slot
  */
-template <typename Key, typename Value, typename Hash>
-size_t ChainedHashTable<Key, Value, Hash>::bucket(const Key &k) const{
+template <typename Key, typename Value, typename Hash, typename Sizing>
+size_t ChainedHashTable<Key, Value, Hash, Sizing>::bucket(const Key &k) const{
     return hash_code(k);
 }
 
 /**
  * @brief retorna o valor do fator de carga atual
  */
-template <typename Key, typename Value, typename Hash>
-float ChainedHashTable<Key, Value, Hash>::load_factor(){
+template <typename Key, typename Value, typename Hash, typename Sizing>
+float ChainedHashTable<Key, Value, Hash, Sizing>::load_factor(){
     return static_cast<float>(m_number_of_elements) / m_table_size;
 }
 
 /**
  * @brief retorna o maior valor que o fator de carga pode ter
  */
-template <typename Key, typename Value, typename Hash>
-float ChainedHashTable<Key, Value, Hash>::max_load_factor() const{
+template <typename Key, typename Value, typename Hash, typename Sizing>
+float ChainedHashTable<Key, Value, Hash, Sizing>::max_load_factor() const{
     return m_max_load_factor;
 }
 
@@ -245,6 +474,7 @@ float ChainedHashTable<Key, Value, Hash>::max_load_factor() const{
  * @brief Insere um novo elemento na tabela hash.
  * Se m_number_of_elements / m_table_size > m_max_load_factor entao a funcao
  * invoca a funcao rehash() passando o dobro do tamanho atual da tabela.
+ * Com o rehash incremental ativo, cada insercao antes migra alguns slots pendentes.
  * O elemento eh inserido somente se a chave dele ja nao estiver presente
  * na tabela (numa tabela hash, as chaves sao unicas).
  * Caso a insercao seja feita, isso incrementa o numero de elementos
@@ -254,21 +484,21 @@ float ChainedHashTable<Key, Value, Hash>::max_load_factor() const{
  * @param k := chave
  * @param v := valor
  */
-template <typename Key, typename Value, typename Hash>
-void ChainedHashTable<Key, Value, Hash>:: add(const Key &k, const Value &v){
+template <typename Key, typename Value, typename Hash, typename Sizing>
+void ChainedHashTable<Key, Value, Hash, Sizing>:: add(const Key &k, const Value &v){
+
+    migrate(m_migrate_step);
 
     if (load_factor() >= m_max_load_factor){
         rehash(2 * m_table_size);
     }
 
-    size_t slot = hash_code(k);
+    size_t h = m_hashing(k);
+    size_t slot = slot_of(h);
 
-    for (auto &p : m_table[slot]){
-        comparisons++; // incrementa o contador de comparações
-        if (p.first == k){
-            p.second = v; // se a chave ja existe, atualiza o valor
-            return;
-        }
+    if (Entry* p = find_entry(k, h)){
+        p->data.second = v; // se a chave ja existe, atualiza o valor
+        return;
     }
 
     // Se chegamos aqui significa que a chave k não existe na tabela.
@@ -277,12 +507,13 @@ void ChainedHashTable<Key, Value, Hash>:: add(const Key &k, const Value &v){
     // Isso é importante para análise de desempenho, pois colisões podem afetar a eficiência da tabela hash.
     // Assim, se houver colisão, incrementamos o contador de colisões.
     // Isso nos ajuda a entender quantas colisões ocorreram durante as inserções.
-    if (!m_table[slot].empty()){
+    if (!m_table[slot].chain.empty()){
         collisions++; // incrementa o contador de colisões
     }
 
     // Se a chave não existe, adicionamos o novo par (k, v) na lista do slot correspondente.
-    m_table[slot].push_back(std::make_pair(k, v));
+    m_table[slot].chain.push_back(Entry{std::make_pair(k, v), h});
+    attach_last(m_table[slot]);
     m_number_of_elements++;
 
 }
@@ -293,19 +524,9 @@ void ChainedHashTable<Key, Value, Hash>:: add(const Key &k, const Value &v){
  *
  * @param k := chave a ser pesquisada
  */
-template <typename Key, typename Value, typename Hash>
-bool ChainedHashTable<Key, Value, Hash>::contains(const Key &k) const{
-
-    size_t slot = hash_code(k);
-
-    for (auto &p : m_table[slot]){
-        comparisons++; // incrementa o contador de comparações
-        if (p.first == k){
-            return true;
-        }
-    }
-
-    return false;
+template <typename Key, typename Value, typename Hash, typename Sizing>
+bool ChainedHashTable<Key, Value, Hash, Sizing>::contains(const Key &k) const{
+    return find_entry(k, m_hashing(k)) != nullptr;
 }
 
 /**
@@ -316,16 +537,11 @@ bool ChainedHashTable<Key, Value, Hash>::contains(const Key &k) const{
  * @param k := chave
  * @return V& := valor associado a chave
  */
-template <typename Key, typename Value, typename Hash>
-const Value& ChainedHashTable<Key, Value, Hash>::get(const Key &k) const{
-
-    size_t slot = hash_code(k);
+template <typename Key, typename Value, typename Hash, typename Sizing>
+const Value& ChainedHashTable<Key, Value, Hash, Sizing>::get(const Key &k) const{
 
-    for (auto &p : m_table[slot]){
-        comparisons++; // incrementa o contador de comparações
-        if (p.first == k){
-            return p.second;
-        }
+    if (const Entry* p = find_entry(k, m_hashing(k))){
+        return p->data.second;
     }
 
     throw std::out_of_range("A chave nao existe na tabela hash");
@@ -333,7 +549,8 @@ const Value& ChainedHashTable<Key, Value, Hash>::get(const Key &k) const{
 
 /**
  * @brief Recebe um inteiro nao negativo m e faz com que o tamanho
- * da tabela seja um numero primo maior ou igual a m.
+ * da tabela seja o menor tamanho da politica de dimensionamento maior ou igual
+ * a m (com a politica padrao, um numero primo).
  * Se m for maior que o tamanho atual da tabela, um rehashing eh realizado.
  * Se m for menor que o tamanho atual da tabela, a funcao nao tem nenhum efeito.
  * Um rehashing eh uma operacao de reconstrucao da tabela:
@@ -342,33 +559,134 @@ const Value& ChainedHashTable<Key, Value, Hash>::get(const Key &k) const{
  * Isto pode alterar a ordem de iteracao dos elementos dentro do container.
  * Operacoes de rehashing sao realizadas automaticamente pelo container
  * sempre que load_factor() ultrapassa o m_max_load_factor.
+ * O novo slot de cada elemento vem do hash guardado na entrada: nenhuma chave
+ * eh recalculada nem comparada, e as metricas nao sao alteradas.
+ * Os nos das listas sao transferidos com splice, entao o rehash nao copia chaves
+ * nem aloca nos; a memoria extra no pico eh apenas o novo vetor de slots, e
+ * referencias para os valores continuam validas.
+ * Com o rehash incremental ativo, a tabela antiga eh mantida ao lado da nova e
+ * apenas m_migrate_step slots sao migrados agora; os demais sao migrados pelas
+ * proximas escritas (ver migrate()). Um rehash pendente eh concluido antes de
+ * iniciar outro.
  *
  * @param m := o novo tamanho da tabela hash
  */
-template <typename Key, typename Value, typename Hash>
-void ChainedHashTable<Key, Value, Hash>::rehash(size_t m){
+template <typename Key, typename Value, typename Hash, typename Sizing>
+void ChainedHashTable<Key, Value, Hash, Sizing>::rehash(size_t m){
+
+    Sizing new_sizing(m);
+
+    if (new_sizing.size() > m_table_size){
+
+        migrate(m_old_table.size()); // conclui um rehash incremental pendente
+
+        m_old_table.swap(m_table);         // a tabela antiga fica em m_old_table, sem copia
+        m_old_sizing = m_sizing;
+        m_sizing = new_sizing;
+        m_table_size = m_sizing.size();
+        m_table.resize(m_table_size);      // tabela redimensionada com o novo tamanho
+        m_migrate_pos = 0;
+        rehashes++;
+
+        migrate(m_migrate_step == 0 ? m_old_table.size() : m_migrate_step);
+    }
+}
+
+/**
+ * @brief Migra ate buckets slots da tabela antiga para a tabela atual, a partir de m_migrate_pos.
+ * Quando o ultimo slot eh migrado, a tabela antiga eh liberada e o rehash termina.
+ * Sem rehash em andamento, a funcao nao tem efeito.
+ *
+ * @param buckets := numero maximo de slots a migrar
+ */
+template <typename Key, typename Value, typename Hash, typename Sizing>
+void ChainedHashTable<Key, Value, Hash, Sizing>::migrate(size_t buckets){
 
-    size_t new_table_size = get_next_prime(m);
+    if (!is_rehashing()){
+        return;
+    }
 
-    if (new_table_size > m_table_size){
+    size_t end = std::min(m_old_table.size(), m_migrate_pos + buckets);
+    for (; m_migrate_pos < end; ++m_migrate_pos){
+        auto &chain = m_old_table[m_migrate_pos].chain;
+        m_old_table[m_migrate_pos].tree.reset(); // o indice do slot antigo nao vale para os slots novos
+        // splice move o proprio no da lista antiga para o fim da lista do novo slot:
+        // nenhuma chave eh copiada e nenhum no eh alocado ou liberado
+        while (!chain.empty()){
+            auto node = chain.begin();
+            auto &target = m_table[slot_of(node->hash)];
+            target.chain.splice(target.chain.end(), chain, node);
+            attach_last(target);
+        }
+    }
 
-        std::vector<std::list<std::pair<Key, Value>>> old_vec;
+    if (m_migrate_pos == m_old_table.size()){
+        std::vector<Bucket>().swap(m_old_table);
+        m_migrate_pos = 0;
+    }
+}
 
-        old_vec = m_table; // copia as chaves para uma nova tabela
+/**
+ * @brief Ativa o rehash incremental (ou o desativa, com buckets_per_op = 0).
+ *
+ * Com o modo ativo, ao ultrapassar o fator de carga a tabela nova eh alocada, mas os elementos
+ * so sao movidos aos poucos: cada add/remove migra ate buckets_per_op slots da tabela antiga, e
+ * as buscas consultam as duas tabelas ate o fim da migracao. Assim nenhuma insercao paga
+ * sozinha pelo rehash da tabela inteira. Ao desativar, um rehash pendente eh concluido.
+ *
+ * @param buckets_per_op := slots migrados por operacao de escrita
+ */
+template <typename Key, typename Value, typename Hash, typename Sizing>
+void ChainedHashTable<Key, Value, Hash, Sizing>::enable_incremental_rehash(size_t buckets_per_op){
+    m_migrate_step = buckets_per_op;
+    if (m_migrate_step == 0){
+        migrate(m_old_table.size());
+    }
+}
 
-        m_table.clear();                // apaga todas as chaves da tabela atual e deixa ela vazia
-        m_table.resize(new_table_size); // tabela redimensionada com novo primo
-        m_number_of_elements = 0;
-        m_table_size = new_table_size;
+/**
+ * @brief Retorna true se um rehash incremental estiver em andamento.
+ */
+template <typename Key, typename Value, typename Hash, typename Sizing>
+bool ChainedHashTable<Key, Value, Hash, Sizing>::is_rehashing() const{
+    return !m_old_table.empty();
+}
 
-        for (size_t i = 0; i < old_vec.size(); ++i){
-            for (auto &par : old_vec[i]){
-                add(par.first, par.second);
+/**
+ * @brief Muda o limite de arborizacao (0 desativa) e reorganiza os slots existentes:
+ * listas acima do novo limite sao arborizadas e slots abaixo de 3/4 dele voltam a ser listas.
+ *
+ * @param threshold := numero de entradas a partir do qual (exclusive) um slot eh arborizado
+ */
+template <typename Key, typename Value, typename Hash, typename Sizing>
+void ChainedHashTable<Key, Value, Hash, Sizing>::set_treeify_threshold(size_t threshold){
+    m_treeify_threshold = threshold;
+    m_untreeify_threshold = threshold - threshold / 4;
+
+    for (auto* table : {&m_table, &m_old_table}) {
+        for (auto& bucket : *table) {
+            if (threshold == 0 || bucket.chain.size() < m_untreeify_threshold){
+                bucket.tree.reset();
+            }
+            else if (!bucket.tree && bucket.chain.size() > threshold){
+                treeify(bucket);
             }
+        }
+    }
+}
 
-            old_vec[i].clear();
+/**
+ * @brief Retorna quantos slots (das tabelas atual e antiga) estao arborizados.
+ */
+template <typename Key, typename Value, typename Hash, typename Sizing>
+size_t ChainedHashTable<Key, Value, Hash, Sizing>::get_treeified_buckets() const{
+    size_t count = 0;
+    for (const auto* table : {&m_table, &m_old_table}) {
+        for (const auto& bucket : *table) {
+            count += bucket.tree ? 1 : 0;
         }
     }
+    return count;
 }
 
 /**
@@ -378,21 +696,19 @@ void ChainedHashTable<Key, Value, Hash>::rehash(size_t m){
  *
  * @param k := chave a ser removida
  */
-template <typename Key, typename Value, typename Hash>
-void ChainedHashTable<Key, Value, Hash>::remove(const Key &k){
+template <typename Key, typename Value, typename Hash, typename Sizing>
+void ChainedHashTable<Key, Value, Hash, Sizing>::remove(const Key &k){
 
-    size_t slot = hash_code(k); // calcula o slot em que estaria a chave
+    migrate(m_migrate_step);
 
-    for (auto it = m_table[slot].begin(); it != m_table[slot].end(); ++it)
-    {
-        comparisons++; // incrementa o contador de comparações
-        if (it->first == k)
-        {
-            m_table[slot].erase(it); // se encontrar, deleta
-            m_number_of_elements--;
+    size_t h = m_hashing(k);
 
-            return;
-        }
+    // procura no slot em que estaria a chave e, durante um rehash, tambem na tabela antiga
+    if (erase_from(m_table[slot_of(h)], k, h) ||
+        (is_rehashing() && erase_from(m_old_table[m_old_sizing.index(h)], k, h)))
+    {
+        m_number_of_elements--;
+        return;
     }
 
     throw std::out_of_range("Chave nao encontrada para remocao");
@@ -406,11 +722,13 @@ void ChainedHashTable<Key, Value, Hash>::remove(const Key &k){
  * tamanho apropriado da nova tabela.
  * Se n <= m_table_size * m_max_load_factor, entao
  * a funcao nao tem efeito, nao faz nada.
+ * Chamada antes de uma ingestao com n chaves distintas, substitui
+ * todos os rehash por dobra por um unico redimensionamento.
  *
  * @param n := numero de elementos
  */
-template <typename Key, typename Value, typename Hash>
-void ChainedHashTable<Key, Value, Hash>::reserve(size_t n) const{
+template <typename Key, typename Value, typename Hash, typename Sizing>
+void ChainedHashTable<Key, Value, Hash, Sizing>::reserve(size_t n){
 
     if (n > m_table_size * m_max_load_factor)
     {
@@ -430,8 +748,8 @@ void ChainedHashTable<Key, Value, Hash>::reserve(size_t n) const{
  *
  * @param lf := novo fator de carga
  */
-template <typename Key, typename Value, typename Hash>
-void ChainedHashTable<Key, Value, Hash>::set_max_load_factor(float lf){
+template <typename Key, typename Value, typename Hash, typename Sizing>
+void ChainedHashTable<Key, Value, Hash, Sizing>::set_max_load_factor(float lf){
 
     if (lf <= 0)
     {
@@ -455,33 +773,33 @@ void ChainedHashTable<Key, Value, Hash>::set_max_load_factor(float lf){
  * @param k := chave
  * @return Value& := valor associado a chave
  */
-template <typename Key, typename Value, typename Hash>
-Value& ChainedHashTable<Key, Value, Hash>:: operator[](const Key &k){
+template <typename Key, typename Value, typename Hash, typename Sizing>
+Value& ChainedHashTable<Key, Value, Hash, Sizing>:: operator[](const Key &k){
+
+    migrate(m_migrate_step);
 
     if (load_factor() >= m_max_load_factor)
     {
         rehash(2 * m_table_size);
     }
 
-    size_t slot = hash_code(k);
+    size_t h = m_hashing(k);
+    size_t slot = slot_of(h);
 
-    for (auto &par : m_table[slot])
+    if (Entry* par = find_entry(k, h))
     {
-        comparisons++; // incrementa o contador de comparações
-        if (par.first == k)
-        {
-            return par.second;
-        }
+        return par->data.second;
     }
 
-    if (!m_table[slot].empty()){
+    if (!m_table[slot].chain.empty()){
         collisions++;
     }
 
-    m_table[slot].push_back({k, Value()});
+    m_table[slot].chain.push_back(Entry{{k, Value()}, h});
+    attach_last(m_table[slot]);
     m_number_of_elements++;
 
-    return m_table[slot].back().second;
+    return m_table[slot].chain.back().data.second;
 }
 
 /**
@@ -494,21 +812,30 @@ Value& ChainedHashTable<Key, Value, Hash>:: operator[](const Key &k){
  * @param k := chave
  * @return Value& := valor associado a chave
  */
-template <typename Key, typename Value, typename Hash>
-const Value & ChainedHashTable<Key, Value, Hash>::operator[](const Key &k) const{
+template <typename Key, typename Value, typename Hash, typename Sizing>
+const Value & ChainedHashTable<Key, Value, Hash, Sizing>::operator[](const Key &k) const{
     return at(k);
 }
 
 // Getters para as métricas
-template <typename Key, typename Value, typename Hash>
-long long ChainedHashTable<Key, Value, Hash>::get_comparisons() const { return comparisons; } // Função que retorna o número de comparações
+template <typename Key, typename Value, typename Hash, typename Sizing>
+long long ChainedHashTable<Key, Value, Hash, Sizing>::get_comparisons() const { return comparisons; } // Função que retorna o número de comparações
+
+template <typename Key, typename Value, typename Hash, typename Sizing>
+long long ChainedHashTable<Key, Value, Hash, Sizing>::get_collisions() const { return collisions; }   // Função que retorna o número de colisões
+
+template <typename Key, typename Value, typename Hash, typename Sizing>
+long long ChainedHashTable<Key, Value, Hash, Sizing>::get_skipped_comparisons() const { return skipped; } // Comparações de chave evitadas pelo hash guardado
+
+template <typename Key, typename Value, typename Hash, typename Sizing>
+size_t ChainedHashTable<Key, Value, Hash, Sizing>::get_node_bytes() const { return sizeof(Entry) + 2 * sizeof(void*); } // Nó da std::list: par e hash mais os ponteiros anterior e próximo
 
-template <typename Key, typename Value, typename Hash>
-long long ChainedHashTable<Key, Value, Hash>::get_collisions() const { return collisions; }   // Função que retorna o número de colisões
+template <typename Key, typename Value, typename Hash, typename Sizing>
+long long ChainedHashTable<Key, Value, Hash, Sizing>::get_rehashes() const { return rehashes; } // Quantidade de redimensionamentos da tabela
 
-template <typename Key, typename Value, typename Hash>
-long long ChainedHashTable<Key, Value, Hash>::get_colors() const { return 0; } // Função que retorna o número de cores trocadas, não utilizado na tabela hash
+template <typename Key, typename Value, typename Hash, typename Sizing>
+long long ChainedHashTable<Key, Value, Hash, Sizing>::get_colors() const { return 0; } // Função que retorna o número de cores trocadas, não utilizado na tabela hash
 
-template <typename Key, typename Value, typename Hash>
-long long ChainedHashTable<Key, Value, Hash>::get_rotations() const { return 0; } // Função que retorna o número de rotações, não utilizado na tabela hash
+template <typename Key, typename Value, typename Hash, typename Sizing>
+long long ChainedHashTable<Key, Value, Hash, Sizing>::get_rotations() const { return 0; } // Função que retorna o número de rotações, não utilizado na tabela hash
 #endif
\ No newline at end of file
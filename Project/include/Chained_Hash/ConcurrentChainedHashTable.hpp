@@ -0,0 +1,377 @@
+#ifndef CONCURRENT_CHAINED_HASHTABLE_HPP
+#define CONCURRENT_CHAINED_HASHTABLE_HPP
+
+#include <atomic>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <algorithm>
+
+#include "../utils/sizingPolicy.hpp"
+
+/**
+ * @brief Tabela hash encadeada para vários escritores, com travas por faixas (lock striping).
+ *
+ * Os slots são divididos em m_stripe_count faixas (o slot b pertence à faixa b % m_stripe_count), cada uma
+ * com a sua trava e o seu contador de elementos. Uma operação trava apenas a faixa do slot da chave, então
+ * threads que trabalham em slots de faixas diferentes não se bloqueiam:
+ * - O slot depende do tamanho da tabela, que muda no redimensionamento. A operação lê o ponteiro da tabela
+ *   atual, calcula o slot, trava a faixa e confere se a tabela ainda é a mesma; se não for, repete.
+ * - O redimensionamento trava todas as faixas (sempre na mesma ordem, e nenhuma operação segura duas
+ *   faixas), move os nós para a nova tabela com splice, a partir do hash guardado, e publica o novo ponteiro.
+ *   Tabelas substituídas ficam guardadas, sem slots, até o destrutor: uma thread pode ter lido o ponteiro
+ *   antigo e ainda estar calculando o slot com a política de dimensionamento dela.
+ * - O fator de carga é avaliado por faixa (contador da faixa * faixas / slots), o que evita um contador
+ *   global disputado por todas as inserções.
+ *
+ * increment() soma um valor à contagem de uma chave (inserindo-a se preciso) em uma única seção travada,
+ * no lugar da sequência contains + get + add, que entre threads perderia incrementos.
+ *
+ * Como ConcurrentAVL e ConcurrentRB, a tabela não implementa IDictionary: get() devolve uma cópia do valor
+ * e não há contadores de comparações.
+ *
+ * @tparam Key Tipo da chave.
+ * @tparam Value Tipo do valor.
+ * @tparam Hash Functor de hash.
+ * @tparam Sizing Política de dimensionamento (ver sizingPolicy.hpp).
+ */
+template <typename Key, typename Value, typename Hash = std::hash<Key>, typename Sizing = TrialDivisionPrimeSizing>
+class ConcurrentChainedHashTable {
+private:
+    // Entrada de uma lista: o par e o hash completo da chave (como em ChainedHashTable)
+    struct Entry {
+        std::pair<Key, Value> data;
+        size_t hash;
+    };
+    using Chain = std::list<Entry>;
+
+    // Slots e a política que os dimensiona; só mudam com todas as faixas travadas
+    struct Table {
+        Sizing sizing;
+        std::vector<Chain> slots;
+
+        explicit Table(size_t min_size) : sizing(min_size), slots(sizing.size()) {}
+    };
+
+    // Uma faixa por linha de cache, para que travar uma faixa não invalide a linha da vizinha
+    struct alignas(64) Stripe {
+        std::mutex lock;
+        std::atomic<size_t> count{0}; // elementos nos slots da faixa
+    };
+
+    std::unique_ptr<Stripe[]> m_stripes;
+    size_t m_stripe_count;
+    float m_max_load_factor;
+    std::atomic<Table*> m_table;                 // tabela atual
+    std::vector<std::unique_ptr<Table>> m_tables; // todas as tabelas criadas; a última é a atual
+    std::atomic<long long> resizes{0};
+    mutable std::atomic<long long> retries{0};   // operações repetidas porque a tabela mudou antes da trava
+    Hash m_hashing;
+
+    template <typename Fn>
+    auto locked_slot(size_t h, Fn &&fn) const;
+    Entry* find_in(Chain &chain, const Key &k, size_t h) const;
+    bool over_loaded(const Stripe &stripe, const Table &table) const;
+    void grow(Table *seen);
+    std::vector<std::unique_lock<std::mutex>> lock_all() const;
+
+public:
+    ConcurrentChainedHashTable(size_t stripes = 64, size_t tableSize = 19, float load_factor = 1.0f);
+    ConcurrentChainedHashTable(const ConcurrentChainedHashTable&) = delete;
+    ConcurrentChainedHashTable& operator=(const ConcurrentChainedHashTable&) = delete;
+
+    void add(const Key &k, const Value &v);
+    Value increment(const Key &k, const Value &delta = Value(1));
+    void remove(const Key &k);
+    bool find(const Key &k, Value &out) const;
+    bool contains(const Key &k) const;
+    Value get(const Key &k) const;
+    bool isEmpty() const;
+    size_t size() const;
+
+    std::vector<Key> get_all_keys_sorted() const;
+    template <typename Visit> void for_each(Visit &&visit) const;
+
+    // Funções para obter métricas
+    size_t get_stripe_count() const;
+    size_t bucket_count() const;
+    long long get_resizes() const;
+    long long get_retries() const;
+};
+
+/**
+ * @brief Construtor.
+ *
+ * @param stripes := numero de faixas (travas); pelo menos 1.
+ * @param tableSize := numero minimo de slots iniciais (pelo menos um slot por faixa).
+ * @param load_factor := o maior fator de carga antes de um redimensionamento (1.0 se nao for positivo).
+ */
+template <typename Key, typename Value, typename Hash, typename Sizing>
+ConcurrentChainedHashTable<Key, Value, Hash, Sizing>::ConcurrentChainedHashTable(size_t stripes, size_t tableSize, float load_factor)
+    : m_stripes(new Stripe[stripes < 1 ? 1 : stripes]),
+      m_stripe_count(stripes < 1 ? 1 : stripes),
+      m_max_load_factor(load_factor <= 0 ? 1.0f : load_factor) {
+
+    m_tables.emplace_back(new Table(std::max(tableSize, m_stripe_count)));
+    m_table.store(m_tables.back().get());
+}
+
+/**
+ * @brief Trava a faixa do slot de h na tabela atual e chama fn(tabela, slot, faixa) com a trava obtida.
+ *
+ * Se um redimensionamento trocou a tabela entre a leitura do ponteiro e a trava, o slot calculado
+ * pode estar errado: a trava é solta e a operação é repetida com a nova tabela.
+ */
+template <typename Key, typename Value, typename Hash, typename Sizing>
+template <typename Fn>
+auto ConcurrentChainedHashTable<Key, Value, Hash, Sizing>::locked_slot(size_t h, Fn &&fn) const {
+    for (;;) {
+        Table *table = m_table.load(std::memory_order_acquire);
+        size_t slot = table->sizing.index(h);
+        Stripe &stripe = m_stripes[slot % m_stripe_count];
+
+        std::lock_guard<std::mutex> guard(stripe.lock);
+        if (m_table.load(std::memory_order_relaxed) == table) {
+            return fn(*table, table->slots[slot], stripe);
+        }
+        retries.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief Procura a chave na lista de um slot, comparando primeiro o hash guardado.
+ */
+template <typename Key, typename Value, typename Hash, typename Sizing>
+typename ConcurrentChainedHashTable<Key, Value, Hash, Sizing>::Entry*
+ConcurrentChainedHashTable<Key, Value, Hash, Sizing>::find_in(Chain &chain, const Key &k, size_t h) const {
+    for (auto &entry : chain) {
+        if (entry.hash == h && entry.data.first == k) {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Retorna true se a carga estimada pela faixa (elementos da faixa * faixas / slots) passou do máximo.
+ */
+template <typename Key, typename Value, typename Hash, typename Sizing>
+bool ConcurrentChainedHashTable<Key, Value, Hash, Sizing>::over_loaded(const Stripe &stripe, const Table &table) const {
+    return static_cast<float>(stripe.count.load(std::memory_order_relaxed)) * m_stripe_count > m_max_load_factor * table.slots.size();
+}
+
+/**
+ * @brief Trava todas as faixas, em ordem crescente.
+ */
+template <typename Key, typename Value, typename Hash, typename Sizing>
+std::vector<std::unique_lock<std::mutex>> ConcurrentChainedHashTable<Key, Value, Hash, Sizing>::lock_all() const {
+    std::vector<std::unique_lock<std::mutex>> locks;
+    locks.reserve(m_stripe_count);
+    for (size_t i = 0; i < m_stripe_count; ++i) {
+        locks.emplace_back(m_stripes[i].lock);
+    }
+    return locks;
+}
+
+/**
+ * @brief Dobra a tabela, se ela ainda for a tabela vista por quem pediu o redimensionamento.
+ *
+ * Várias threads podem perceber a carga alta ao mesmo tempo; só a primeira a travar todas as faixas
+ * redimensiona, as demais encontram outra tabela e retornam. Os nós são movidos com splice e o slot
+ * novo vem do hash guardado, então nenhuma chave é copiada nem recalculada. Como os elementos mudam
+ * de slot, e portanto de faixa, o contador de cada faixa é refeito a partir das cadeias dos seus slots.
+ *
+ * @param seen := a tabela que estava sobrecarregada
+ */
+template <typename Key, typename Value, typename Hash, typename Sizing>
+void ConcurrentChainedHashTable<Key, Value, Hash, Sizing>::grow(Table *seen) {
+    auto locks = lock_all();
+    if (m_table.load(std::memory_order_relaxed) != seen) {
+        return;
+    }
+
+    std::unique_ptr<Table> next(new Table(2 * seen->slots.size()));
+    for (auto &chain : seen->slots) {
+        while (!chain.empty()) {
+            Chain &target = next->slots[next->sizing.index(chain.front().hash)];
+            target.splice(target.end(), chain, chain.begin());
+        }
+    }
+    std::vector<Chain>().swap(seen->slots); // a tabela antiga fica só com a política de dimensionamento
+
+    for (size_t i = 0; i < m_stripe_count; ++i) {
+        size_t count = 0;
+        for (size_t slot = i; slot < next->slots.size(); slot += m_stripe_count) {
+            count += next->slots[slot].size();
+        }
+        m_stripes[i].count.store(count, std::memory_order_relaxed);
+    }
+
+    m_table.store(next.get(), std::memory_order_release);
+    m_tables.push_back(std::move(next));
+    resizes.fetch_add(1, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Insere a chave ou atualiza o seu valor.
+ */
+template <typename Key, typename Value, typename Hash, typename Sizing>
+void ConcurrentChainedHashTable<Key, Value, Hash, Sizing>::add(const Key &k, const Value &v) {
+    size_t h = m_hashing(k);
+    Table *full = locked_slot(h, [&](Table &table, Chain &chain, Stripe &stripe) -> Table* {
+        if (Entry *entry = find_in(chain, k, h)) {
+            entry->data.second = v;
+            return nullptr;
+        }
+        chain.push_back(Entry{std::make_pair(k, v), h});
+        stripe.count.fetch_add(1, std::memory_order_relaxed);
+        return over_loaded(stripe, table) ? &table : nullptr;
+    });
+    if (full) {
+        grow(full); // fora da trava da faixa: grow trava todas
+    }
+}
+
+/**
+ * @brief Soma delta ao valor da chave, inserindo-a com valor delta se ainda não existir.
+ *
+ * A leitura e a escrita acontecem com a trava da faixa, então incrementos concorrentes da mesma
+ * chave não se perdem.
+ *
+ * @return Value := o novo valor da chave
+ */
+template <typename Key, typename Value, typename Hash, typename Sizing>
+Value ConcurrentChainedHashTable<Key, Value, Hash, Sizing>::increment(const Key &k, const Value &delta) {
+    size_t h = m_hashing(k);
+    Table *full = nullptr;
+    Value result = locked_slot(h, [&](Table &table, Chain &chain, Stripe &stripe) -> Value {
+        if (Entry *entry = find_in(chain, k, h)) {
+            entry->data.second += delta;
+            return entry->data.second;
+        }
+        chain.push_back(Entry{std::make_pair(k, delta), h});
+        stripe.count.fetch_add(1, std::memory_order_relaxed);
+        full = over_loaded(stripe, table) ? &table : nullptr;
+        return delta;
+    });
+    if (full) {
+        grow(full);
+    }
+    return result;
+}
+
+/**
+ * @brief Remove a chave, se existir.
+ */
+template <typename Key, typename Value, typename Hash, typename Sizing>
+void ConcurrentChainedHashTable<Key, Value, Hash, Sizing>::remove(const Key &k) {
+    size_t h = m_hashing(k);
+    locked_slot(h, [&](Table &, Chain &chain, Stripe &stripe) {
+        for (auto it = chain.begin(); it != chain.end(); ++it) {
+            if (it->hash == h && it->data.first == k) {
+                chain.erase(it);
+                stripe.count.fetch_sub(1, std::memory_order_relaxed);
+                return;
+            }
+        }
+    });
+}
+
+/**
+ * @brief Copia em out o valor da chave, se ela existir.
+ *
+ * @return true se a chave foi encontrada.
+ */
+template <typename Key, typename Value, typename Hash, typename Sizing>
+bool ConcurrentChainedHashTable<Key, Value, Hash, Sizing>::find(const Key &k, Value &out) const {
+    size_t h = m_hashing(k);
+    return locked_slot(h, [&](Table &, Chain &chain, Stripe &) {
+        const Entry *entry = find_in(chain, k, h);
+        if (entry) {
+            out = entry->data.second;
+        }
+        return entry != nullptr;
+    });
+}
+
+template <typename Key, typename Value, typename Hash, typename Sizing>
+bool ConcurrentChainedHashTable<Key, Value, Hash, Sizing>::contains(const Key &k) const {
+    size_t h = m_hashing(k);
+    return locked_slot(h, [&](Table &, Chain &chain, Stripe &) { return find_in(chain, k, h) != nullptr; });
+}
+
+/**
+ * @brief Retorna uma cópia do valor associado à chave.
+ *
+ * @throws std::out_of_range se a chave não estiver presente (mesmo comportamento de ChainedHashTable).
+ */
+template <typename Key, typename Value, typename Hash, typename Sizing>
+Value ConcurrentChainedHashTable<Key, Value, Hash, Sizing>::get(const Key &k) const {
+    Value value{};
+    if (!find(k, value)) {
+        throw std::out_of_range("Chave nao encontrada");
+    }
+    return value;
+}
+
+/**
+ * @brief Retorna o numero de elementos (soma dos contadores das faixas, lidos sem travas).
+ */
+template <typename Key, typename Value, typename Hash, typename Sizing>
+size_t ConcurrentChainedHashTable<Key, Value, Hash, Sizing>::size() const {
+    size_t total = 0;
+    for (size_t i = 0; i < m_stripe_count; ++i) {
+        total += m_stripes[i].count.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+template <typename Key, typename Value, typename Hash, typename Sizing>
+bool ConcurrentChainedHashTable<Key, Value, Hash, Sizing>::isEmpty() const {
+    return size() == 0;
+}
+
+/**
+ * @brief Retorna todas as chaves, ordenadas (com todas as faixas travadas, uma fotografia consistente).
+ */
+template <typename Key, typename Value, typename Hash, typename Sizing>
+std::vector<Key> ConcurrentChainedHashTable<Key, Value, Hash, Sizing>::get_all_keys_sorted() const {
+    std::vector<Key> keys;
+    keys.reserve(size());
+    for_each([&](const Key &k, const Value &) { keys.push_back(k); });
+    std::sort(keys.begin(), keys.end());
+    return keys;
+}
+
+/**
+ * @brief Chama visit(chave, valor) para cada par, com todas as faixas travadas.
+ */
+template <typename Key, typename Value, typename Hash, typename Sizing>
+template <typename Visit>
+void ConcurrentChainedHashTable<Key, Value, Hash, Sizing>::for_each(Visit &&visit) const {
+    auto locks = lock_all();
+    for (const auto &chain : m_table.load(std::memory_order_relaxed)->slots) {
+        for (const auto &entry : chain) {
+            visit(entry.data.first, entry.data.second);
+        }
+    }
+}
+
+// Getters para as métricas
+template <typename Key, typename Value, typename Hash, typename Sizing>
+size_t ConcurrentChainedHashTable<Key, Value, Hash, Sizing>::get_stripe_count() const { return m_stripe_count; }
+
+template <typename Key, typename Value, typename Hash, typename Sizing>
+size_t ConcurrentChainedHashTable<Key, Value, Hash, Sizing>::bucket_count() const { return m_table.load()->sizing.size(); }
+
+template <typename Key, typename Value, typename Hash, typename Sizing>
+long long ConcurrentChainedHashTable<Key, Value, Hash, Sizing>::get_resizes() const { return resizes.load(); }
+
+template <typename Key, typename Value, typename Hash, typename Sizing>
+long long ConcurrentChainedHashTable<Key, Value, Hash, Sizing>::get_retries() const { return retries.load(); }
+
+#endif
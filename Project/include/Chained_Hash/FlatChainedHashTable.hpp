@@ -0,0 +1,414 @@
+#ifndef FLAT_CHAINED_HASHTABLE_HPP
+#define FLAT_CHAINED_HASHTABLE_HPP
+
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <utility>
+#include <functional>
+#include <algorithm>
+#include <stdexcept>
+
+#include "../Dictionaty/IDictionary.hpp"
+
+/**
+ * @brief Tabela hash com encadeamento separado em memória contígua.
+ *
+ * Tem a mesma semântica de ChainedHashTable (chaves únicas, inserção no fim da lista do slot,
+ * rehash para o próximo primo maior que o dobro quando o fator de carga é atingido), mas em vez de
+ * uma std::list por slot todas as entradas ficam em uma única arena (std::vector). Cada entrada
+ * guarda o índice de 32 bits da próxima entrada do mesmo slot, e cada slot guarda apenas o índice
+ * da primeira. Com isso não há uma alocação por elemento, o encadeamento custa 4 bytes em vez dos
+ * 16 dos ponteiros da lista, e entradas inseridas em sequência ficam próximas na memória.
+ *
+ * Entradas removidas entram em uma lista livre (encadeada pelo mesmo campo next) e são reutilizadas
+ * pelas próximas inserções. O rehash apenas refaz o encadeamento: as entradas não são copiadas.
+ *
+ * Cada entrada também guarda o hash completo da chave. Nas buscas ele é comparado antes da chave,
+ * e o rehash calcula o novo slot a partir dele, sem chamar a função de hash de novo.
+ *
+ * As métricas têm o mesmo significado da versão com listas: uma comparação por entrada visitada no
+ * slot e uma colisão por inserção em slot não vazio.
+ *
+ * @tparam Key Tipo da chave.
+ * @tparam Value Tipo do valor.
+ * @tparam Hash Functor de hash utilizado para calcular o slot das chaves.
+ */
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+class FlatChainedHashTable : public IDictionary<Key, Value> {
+private:
+    // Índice que marca o fim de uma lista (slot vazio ou última entrada)
+    static constexpr uint32_t NIL = UINT32_MAX;
+
+    // Entrada da arena: o par, o hash completo da chave e o índice da próxima entrada do mesmo slot
+    struct Entry {
+        std::pair<Key, Value> data;
+        size_t hash;
+        uint32_t next;
+    };
+
+    // quantidade de pares (chave,valor)
+    size_t m_number_of_elements;
+
+    // tamanho atual da tabela
+    size_t m_table_size;
+
+    mutable long long comparisons = 0; // contador de comparacoes, usado para analise de desempenho
+    mutable long long collisions = 0;  // contador de colisões, usado para analise de desempenho
+    mutable long long skipped = 0;     // comparacoes de chave evitadas porque o hash guardado ja era diferente
+    long long rehashes = 0;            // quantidade de redimensionamentos da tabela
+
+    // O maior valor que o fator de carga pode ter (mesma regra de ChainedHashTable)
+    float m_max_load_factor;
+
+    // índice da primeira entrada de cada slot (NIL se vazio)
+    std::vector<uint32_t> m_heads;
+
+    // arena com todas as entradas, vivas ou livres
+    std::vector<Entry> m_entries;
+
+    // início da lista de entradas livres
+    uint32_t m_free;
+
+    // referencia para a funcao de codificacao
+    Hash m_hashing;
+
+    size_t get_next_prime(size_t x);
+    size_t slot_of(size_t h) const;
+    bool matches(const Entry &e, const Key &k, size_t h) const;
+    uint32_t find_index(const Key &k) const;
+    uint32_t new_entry(const Key &k, const Value &v, size_t h);
+    void rehash(size_t m);
+    float load_factor() const;
+
+public:
+    FlatChainedHashTable(size_t tableSize = 19, float load_factor = 1.0);
+
+    bool isEmpty() const override;
+    bool contains(const Key &k) const override;
+    void add(const Key &k, const Value &v) override;
+    void remove(const Key &k) override;
+    size_t size() const override;
+    const Value& get(const Key &k) const override;
+
+    long long get_comparisons() const override;
+    long long get_collisions() const override;
+    long long get_skipped_comparisons() const;
+    size_t get_node_bytes() const override;
+    long long get_colors() const override;
+    long long get_rotations() const override;
+    long long get_rehashes() const override;
+    void reserve(size_t n) override;
+    std::vector<Key> get_all_keys_sorted() const override;
+};
+
+/**
+ * @brief Construtor: cria uma tabela hash com um numero primo de slots, todos vazios.
+ *
+ * @param tableSize := o numero de slots da tabela.
+ * @param load_factor := o maior fator de carga antes de um rehash (1.0 se nao for positivo).
+ */
+template <typename Key, typename Value, typename Hash>
+FlatChainedHashTable<Key, Value, Hash>::FlatChainedHashTable(size_t tableSize, float load_factor)
+    : m_number_of_elements(0), m_free(NIL) {
+
+    m_table_size = get_next_prime(tableSize);
+    m_heads.assign(m_table_size, NIL);
+    m_max_load_factor = load_factor <= 0 ? 1.0f : load_factor;
+}
+
+/**
+ * @brief Retorna o menor numero primo que eh maior que ou igual a x e maior que 2.
+ */
+template <typename Key, typename Value, typename Hash>
+size_t FlatChainedHashTable<Key, Value, Hash>::get_next_prime(size_t x) {
+    if (x <= 2)
+        return 3;
+
+    x = (x % 2 == 0) ? x + 1 : x;
+
+    bool not_prime = true;
+    while (not_prime) {
+        not_prime = false;
+
+        for (size_t i = 3; i <= sqrt(x); i += 2) {
+            if (x % i == 0) {
+                not_prime = true;
+                break;
+            }
+        }
+        x += 2;
+    }
+    return x - 2;
+}
+
+/**
+ * @brief Retorna o slot de um codigo hash, no intervalo [0 ... m_table_size-1] (metodo da divisao).
+ */
+template <typename Key, typename Value, typename Hash>
+size_t FlatChainedHashTable<Key, Value, Hash>::slot_of(size_t h) const {
+    return h % m_table_size;
+}
+
+/**
+ * @brief Retorna true se a entrada e guarda a chave k, cujo hash completo eh h.
+ * A chave so eh comparada quando os hashes coincidem; caso contrario conta uma comparacao evitada.
+ */
+template <typename Key, typename Value, typename Hash>
+bool FlatChainedHashTable<Key, Value, Hash>::matches(const Entry &e, const Key &k, size_t h) const {
+    if (e.hash != h) {
+        skipped++;
+        return false;
+    }
+    return e.data.first == k;
+}
+
+/**
+ * @brief retorna o valor do fator de carga atual
+ */
+template <typename Key, typename Value, typename Hash>
+float FlatChainedHashTable<Key, Value, Hash>::load_factor() const {
+    return static_cast<float>(m_number_of_elements) / m_table_size;
+}
+
+/**
+ * @brief Percorre a lista do slot de k e retorna o indice da entrada com essa chave, ou NIL.
+ * Conta uma comparacao por entrada visitada.
+ */
+template <typename Key, typename Value, typename Hash>
+uint32_t FlatChainedHashTable<Key, Value, Hash>::find_index(const Key &k) const {
+    size_t h = m_hashing(k);
+    for (uint32_t i = m_heads[slot_of(h)]; i != NIL; i = m_entries[i].next) {
+        comparisons++; // incrementa o contador de comparações
+        if (matches(m_entries[i], k, h)) {
+            return i;
+        }
+    }
+    return NIL;
+}
+
+/**
+ * @brief Obtem uma entrada para o par (k, v): reutiliza a primeira entrada livre ou cresce a arena.
+ *
+ * @return uint32_t := indice da entrada, ainda fora de qualquer lista
+ */
+template <typename Key, typename Value, typename Hash>
+uint32_t FlatChainedHashTable<Key, Value, Hash>::new_entry(const Key &k, const Value &v, size_t h) {
+    if (m_free != NIL) {
+        uint32_t index = m_free;
+        m_free = m_entries[index].next;
+        m_entries[index].data.first = k;
+        m_entries[index].data.second = v;
+        m_entries[index].hash = h;
+        m_entries[index].next = NIL;
+        return index;
+    }
+
+    if (m_entries.size() >= NIL) {
+        throw std::length_error("FlatChainedHashTable: limite de entradas de 32 bits atingido");
+    }
+    m_entries.push_back(Entry{std::make_pair(k, v), h, NIL});
+    return static_cast<uint32_t>(m_entries.size() - 1);
+}
+
+/**
+ * @brief Insere um novo elemento ou atualiza o valor de uma chave existente.
+ * Se o fator de carga atingiu m_max_load_factor, a tabela eh antes redimensionada para o
+ * dobro do tamanho. A nova entrada vai para o fim da lista do slot, como em ChainedHashTable.
+ *
+ * @param k := chave
+ * @param v := valor
+ */
+template <typename Key, typename Value, typename Hash>
+void FlatChainedHashTable<Key, Value, Hash>::add(const Key &k, const Value &v) {
+
+    if (load_factor() >= m_max_load_factor) {
+        rehash(2 * m_table_size);
+    }
+
+    size_t h = m_hashing(k);
+    size_t slot = slot_of(h);
+
+    uint32_t last = NIL;
+    for (uint32_t i = m_heads[slot]; i != NIL; i = m_entries[i].next) {
+        comparisons++; // incrementa o contador de comparações
+        if (matches(m_entries[i], k, h)) {
+            m_entries[i].data.second = v; // se a chave ja existe, atualiza o valor
+            return;
+        }
+        last = i;
+    }
+
+    uint32_t index = new_entry(k, v, h);
+    if (last == NIL) {
+        m_heads[slot] = index;
+    } else {
+        collisions++; // slot nao vazio: incrementa o contador de colisões
+        m_entries[last].next = index;
+    }
+    m_number_of_elements++;
+}
+
+/**
+ * @brief Retorna true se e somente se a chave k estiver presente na tabela hash.
+ */
+template <typename Key, typename Value, typename Hash>
+bool FlatChainedHashTable<Key, Value, Hash>::contains(const Key &k) const {
+    return find_index(k) != NIL;
+}
+
+/**
+ * @brief Retorna uma referencia para o valor associado a chave k.
+ * Se k nao estiver na tabela, a funcao lanca uma out_of_range exception.
+ * A referencia deixa de ser valida apos uma insercao que faca a arena crescer.
+ */
+template <typename Key, typename Value, typename Hash>
+const Value& FlatChainedHashTable<Key, Value, Hash>::get(const Key &k) const {
+    uint32_t index = find_index(k);
+    if (index == NIL) {
+        throw std::out_of_range("A chave nao existe na tabela hash");
+    }
+    return m_entries[index].data.second;
+}
+
+/**
+ * @brief Remove da tabela o elemento com chave k; a entrada vai para a lista livre.
+ * Se k nao estiver na tabela, a funcao lanca uma out_of_range exception.
+ *
+ * @param k := chave a ser removida
+ */
+template <typename Key, typename Value, typename Hash>
+void FlatChainedHashTable<Key, Value, Hash>::remove(const Key &k) {
+
+    size_t h = m_hashing(k);
+    uint32_t* link = &m_heads[slot_of(h)]; // campo que aponta para a entrada corrente
+
+    while (*link != NIL) {
+        uint32_t index = *link;
+        comparisons++; // incrementa o contador de comparações
+        if (matches(m_entries[index], k, h)) {
+            *link = m_entries[index].next; // desliga a entrada da lista do slot
+            m_entries[index].next = m_free;
+            m_free = index;
+            m_number_of_elements--;
+            return;
+        }
+        link = &m_entries[index].next;
+    }
+
+    throw std::out_of_range("Chave nao encontrada para remocao");
+}
+
+/**
+ * @brief Faz com que o tamanho da tabela seja um numero primo maior ou igual a m.
+ * Se m for maior que o tamanho atual, todas as entradas sao reencadeadas nos novos slots,
+ * preservando a ordem relativa; nenhuma entrada eh copiada, nenhum hash eh recalculado (o slot
+ * vem do hash guardado) e nenhuma comparacao eh feita, pois as chaves ja sao unicas.
+ * Caso contrario, a funcao nao tem efeito.
+ *
+ * @param m := o novo tamanho da tabela hash
+ */
+template <typename Key, typename Value, typename Hash>
+void FlatChainedHashTable<Key, Value, Hash>::rehash(size_t m) {
+
+    size_t new_table_size = get_next_prime(m);
+    if (new_table_size <= m_table_size) {
+        return;
+    }
+
+    std::vector<uint32_t> old_heads(new_table_size, NIL);
+    old_heads.swap(m_heads);
+    m_table_size = new_table_size;
+    rehashes++;
+
+    std::vector<uint32_t> tails(new_table_size, NIL); // ultima entrada de cada novo slot
+    for (uint32_t head : old_heads) {
+        uint32_t i = head;
+        while (i != NIL) {
+            uint32_t next = m_entries[i].next;
+            size_t slot = slot_of(m_entries[i].hash);
+
+            m_entries[i].next = NIL;
+            if (tails[slot] == NIL) {
+                m_heads[slot] = i;
+            } else {
+                m_entries[tails[slot]].next = i;
+            }
+            tails[slot] = i;
+            i = next;
+        }
+    }
+}
+
+/**
+ * @brief Prepara a tabela para n elementos: redimensiona os slots de uma vez (mesma regra de
+ * ChainedHashTable::reserve) e reserva a arena, para que as inserções nao realoquem m_entries.
+ *
+ * @param n := numero de elementos
+ */
+template <typename Key, typename Value, typename Hash>
+void FlatChainedHashTable<Key, Value, Hash>::reserve(size_t n) {
+
+    if (n > m_table_size * m_max_load_factor) {
+        rehash(n / m_max_load_factor);
+    }
+    m_entries.reserve(n);
+}
+
+/**
+ * @brief Retorna todas as chaves presentes na tabela, ordenadas.
+ */
+template <typename Key, typename Value, typename Hash>
+std::vector<Key> FlatChainedHashTable<Key, Value, Hash>::get_all_keys_sorted() const {
+    std::vector<Key> keys;
+    keys.reserve(m_number_of_elements);
+
+    for (uint32_t head : m_heads) {
+        for (uint32_t i = head; i != NIL; i = m_entries[i].next) {
+            keys.push_back(m_entries[i].data.first);
+        }
+    }
+
+    std::sort(keys.begin(), keys.end());
+    return keys;
+}
+
+/**
+ * @brief Retorna o numero de elementos na tabela hash
+ */
+template <typename Key, typename Value, typename Hash>
+size_t FlatChainedHashTable<Key, Value, Hash>::size() const {
+    return m_number_of_elements;
+}
+
+/**
+ * @brief Retorna um booleano indicando se a tabela esta vazia
+ */
+template <typename Key, typename Value, typename Hash>
+bool FlatChainedHashTable<Key, Value, Hash>::isEmpty() const {
+    return m_number_of_elements == 0;
+}
+
+// Getters para as métricas
+template <typename Key, typename Value, typename Hash>
+long long FlatChainedHashTable<Key, Value, Hash>::get_comparisons() const { return comparisons; }
+
+template <typename Key, typename Value, typename Hash>
+long long FlatChainedHashTable<Key, Value, Hash>::get_collisions() const { return collisions; }
+
+template <typename Key, typename Value, typename Hash>
+long long FlatChainedHashTable<Key, Value, Hash>::get_skipped_comparisons() const { return skipped; }
+
+template <typename Key, typename Value, typename Hash>
+size_t FlatChainedHashTable<Key, Value, Hash>::get_node_bytes() const { return sizeof(Entry); } // Entrada da arena: par, hash e índice de 32 bits
+
+template <typename Key, typename Value, typename Hash>
+long long FlatChainedHashTable<Key, Value, Hash>::get_colors() const { return 0; } // Não utilizado na tabela hash
+
+template <typename Key, typename Value, typename Hash>
+long long FlatChainedHashTable<Key, Value, Hash>::get_rotations() const { return 0; } // Não utilizado na tabela hash
+
+template <typename Key, typename Value, typename Hash>
+long long FlatChainedHashTable<Key, Value, Hash>::get_rehashes() const { return rehashes; }
+#endif
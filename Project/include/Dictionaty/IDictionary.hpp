@@ -97,5 +97,29 @@ public:
      * @return Número de colisões.
      */
     virtual long long get_collisions() const = 0;
+
+    /**
+     * @brief Retorna o tamanho em bytes de cada nó (ou entrada) que guarda um elemento.
+     * 
+     * @return Bytes por nó.
+     */
+    virtual size_t get_node_bytes() const = 0;
+
+    /**
+     * @brief Prepara o dicionário para receber n elementos sem crescer no meio da ingestão.
+     *
+     * Nas tabelas hash a tabela é redimensionada de uma vez para o tamanho adequado a n elementos;
+     * nas árvores com pool de nós os blocos são alocados antecipadamente. Nunca reduz a capacidade.
+     *
+     * @param n Número de elementos esperado.
+     */
+    virtual void reserve(size_t n) = 0;
+
+    /**
+     * @brief Retorna o número de redimensionamentos (rehash) realizados (útil para tabelas hash).
+     *
+     * @return Número de redimensionamentos.
+     */
+    virtual long long get_rehashes() const = 0;
 };
 #endif
\ No newline at end of file
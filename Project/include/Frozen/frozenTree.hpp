@@ -0,0 +1,286 @@
+#ifndef FROZEN_TREE_HPP
+#define FROZEN_TREE_HPP
+
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "../Dictionaty/IDictionary.hpp"
+#include "../utils/threeWayCompare.hpp"
+
+/**
+ * @brief Estrutura de busca imutável, otimizada para leitura, gerada por AVL::freeze() e RB::freeze().
+ *
+ * As chaves ficam em um vetor contíguo na ordem de Eytzinger (BFS): a raiz está na posição 1 e os
+ * filhos do nó i estão em 2i e 2i+1. Os valores ficam em um vetor paralelo, de modo que a descida
+ * toca apenas as chaves. A busca não tem desvios dependentes do resultado da comparação
+ * (i = 2i + (chave[i] < k)) e pré-carrega os quatro netos do nó corrente, que são contíguos
+ * (posições 4i a 4i+3), enquanto a comparação atual é feita.
+ *
+ * A estrutura implementa a API de leitura de IDictionary; add e remove lançam std::logic_error.
+ * Um iterador percorre os pares em ordem crescente de chave.
+ *
+ * @tparam Key Tipo da chave.
+ * @tparam Value Tipo do valor.
+ * @tparam Compare Política de comparação em três vias (padrão: ThreeWayCompare<Key>).
+ */
+template <typename Key, typename Value, typename Compare = ThreeWayCompare<Key>>
+class FrozenTree : public IDictionary<Key, Value> {
+private:
+    std::vector<Key> m_keys;     // chaves em ordem de Eytzinger (posição 0 não utilizada)
+    std::vector<Value> m_values; // valores paralelos a m_keys
+    size_t m_size = 0;
+    Compare m_compare;
+
+    mutable long long comparisons = 0; // contador de comparações, usado para analise de desempenho
+
+    void build(std::vector<std::pair<Key, Value>>& sorted, size_t& next, size_t i);
+    size_t find_index(const Key& key) const;
+    size_t first_index() const;
+    size_t next_index(size_t i) const;
+
+public:
+    /**
+     * @brief Iterador de leitura que percorre os pares em ordem crescente de chave.
+     *
+     * O percurso em ordem é feito apenas com aritmética de índices sobre o layout de Eytzinger.
+     */
+    class const_iterator {
+    private:
+        const FrozenTree* m_tree = nullptr;
+        size_t m_index = 0; // 0 representa end()
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::pair<const Key&, const Value&>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = value_type;
+
+        const_iterator() = default;
+        const_iterator(const FrozenTree* tree, size_t index) : m_tree(tree), m_index(index) {}
+
+        const Key& key() const { return m_tree->m_keys[m_index]; }
+        const Value& value() const { return m_tree->m_values[m_index]; }
+        reference operator*() const { return reference(key(), value()); }
+
+        const_iterator& operator++() {
+            m_index = m_tree->next_index(m_index);
+            return *this;
+        }
+
+        const_iterator operator++(int) {
+            const_iterator old = *this;
+            ++(*this);
+            return old;
+        }
+
+        bool operator==(const const_iterator& other) const { return m_index == other.m_index; }
+        bool operator!=(const const_iterator& other) const { return m_index != other.m_index; }
+    };
+
+    FrozenTree() : m_keys(1), m_values(1) {}
+    explicit FrozenTree(std::vector<std::pair<Key, Value>> sorted);
+
+    const_iterator begin() const { return const_iterator(this, first_index()); }
+    const_iterator end() const { return const_iterator(this, 0); }
+    const_iterator find(const Key& key) const { return const_iterator(this, find_index(key)); }
+
+    void add(const Key& key, const Value& value) override;
+    void remove(const Key& key) override;
+    bool contains(const Key& key) const override;
+    bool isEmpty() const override;
+    size_t size() const override;
+    const Value& get(const Key& key) const override;
+    std::vector<Key> get_all_keys_sorted() const override;
+
+    long long get_comparisons() const override;
+    long long get_rotations() const override;
+    long long get_colors() const override;
+    long long get_collisions() const override;
+    size_t get_node_bytes() const override;
+    long long get_rehashes() const override;
+    void reserve(size_t) override {} // estrutura imutável: o tamanho é fixado na construção
+};
+
+/**
+ * @brief Constrói a estrutura congelada a partir de pares já ordenados por chave e sem repetições.
+ *
+ * @param sorted Pares (chave, valor) em ordem crescente, como os produzidos por um percurso in-ordem.
+ */
+template <typename Key, typename Value, typename Compare>
+FrozenTree<Key, Value, Compare>::FrozenTree(std::vector<std::pair<Key, Value>> sorted)
+    : m_keys(sorted.size() + 1), m_values(sorted.size() + 1), m_size(sorted.size()) {
+    size_t next = 0;
+    build(sorted, next, 1);
+}
+
+/**
+ * @brief Preenche recursivamente as posições de Eytzinger com os pares ordenados.
+ *
+ * Um percurso in-ordem sobre os índices implícitos (2i, i, 2i+1) visita as posições na mesma
+ * ordem das chaves ordenadas, então basta consumir o vetor sequencialmente.
+ *
+ * @param sorted Pares ordenados (movidos para os vetores internos).
+ * @param next Próximo par a ser consumido.
+ * @param i Posição de Eytzinger corrente.
+ */
+template <typename Key, typename Value, typename Compare>
+void FrozenTree<Key, Value, Compare>::build(std::vector<std::pair<Key, Value>>& sorted, size_t& next, size_t i) {
+    if (i > m_size) return;
+
+    build(sorted, next, 2 * i);
+    m_keys[i] = std::move(sorted[next].first);
+    m_values[i] = std::move(sorted[next].second);
+    next++;
+    build(sorted, next, 2 * i + 1);
+}
+
+/**
+ * @brief Localiza a posição da chave com descida sem desvios.
+ *
+ * A descida calcula o limite inferior (primeira chave >= key): cada passo vai para 2i se
+ * chave[i] >= key e para 2i+1 caso contrário. Ao sair da árvore, os bits 1 finais de i indicam
+ * os passos para a direita dados depois do último passo para a esquerda; descartá-los (junto com
+ * esse último passo) recupera a posição do limite inferior. Uma comparação final confirma a igualdade.
+ *
+ * @param key Chave a ser buscada.
+ * @return size_t Posição de Eytzinger da chave ou 0 se ela não existir.
+ */
+template <typename Key, typename Value, typename Compare>
+size_t FrozenTree<Key, Value, Compare>::find_index(const Key& key) const {
+    const Key* keys = m_keys.data();
+    size_t i = 1;
+
+    while (i <= m_size) {
+#if defined(__GNUC__)
+        __builtin_prefetch(keys + 4 * i); // netos 4i..4i+3 são contíguos
+#endif
+        comparisons++; // incrementa o contador de comparações
+        i = 2 * i + (m_compare(keys[i], key) < 0);
+    }
+
+    // Descarta os passos à direita finais e o último passo à esquerda.
+#if defined(__GNUC__)
+    i >>= __builtin_ffsll(static_cast<long long>(~i));
+#else
+    while (i & 1) i >>= 1;
+    i >>= 1;
+#endif
+
+    if (i == 0) return 0;
+
+    comparisons++; // incrementa o contador de comparações
+    return m_compare(keys[i], key) == 0 ? i : 0;
+}
+
+/**
+ * @brief Retorna a posição da menor chave (o nó mais à esquerda) ou 0 se estiver vazia.
+ */
+template <typename Key, typename Value, typename Compare>
+size_t FrozenTree<Key, Value, Compare>::first_index() const {
+    if (m_size == 0) return 0;
+
+    size_t i = 1;
+    while (2 * i <= m_size) i = 2 * i;
+    return i;
+}
+
+/**
+ * @brief Retorna a posição do sucessor em ordem de i, ou 0 se i for o último.
+ *
+ * Se existe subárvore direita, o sucessor é o seu nó mais à esquerda. Caso contrário, sobe
+ * enquanto i for filho direito e então mais um nível.
+ */
+template <typename Key, typename Value, typename Compare>
+size_t FrozenTree<Key, Value, Compare>::next_index(size_t i) const {
+    if (2 * i + 1 <= m_size) {
+        i = 2 * i + 1;
+        while (2 * i <= m_size) i = 2 * i;
+        return i;
+    }
+
+    while (i & 1) i >>= 1;
+    return i >> 1;
+}
+
+/**
+ * @brief Operação não suportada: a estrutura congelada é somente leitura.
+ *
+ * @throws std::logic_error Sempre.
+ */
+template <typename Key, typename Value, typename Compare>
+void FrozenTree<Key, Value, Compare>::add(const Key&, const Value&) {
+    throw std::logic_error("Dicionario congelado e somente leitura");
+}
+
+/**
+ * @brief Operação não suportada: a estrutura congelada é somente leitura.
+ *
+ * @throws std::logic_error Sempre.
+ */
+template <typename Key, typename Value, typename Compare>
+void FrozenTree<Key, Value, Compare>::remove(const Key&) {
+    throw std::logic_error("Dicionario congelado e somente leitura");
+}
+
+/**
+ * @brief Verifica se a chave está presente.
+ */
+template <typename Key, typename Value, typename Compare>
+bool FrozenTree<Key, Value, Compare>::contains(const Key& key) const {
+    return find_index(key) != 0;
+}
+
+/**
+ * @brief Retorna o valor associado à chave.
+ *
+ * @throws std::runtime_error Se a chave não existir (mesmo comportamento das árvores de origem).
+ */
+template <typename Key, typename Value, typename Compare>
+const Value& FrozenTree<Key, Value, Compare>::get(const Key& key) const {
+    size_t i = find_index(key);
+    if (i == 0) {
+        throw std::runtime_error("Chave não encontrada");
+    }
+    return m_values[i];
+}
+
+/**
+ * @brief Retorna todas as chaves em ordem crescente, usando o iterador em ordem.
+ */
+template <typename Key, typename Value, typename Compare>
+std::vector<Key> FrozenTree<Key, Value, Compare>::get_all_keys_sorted() const {
+    std::vector<Key> keys;
+    keys.reserve(m_size);
+    for (auto it = begin(); it != end(); ++it) {
+        keys.push_back(it.key());
+    }
+    return keys;
+}
+
+template <typename Key, typename Value, typename Compare>
+bool FrozenTree<Key, Value, Compare>::isEmpty() const { return m_size == 0; }
+
+template <typename Key, typename Value, typename Compare>
+size_t FrozenTree<Key, Value, Compare>::size() const { return m_size; }
+
+template <typename Key, typename Value, typename Compare>
+long long FrozenTree<Key, Value, Compare>::get_comparisons() const { return comparisons; }
+
+template <typename Key, typename Value, typename Compare>
+long long FrozenTree<Key, Value, Compare>::get_rotations() const { return 0; } // estrutura imutável: não há rotações
+
+template <typename Key, typename Value, typename Compare>
+long long FrozenTree<Key, Value, Compare>::get_colors() const { return 0; } // estrutura imutável: não há cores
+
+template <typename Key, typename Value, typename Compare>
+long long FrozenTree<Key, Value, Compare>::get_collisions() const { return 0; } // não há colisões em uma árvore
+
+template <typename Key, typename Value, typename Compare>
+size_t FrozenTree<Key, Value, Compare>::get_node_bytes() const { return sizeof(Key) + sizeof(Value); } // sem ponteiros: só chave e valor
+
+template <typename Key, typename Value, typename Compare>
+long long FrozenTree<Key, Value, Compare>::get_rehashes() const { return 0; } // não há tabela a redimensionar
+
+#endif
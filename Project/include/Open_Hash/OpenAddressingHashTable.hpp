@@ -3,11 +3,15 @@
 
 #include <vector>
 #include <utility>
+#include <algorithm>
 #include <stdexcept>
 #include <functional>
 #include <iostream>
 #include "../Dictionaty/IDictionary.hpp"
 #include "../utils/lexicalStr.hpp"
+#include "../utils/sizingPolicy.hpp"
+#include "../utils/probingPolicy.hpp"
+#include "../utils/slotLayout.hpp"
 
 /**
  * @brief Tabela hash com endereçamento aberto utilizando duplo hash.
@@ -18,6 +22,14 @@
  * @tparam Key Tipo da chave.
  * @tparam Value Tipo do valor associado à chave.
  * @tparam Hash Functor de hash a ser utilizado (padrão: std::hash<Key>).
+ * @tparam Sizing Política de dimensionamento (ver sizingPolicy.hpp): escolhe o número de slots e reduz
+ *         o hash ao índice inicial. O padrão usa tamanhos primos (PrimeTableSizing), com os quais
+ *         qualquer passo do duplo hash cobre a tabela, mesmo depois dos rehash por dobra.
+ * @tparam Probing Política de sondagem (ver probingPolicy.hpp): duplo hash (padrão), linear ou
+ *         triangular. Todas visitam cada slot uma vez antes de repetir algum.
+ * @tparam Layout Disposição dos slots em memória (ver slotLayout.hpp): vetor de structs (padrão,
+ *         InterleavedSlots) ou vetores separados de controle, hashes, chaves e valores (SplitSlots),
+ *         com o qual a sondagem lê só um byte por slot visitado.
  *
  * Funcionalidades principais:
  * - Inserção, remoção e busca de pares chave-valor.
@@ -26,9 +38,19 @@
  *
  * Detalhes de implementação:
  * - Cada slot da tabela pode estar em um dos estados: VAZIO, OCUPADO ou REMOVIDO.
- * - O duplo hash utiliza duas funções de hash para calcular o índice inicial e o passo de sondagem.
+ * - O duplo hash calcula o índice inicial e o passo de sondagem a partir do hash completo; o passo é
+ *   sempre primo com o tamanho da tabela, então a sondagem cobre a tabela inteira.
  * - O método find_slot localiza o índice apropriado para inserção ou busca.
- * - O método rehash é chamado automaticamente quando o fator de carga máximo é atingido.
+ * - O método rehash é chamado automaticamente quando o fator de carga máximo é atingido. Os slots
+ *   ocupados são movidos (nunca copiados) para a tabela nova por place(), sem comparar chaves; o purge
+ *   no mesmo tamanho é feito no próprio vetor, sem alocar memória (ver purge_in_place()).
+ * - Os slots removidos (tombstones) contam para o fator de carga, pois alongam as sondagens como
+ *   slots ocupados. Quando eles são maioria, a tabela é reconstruída no mesmo tamanho (purge),
+ *   descartando-os, em vez de dobrar; inserções reaproveitam o primeiro removido da sondagem.
+ * - Cada slot guarda o hash completo da chave: as sondagens comparam o hash antes da chave,
+ *   e o rehash reposiciona os elementos a partir dele, sem recalcular a função de hash.
+ * - Opcionalmente o rehash é incremental (enable_incremental_rehash): a tabela antiga é mantida
+ *   ao lado da nova e migrada aos poucos pelas operações de escrita.
  *
  * Métodos públicos:
  * - add(const Key&, const Value&): Insere ou atualiza um elemento.
@@ -38,47 +60,44 @@
  * - size(), empty(): Consultam o estado da tabela.
  * - get_comparisons(), get_collisions(): Retornam métricas de desempenho.
  */
-template <typename Key, typename Value, typename Hash = std::hash<Key>>
+template <typename Key, typename Value, typename Hash = std::hash<Key>, typename Sizing = PrimeTableSizing,
+          typename Probing = DoubleHashProbing, typename Layout = InterleavedSlots>
 class OpenAddressingHashTable : public IDictionary<Key, Value>
 {
 private:
-    // Enum para o estado de cada slot
-    enum class SlotStatus
-    {
-        EMPTY,
-        OCCUPIED,
-        DELETED
-    };
-
-    // Struct para cada slot da tabela
-    struct HashSlot
-    {
-        std::pair<Key, Value> data;
-        SlotStatus status = SlotStatus::EMPTY;
-    };
+    // Vetor de slots; cada slot guarda o par chave-valor, o hash completo e o estado (ver slotLayout.hpp)
+    using Slots = typename Layout::template Slots<Key, Value>;
 
     // Membros da classe
     size_t m_table_size;
+    Sizing m_sizing;     // Política de dimensionamento da tabela atual
+    Sizing m_old_sizing; // e da tabela antiga, durante um rehash incremental
     size_t m_number_of_elements;
+    size_t m_deleted = 0; // Slots removidos (tombstones) na tabela atual
     float m_max_load_factor;
-    std::vector<HashSlot> m_table;
+    Slots m_table;
     Hash m_hashing;
 
+    // Rehash incremental: enquanto m_old_table não estiver vazia, os slots ainda não migrados
+    // da tabela antiga continuam válidos e são consultados depois da tabela nova.
+    Slots m_old_table;
+    size_t m_migrate_pos = 0;  // Próximo slot da tabela antiga a ser migrado
+    size_t m_migrate_step = 0; // Slots migrados por operação de escrita (0 = rehash de uma vez)
+
     // Métricas de desempenho
     mutable long long comparisons = 0;
     mutable long long collisions = 0;
-
-    // Constante para o passo de sondagem no duplo hash
-    // Usamos um número primo para reduzir colisões
-    // HASH_PRIME é um número primo menor que o tamanho da tabela
-    // Isso ajuda a garantir uma distribuição mais uniforme dos índices
-    // e a evitar padrões de colisão que podem ocorrer com números pares.
-    static const size_t HASH_PRIME = 13;
-
-    size_t hash_code(const Key &k) const;
-    size_t hash_code2(const Key &k) const;
-    size_t find_slot(const Key &k) const;
+    mutable long long skipped = 0; // Comparações de chave evitadas porque o hash guardado já era diferente
+    long long rehashes = 0; // Quantidade de redimensionamentos da tabela
+    long long purges = 0;   // Rehash no mesmo tamanho para descartar slots removidos
+
+    size_t hash_code(size_t h) const;
+    size_t find_slot(const Slots &table, const Sizing &sizing, const Key &k, size_t h) const;
+    bool found(const Slots &table, size_t index, const Key &k, size_t h) const;
+    void place(Slots &from, size_t index);
+    void purge_in_place();
     void rehash(size_t new_size);
+    void migrate(size_t slots);
 
 public:
 
@@ -86,6 +105,9 @@ public:
 
     
     void clear();
+    void enable_incremental_rehash(size_t slots_per_op = 16);
+    bool is_rehashing() const;
+    void reserve(size_t n) override;
     bool contains(const Key &k) const override;
     bool isEmpty() const override;
     void add(const Key &k, const Value &v) override;
@@ -97,8 +119,14 @@ public:
     // Getters e funções de status
     long long get_comparisons() const override;// Retorna o número de comparações realizadas
     long long get_collisions() const override; // Retorna o número de colisões ocorridas
+    long long get_skipped_comparisons() const; // Retorna o número de comparações de chave evitadas pelo hash guardado
+    size_t get_node_bytes() const override;    // Retorna o tamanho de cada posição da tabela
     long long get_colors() const override; // Função que retorna o número de troca de cores, essa ED não possui
     long long get_rotations() const override; // Função que retorna o número de rotações, essa ED não possui
+    long long get_rehashes() const override; // Retorna o número de redimensionamentos da tabela
+    long long get_purges() const;           // Retorna o número de rehash no mesmo tamanho para descartar removidos
+    size_t get_tombstones() const;          // Retorna o número de slots removidos na tabela atual
+    double get_tombstone_ratio() const;     // Retorna a fração dos slots da tabela atual que estão removidos
 };
 
 /**
@@ -113,16 +141,18 @@ public:
  * @note Este método pressupõe que o tipo Key seja compatível com a ordenação lexicográfica e, 
  *       caso utilize strings, que seja possível acessar os dados brutos via get().data() e get().size().
  */
-template <typename Key, typename Value, typename Hash>
-std::vector<Key> OpenAddressingHashTable<Key, Value, Hash>::get_all_keys_sorted() const {
+template <typename Key, typename Value, typename Hash, typename Sizing, typename Probing, typename Layout>
+std::vector<Key> OpenAddressingHashTable<Key, Value, Hash, Sizing, Probing, Layout>::get_all_keys_sorted() const {
     std::vector<Key> keys;
     if (this->isEmpty()) return keys;
 
     keys.reserve(this->size());
 
-    for (const auto& slot : m_table) {
-        if (slot.status == SlotStatus::OCCUPIED) {
-            keys.push_back(slot.data.first);
+    for (const auto* table : {&m_table, &m_old_table}) {
+        for (size_t i = 0; i < table->size(); ++i) {
+            if (table->status(i) == SlotStatus::OCCUPIED) {
+                keys.push_back(table->key(i));
+            }
         }
     }
 
@@ -132,77 +162,260 @@ std::vector<Key> OpenAddressingHashTable<Key, Value, Hash>::get_all_keys_sorted(
 }
 
 // Função de hash para calcular o índice inicial
-// A função de hash é aplicada à chave e o resultado é reduzido pelo tamanho da tabela
+// O hash completo da chave (h) é reduzido a um índice da tabela pela política de dimensionamento
 // Isso garante que o índice esteja sempre dentro dos limites da tabela
-template <typename Key, typename Value, typename Hash>
-size_t OpenAddressingHashTable<Key, Value, Hash>::hash_code(const Key &k) const
-{
-    return m_hashing(k) % m_table_size;
-}
-
-// Função de hash para calcular o passo de sondagem
-// O passo de sondagem é calculado como o complemento do hash mod HASH_PRIME
-// Isso ajuda a distribuir as sondagens de forma mais uniforme, reduzindo colisões
-// O uso de um número primo como HASH_PRIME é uma prática comum em tabelas
-// hash para melhorar a distribuição dos índices.
-template <typename Key, typename Value, typename Hash>
-size_t OpenAddressingHashTable<Key, Value, Hash>::hash_code2(const Key &k) const
+template <typename Key, typename Value, typename Hash, typename Sizing, typename Probing, typename Layout>
+size_t OpenAddressingHashTable<Key, Value, Hash, Sizing, Probing, Layout>::hash_code(size_t h) const
 {
-    return HASH_PRIME - (m_hashing(k) % HASH_PRIME);
+    return m_sizing.index(h);
 }
 
-// Função para encontrar o slot correto
-template <typename Key, typename Value, typename Hash>
-size_t OpenAddressingHashTable<Key, Value, Hash>::find_slot(const Key &k) const
+// Função para encontrar, em table (a tabela atual ou a antiga, com a sua política sizing), o slot correto da chave k, cujo hash completo é h
+// Retorna o slot da chave ou, se ela não estiver na tabela, o primeiro slot removido da sondagem
+// (que a inserção reaproveita) ou, não havendo removido, o primeiro slot vazio
+// A política de sondagem visita cada slot uma vez; se a tabela inteira for percorrida sem encontrar
+// a chave nem um slot livre (todos ocupados), retorna table.size()
+// A chave só é comparada em slots ocupados cujo hash guardado é igual a h
+template <typename Key, typename Value, typename Hash, typename Sizing, typename Probing, typename Layout>
+size_t OpenAddressingHashTable<Key, Value, Hash, Sizing, Probing, Layout>::find_slot(const Slots &table, const Sizing &sizing, const Key &k, size_t h) const
 {
-    size_t initial_index = hash_code(k);
-    size_t index = initial_index;
-    size_t step = hash_code2(k);
+    size_t table_size = table.size();
+    size_t first_deleted = table_size;
+    Probing probe(h, sizing);
 
-    for (size_t i = 0; i < m_table_size; ++i)
+    for (size_t i = 0; i < table_size; ++i, probe.next())
     {
+        size_t index = probe.index();
         comparisons++;
-        if (m_table[index].status == SlotStatus::EMPTY)
+        SlotStatus status = table.status(index);
+        if (status == SlotStatus::EMPTY)
+        {
+            return first_deleted < table_size ? first_deleted : index;
+        }
+        if (status == SlotStatus::DELETED)
         {
-            return index;
+            if (first_deleted == table_size)
+            {
+                first_deleted = index;
+            }
         }
-        if (m_table[index].status == SlotStatus::OCCUPIED && m_table[index].data.first == k)
+        else
         {
-            return index;
+            if (!table.matches(index, h))
+            {
+                skipped++;
+            }
+            else if (table.key(index) == k)
+            {
+                return index;
+            }
         }
-        index = (initial_index + (i + 1) * step) % m_table_size;
     }
 
-    return index; // Retorna o último slot verificado
+    return first_deleted;
+}
+
+// Verifica se o slot index de table, devolvido por find_slot, guarda a chave k (hash completo h)
+template <typename Key, typename Value, typename Hash, typename Sizing, typename Probing, typename Layout>
+bool OpenAddressingHashTable<Key, Value, Hash, Sizing, Probing, Layout>::found(const Slots &table, size_t index, const Key &k, size_t h) const
+{
+    return index < table.size() && table.status(index) == SlotStatus::OCCUPIED && table.matches(index, h) && table.key(index) == k;
 }
 
 /**
  * @brief Redimensiona (rehash) a tabela hash para um novo tamanho.
  *
- * Esta função cria uma nova tabela com o tamanho especificado e reinsere todos
- * os elementos ocupados da tabela antiga na nova. Ela reinicializa o número de
- * elementos e o contador de colisões, utilizando o método add() para reinserir
- * cada elemento, garantindo que a distribuição dos hashes seja atualizada de
- * acordo com o novo tamanho da tabela.
+ * Esta função cria uma nova tabela com o tamanho especificado e reposiciona todos
+ * os elementos ocupados da tabela antiga na nova (ver place()), movendo-os. Os contadores
+ * de comparações e colisões são mantidos: o rehash não passa por add() e não conta colisões,
+ * então as métricas continuam acumulando as operações do usuário entre redimensionamentos.
+ * Se a política de dimensionamento escolher o tamanho atual (purge), a tabela é reconstruída
+ * no próprio vetor (ver purge_in_place()), sem alocar outro.
+ *
+ * Com o rehash incremental ativo, a tabela antiga é mantida em m_old_table e apenas
+ * m_migrate_step slots são migrados agora; os demais são migrados pelas próximas
+ * escritas (ver migrate()). Um rehash pendente é concluído antes de iniciar outro.
  *
- * @param new_size Novo tamanho desejado para a tabela hash.
+ * @param new_size Novo tamanho desejado para a tabela hash (ajustado pela política de dimensionamento).
  */
-template <typename Key, typename Value, typename Hash>
-void OpenAddressingHashTable<Key, Value, Hash>::rehash(size_t new_size)
+template <typename Key, typename Value, typename Hash, typename Sizing, typename Probing, typename Layout>
+void OpenAddressingHashTable<Key, Value, Hash, Sizing, Probing, Layout>::rehash(size_t new_size)
 {
-    std::vector<HashSlot> old_table = m_table;
-    m_table.assign(new_size, HashSlot());
-    m_table_size = new_size;
-    m_number_of_elements = 0;
-    collisions = 0;
+    migrate(m_old_table.size()); // Conclui um rehash incremental pendente
 
-    for (const auto &slot : old_table)
+    Sizing new_sizing(new_size);
+    if (new_sizing.size() == m_table_size)
     {
-        if (slot.status == SlotStatus::OCCUPIED)
+        purge_in_place();
+        m_deleted = 0;
+        rehashes++;
+        return;
+    }
+
+    Slots old_table(new_sizing.size());
+    old_table.swap(m_table);
+    m_old_table.swap(old_table);
+    m_old_sizing = m_sizing;
+    m_sizing = new_sizing;
+    m_table_size = m_sizing.size();
+    m_migrate_pos = 0;
+    m_deleted = 0;
+    rehashes++;
+
+    migrate(m_migrate_step == 0 ? m_old_table.size() : m_migrate_step);
+}
+
+/**
+ * @brief Posiciona na tabela atual um elemento vindo da tabela antiga.
+ *
+ * A sondagem parte do hash guardado no slot, então a função de hash não é chamada de novo;
+ * como as chaves já são únicas, basta sondar até o primeiro slot livre, sem comparar chaves.
+ * A sondagem cobre a tabela, que nunca está cheia, então um slot livre sempre é encontrado.
+ *
+ * @param from Tabela antiga.
+ * @param index Slot ocupado de from; seu conteúdo é movido.
+ */
+template <typename Key, typename Value, typename Hash, typename Sizing, typename Probing, typename Layout>
+void OpenAddressingHashTable<Key, Value, Hash, Sizing, Probing, Layout>::place(Slots &from, size_t index)
+{
+    Probing probe(from.hash(index), m_sizing);
+    while (m_table.status(probe.index()) == SlotStatus::OCCUPIED)
+    {
+        probe.next();
+    }
+
+    if (m_table.status(probe.index()) == SlotStatus::DELETED)
+    {
+        m_deleted--;
+    }
+    m_table.move_from(from, index, probe.index());
+}
+
+/**
+ * @brief Descarta os slots removidos reconstruindo a tabela no próprio vetor, sem alocar memória.
+ *
+ * Primeiro os removidos viram vazios e os ocupados são marcados como pendentes, reaproveitando o
+ * estado DELETED. Depois cada pendente vai para o primeiro slot não definitivo da sua sondagem: se
+ * ele estiver vazio, o elemento é movido; se estiver pendente, os dois trocam de lugar e o elemento
+ * trazido é posicionado em seguida. Slots definitivos (OCCUPIED) não mudam mais, então cada elemento
+ * fica atrás apenas de slots que continuarão ocupados, e as buscas o encontram.
+ */
+template <typename Key, typename Value, typename Hash, typename Sizing, typename Probing, typename Layout>
+void OpenAddressingHashTable<Key, Value, Hash, Sizing, Probing, Layout>::purge_in_place()
+{
+    for (size_t i = 0; i < m_table_size; ++i)
+    {
+        SlotStatus status = m_table.status(i);
+        m_table.mark(i, status == SlotStatus::OCCUPIED ? SlotStatus::DELETED : SlotStatus::EMPTY);
+    }
+
+    for (size_t i = 0; i < m_table_size; ++i)
+    {
+        while (m_table.status(i) == SlotStatus::DELETED)
+        {
+            Probing probe(m_table.hash(i), m_sizing);
+            while (m_table.status(probe.index()) == SlotStatus::OCCUPIED)
+            {
+                probe.next();
+            }
+
+            size_t target = probe.index();
+            if (target == i)
+            {
+                m_table.mark(i, SlotStatus::OCCUPIED);
+            }
+            else if (m_table.status(target) == SlotStatus::EMPTY)
+            {
+                m_table.move_from(m_table, i, target);
+                m_table.mark(target, SlotStatus::OCCUPIED);
+                m_table.mark(i, SlotStatus::EMPTY);
+            }
+            else
+            {
+                m_table.swap_slots(i, target); // o pendente trazido para i é posicionado na próxima volta
+                m_table.mark(target, SlotStatus::OCCUPIED);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Migra até slots posições da tabela antiga para a atual, a partir de m_migrate_pos.
+ *
+ * Quando a última posição é migrada, a tabela antiga é liberada e o rehash termina.
+ * Sem rehash em andamento, a função não tem efeito.
+ *
+ * @param slots Número máximo de posições da tabela antiga a migrar.
+ */
+template <typename Key, typename Value, typename Hash, typename Sizing, typename Probing, typename Layout>
+void OpenAddressingHashTable<Key, Value, Hash, Sizing, Probing, Layout>::migrate(size_t slots)
+{
+    if (!is_rehashing())
+    {
+        return;
+    }
+
+    size_t end = std::min(m_old_table.size(), m_migrate_pos + slots);
+    for (; m_migrate_pos < end; ++m_migrate_pos)
+    {
+        if (m_old_table.status(m_migrate_pos) == SlotStatus::OCCUPIED)
         {
-            add(slot.data.first, slot.data.second);
+            place(m_old_table, m_migrate_pos);
+            // A cópia movida não pode continuar visível nas buscas na tabela antiga; o slot vira removido
+            // (e não vazio) para não cortar a sondagem de chaves da tabela antiga ainda não migradas
+            m_old_table.mark(m_migrate_pos, SlotStatus::DELETED);
         }
     }
+
+    if (m_migrate_pos == m_old_table.size())
+    {
+        Slots().swap(m_old_table);
+        m_migrate_pos = 0;
+    }
+}
+
+/**
+ * @brief Ativa o rehash incremental (ou o desativa, com slots_per_op = 0).
+ *
+ * Com o modo ativo, ao atingir o fator de carga a tabela nova é alocada, mas os elementos só
+ * são movidos aos poucos: cada add/remove migra até slots_per_op posições da tabela antiga, e as
+ * buscas consultam as duas tabelas até o fim da migração. Assim nenhuma inserção paga sozinha
+ * pelo rehash da tabela inteira. Ao desativar, um rehash pendente é concluído.
+ *
+ * @param slots_per_op Posições da tabela antiga migradas por operação de escrita.
+ */
+template <typename Key, typename Value, typename Hash, typename Sizing, typename Probing, typename Layout>
+void OpenAddressingHashTable<Key, Value, Hash, Sizing, Probing, Layout>::enable_incremental_rehash(size_t slots_per_op)
+{
+    m_migrate_step = slots_per_op;
+    if (m_migrate_step == 0)
+    {
+        migrate(m_old_table.size());
+    }
+}
+
+/**
+ * @brief Retorna true se um rehash incremental estiver em andamento.
+ */
+template <typename Key, typename Value, typename Hash, typename Sizing, typename Probing, typename Layout>
+bool OpenAddressingHashTable<Key, Value, Hash, Sizing, Probing, Layout>::is_rehashing() const
+{
+    return !m_old_table.empty();
+}
+
+/**
+ * @brief Redimensiona a tabela de uma vez para que n elementos caibam sem atingir o fator de carga
+ * máximo, evitando a sequência de rehash por dobra durante a ingestão. Não reduz a tabela.
+ *
+ * @param n Número de elementos esperado.
+ */
+template <typename Key, typename Value, typename Hash, typename Sizing, typename Probing, typename Layout>
+void OpenAddressingHashTable<Key, Value, Hash, Sizing, Probing, Layout>::reserve(size_t n)
+{
+    if (static_cast<float>(n) / m_table_size >= m_max_load_factor)
+    {
+        rehash(static_cast<size_t>(n / m_max_load_factor) + 1);
+    }
 }
 
 /**
@@ -213,56 +426,92 @@ void OpenAddressingHashTable<Key, Value, Hash>::rehash(size_t new_size)
  *
  * @param tableSize Número inicial de buckets na tabela hash. Padrão: 19.
  * @param max_load_factor Fator de carga máximo permitido (razão entre elementos e buckets) antes do redimensionamento. Padrão: 0.75f.
+ *        Deve estar em (0, 1]: como os removidos também contam, add() sempre deixa ao menos um slot vazio.
+ * @throws std::out_of_range Se max_load_factor estiver fora de (0, 1].
  */
-template <typename Key, typename Value, typename Hash>
-OpenAddressingHashTable<Key, Value, Hash>::OpenAddressingHashTable (size_t tableSize, float max_load_factor)
+template <typename Key, typename Value, typename Hash, typename Sizing, typename Probing, typename Layout>
+OpenAddressingHashTable<Key, Value, Hash, Sizing, Probing, Layout>::OpenAddressingHashTable (size_t tableSize, float max_load_factor)
 {
+    if (max_load_factor <= 0 || max_load_factor > 1)
+    {
+        throw std::out_of_range("invalid load factor");
+    }
     m_number_of_elements = 0;
-    m_table_size = tableSize;
+    m_sizing = Sizing(tableSize);
+    m_old_sizing = m_sizing;
+    m_table_size = m_sizing.size();
     m_max_load_factor = max_load_factor;
-    m_table.resize(m_table_size);
+    Slots(m_table_size).swap(m_table);
 }
 
 /**
  * @brief Adiciona um novo par chave-valor à tabela hash com endereçamento aberto.
  *
- * Se a razão entre o número de elementos e o tamanho da tabela atingir ou exceder
- * o fator de carga máximo permitido, a tabela é redimensionada (rehash) para o dobro
- * do tamanho atual antes de inserir o novo elemento.
+ * Se a razão entre o número de slots usados (elementos e removidos) e o tamanho da tabela
+ * atingir ou exceder o fator de carga máximo permitido, a tabela é reconstruída antes de inserir
+ * o novo elemento: no mesmo tamanho (purge) se os removidos forem ao menos tantos quanto os
+ * elementos, descartando-os, ou com o dobro do tamanho atual, caso contrário.
  *
  * A função calcula o índice inicial usando a função de hash e encontra o slot apropriado
  * para inserção. Se a chave já existir na tabela, seu valor é atualizado.
- * Caso contrário, o novo par chave-valor é inserido no slot encontrado, o status do slot
- * é atualizado para ocupado e o número de elementos é incrementado.
+ * Caso contrário, o novo par chave-valor é inserido no slot encontrado (o primeiro removido
+ * da sondagem, se houver), o status do slot é atualizado para ocupado e o número de elementos
+ * é incrementado.
  * O contador de colisões é incrementado se o slot de inserção não for o índice inicial.
+ * Durante um rehash incremental, a chave também é procurada na tabela antiga (e atualizada
+ * lá, se estiver); elementos novos vão sempre para a tabela atual.
  *
  * @param k Chave a ser inserida ou atualizada na tabela.
  * @param v Valor associado à chave.
  */
-template <typename Key, typename Value, typename Hash>
-void OpenAddressingHashTable<Key, Value, Hash>::add(const Key &k, const Value &v)
+template <typename Key, typename Value, typename Hash, typename Sizing, typename Probing, typename Layout>
+void OpenAddressingHashTable<Key, Value, Hash, Sizing, Probing, Layout>::add(const Key &k, const Value &v)
 {
-    if (static_cast<float>(m_number_of_elements + 1) / m_table_size >= m_max_load_factor)
+    migrate(m_migrate_step);
+
+    if (static_cast<float>(m_number_of_elements + m_deleted + 1) / m_table_size >= m_max_load_factor)
     {
-        rehash(2 * m_table_size);
+        if (m_deleted >= m_number_of_elements)
+        {
+            rehash(m_table_size);
+            purges++;
+        }
+        else
+        {
+            rehash(2 * m_table_size);
+        }
     }
 
-    size_t initial_index = hash_code(k);
-    size_t index = find_slot(k);
+    size_t h = m_hashing(k);
+    size_t initial_index = hash_code(h);
+    size_t index = find_slot(m_table, m_sizing, k, h);
 
-    if (m_table[index].status == SlotStatus::OCCUPIED)
+    if (index < m_table_size && m_table.status(index) == SlotStatus::OCCUPIED)
     {
-        m_table[index].data.second = v;
+        m_table.value(index) = v;
         return;
     }
 
+    if (is_rehashing())
+    {
+        size_t old_index = find_slot(m_old_table, m_old_sizing, k, h);
+        if (found(m_old_table, old_index, k, h))
+        {
+            m_old_table.value(old_index) = v;
+            return;
+        }
+    }
+
     if (index != initial_index)
     {
         collisions++;
     }
+    if (m_table.status(index) == SlotStatus::DELETED)
+    {
+        m_deleted--;
+    }
 
-    m_table[index].status = SlotStatus::OCCUPIED;
-    m_table[index].data = std::make_pair(k, v);
+    m_table.occupy(index, k, v, h);
     m_number_of_elements++;
 }
 
@@ -278,18 +527,34 @@ void OpenAddressingHashTable<Key, Value, Hash>::add(const Key &k, const Value &v
  * 1. Busca o índice do slot correspondente à chave 'k' usando find_slot.
  * 2. Verifica se o slot encontrado está ocupado (OCCUPIED).
  * 3. Se estiver ocupado, altera o status do slot para DELETED.
- * 4. Decrementa o número total de elementos na tabela.
+ * 4. Decrementa o número total de elementos na tabela e conta o novo slot removido.
+ * Durante um rehash incremental, se a chave não estiver na tabela atual, ela é procurada na antiga.
  *
  * @param k Chave do elemento a ser removido da tabela hash.
  */
-template <typename Key, typename Value, typename Hash>
-void OpenAddressingHashTable<Key, Value, Hash>::remove(const Key &k)
+template <typename Key, typename Value, typename Hash, typename Sizing, typename Probing, typename Layout>
+void OpenAddressingHashTable<Key, Value, Hash, Sizing, Probing, Layout>::remove(const Key &k)
 {
-    size_t index = find_slot(k);
-    if (m_table[index].status == SlotStatus::OCCUPIED)
+    migrate(m_migrate_step);
+
+    size_t h = m_hashing(k);
+    size_t index = find_slot(m_table, m_sizing, k, h);
+    if (found(m_table, index, k, h))
     {
-        m_table[index].status = SlotStatus::DELETED;
+        m_table.erase(index);
         m_number_of_elements--;
+        m_deleted++;
+        return;
+    }
+
+    if (is_rehashing())
+    {
+        size_t old_index = find_slot(m_old_table, m_old_sizing, k, h);
+        if (found(m_old_table, old_index, k, h))
+        {
+            m_old_table.erase(old_index);
+            m_number_of_elements--;
+        }
     }
 }
 
@@ -303,21 +568,33 @@ void OpenAddressingHashTable<Key, Value, Hash>::remove(const Key &k)
  * 2. Verifica se o slot encontrado está ocupado (status == OCCUPIED) e se a chave armazenada no slot é igual à chave buscada.
  * 3. Se qualquer uma dessas condições falhar, lança uma exceção std::out_of_range indicando que a chave não foi encontrada.
  * 4. Caso contrário, retorna uma referência constante para o valor associado à chave encontrada.
+ * Durante um rehash incremental, a tabela antiga é consultada quando a chave não está na atual.
  *
  * @param k Chave a ser buscada na tabela hash.
  * @return Referência constante para o valor associado à chave.
  * @throws std::out_of_range Se a chave não for encontrada na tabela.
  */
-template <typename Key, typename Value, typename Hash>
-const Value& OpenAddressingHashTable<Key, Value, Hash>::get(const Key &k) const
+template <typename Key, typename Value, typename Hash, typename Sizing, typename Probing, typename Layout>
+const Value& OpenAddressingHashTable<Key, Value, Hash, Sizing, Probing, Layout>::get(const Key &k) const
 {
-    size_t index = find_slot(k);
+    size_t h = m_hashing(k);
+    size_t index = find_slot(m_table, m_sizing, k, h);
+
+    if (found(m_table, index, k, h))
+    {
+        return m_table.value(index);
+    }
 
-    if (m_table[index].status != SlotStatus::OCCUPIED || m_table[index].data.first != k)
+    if (is_rehashing())
     {
-        throw std::out_of_range("Chave não encontrada");
+        size_t old_index = find_slot(m_old_table, m_old_sizing, k, h);
+        if (found(m_old_table, old_index, k, h))
+        {
+            return m_old_table.value(old_index);
+        }
     }
-    return m_table[index].data.second;
+
+    throw std::out_of_range("Chave não encontrada");
 }
 
 /**
@@ -327,14 +604,14 @@ const Value& OpenAddressingHashTable<Key, Value, Hash>::get(const Key &k) const
  * limpando efetivamente a tabela hash. Após a chamada desta função, a tabela não conterá
  * nenhum elemento e todos os slots estarão disponíveis para novas inserções.
  */
-template <typename Key, typename Value, typename Hash>
-void OpenAddressingHashTable<Key, Value, Hash>::clear()
+template <typename Key, typename Value, typename Hash, typename Sizing, typename Probing, typename Layout>
+void OpenAddressingHashTable<Key, Value, Hash, Sizing, Probing, Layout>::clear()
 {
     m_number_of_elements = 0;
-    for (auto &slot : m_table)
-    {
-        slot.status = SlotStatus::EMPTY;
-    }
+    m_deleted = 0;
+    m_table.clear();
+    Slots().swap(m_old_table);
+    m_migrate_pos = 0;
     comparisons = 0;
     collisions = 0;
 }
@@ -349,31 +626,54 @@ void OpenAddressingHashTable<Key, Value, Hash>::clear()
  * @param k A chave a ser buscada na tabela hash.
  * @return true se a chave estiver presente, false caso contrário.
  */
-template <typename Key, typename Value, typename Hash>
-bool OpenAddressingHashTable<Key, Value, Hash>::contains(const Key &k) const
+template <typename Key, typename Value, typename Hash, typename Sizing, typename Probing, typename Layout>
+bool OpenAddressingHashTable<Key, Value, Hash, Sizing, Probing, Layout>::contains(const Key &k) const
 {
-    size_t index = find_slot(k);
+    size_t h = m_hashing(k);
+    size_t index = find_slot(m_table, m_sizing, k, h);
     comparisons++;
-    return m_table[index].status == SlotStatus::OCCUPIED && m_table[index].data.first == k;
+    if (found(m_table, index, k, h))
+    {
+        return true;
+    }
+    return is_rehashing() && found(m_old_table, find_slot(m_old_table, m_old_sizing, k, h), k, h);
 }
 
 // Getters e funções de status
-template <typename Key, typename Value, typename Hash>
-size_t OpenAddressingHashTable<Key, Value, Hash>::size() const { return m_number_of_elements; }      // Retorna o número de elementos na tabela
+template <typename Key, typename Value, typename Hash, typename Sizing, typename Probing, typename Layout>
+size_t OpenAddressingHashTable<Key, Value, Hash, Sizing, Probing, Layout>::size() const { return m_number_of_elements; }      // Retorna o número de elementos na tabela
+
+template <typename Key, typename Value, typename Hash, typename Sizing, typename Probing, typename Layout>
+bool OpenAddressingHashTable<Key, Value, Hash, Sizing, Probing, Layout>::isEmpty() const { return m_number_of_elements == 0; }  // Verifica se a tabela está vazia
+
+template <typename Key, typename Value, typename Hash, typename Sizing, typename Probing, typename Layout>
+long long OpenAddressingHashTable<Key, Value, Hash, Sizing, Probing, Layout>::get_comparisons() const { return comparisons; } // Retorna o número de comparações realizadas
+
+template <typename Key, typename Value, typename Hash, typename Sizing, typename Probing, typename Layout>
+long long OpenAddressingHashTable<Key, Value, Hash, Sizing, Probing, Layout>::get_collisions() const { return collisions; }   // Retorna o número de colisões ocorridas
+
+template <typename Key, typename Value, typename Hash, typename Sizing, typename Probing, typename Layout>
+long long OpenAddressingHashTable<Key, Value, Hash, Sizing, Probing, Layout>::get_skipped_comparisons() const { return skipped; } // Retorna o número de comparações de chave evitadas
+
+template <typename Key, typename Value, typename Hash, typename Sizing, typename Probing, typename Layout>
+size_t OpenAddressingHashTable<Key, Value, Hash, Sizing, Probing, Layout>::get_node_bytes() const { return Slots::slot_bytes; } // Cada elemento ocupa uma posição do vetor (ou de cada vetor, com SplitSlots)
+
+template <typename Key, typename Value, typename Hash, typename Sizing, typename Probing, typename Layout>
+long long OpenAddressingHashTable<Key, Value, Hash, Sizing, Probing, Layout>::get_colors() const { return 0; } // Função que retorna o número de troca de cores, essa ED não possui
 
-template <typename Key, typename Value, typename Hash>
-bool OpenAddressingHashTable<Key, Value, Hash>::isEmpty() const { return m_number_of_elements == 0; }  // Verifica se a tabela está vazia
+template <typename Key, typename Value, typename Hash, typename Sizing, typename Probing, typename Layout>
+long long OpenAddressingHashTable<Key, Value, Hash, Sizing, Probing, Layout>::get_rotations() const { return 0; } // Função que retorna o número de rotações, essa ED não possui
 
-template <typename Key, typename Value, typename Hash>
-long long OpenAddressingHashTable<Key, Value, Hash>::get_comparisons() const { return comparisons; } // Retorna o número de comparações realizadas
+template <typename Key, typename Value, typename Hash, typename Sizing, typename Probing, typename Layout>
+long long OpenAddressingHashTable<Key, Value, Hash, Sizing, Probing, Layout>::get_rehashes() const { return rehashes; } // Retorna o número de redimensionamentos da tabela
 
-template <typename Key, typename Value, typename Hash>
-long long OpenAddressingHashTable<Key, Value, Hash>::get_collisions() const { return collisions; }   // Retorna o número de colisões ocorridas
+template <typename Key, typename Value, typename Hash, typename Sizing, typename Probing, typename Layout>
+long long OpenAddressingHashTable<Key, Value, Hash, Sizing, Probing, Layout>::get_purges() const { return purges; } // Retorna o número de rehash no mesmo tamanho
 
-template <typename Key, typename Value, typename Hash>
-long long OpenAddressingHashTable<Key, Value, Hash>::get_colors() const { return 0; } // Função que retorna o número de troca de cores, essa ED não possui
+template <typename Key, typename Value, typename Hash, typename Sizing, typename Probing, typename Layout>
+size_t OpenAddressingHashTable<Key, Value, Hash, Sizing, Probing, Layout>::get_tombstones() const { return m_deleted; } // Retorna o número de slots removidos na tabela atual
 
-template <typename Key, typename Value, typename Hash>
-long long OpenAddressingHashTable<Key, Value, Hash>::get_rotations() const { return 0; } // Função que retorna o número de rotações, essa ED não possui
+template <typename Key, typename Value, typename Hash, typename Sizing, typename Probing, typename Layout>
+double OpenAddressingHashTable<Key, Value, Hash, Sizing, Probing, Layout>::get_tombstone_ratio() const { return static_cast<double>(m_deleted) / m_table_size; } // Fração dos slots removidos
 
 #endif
\ No newline at end of file
@@ -0,0 +1,388 @@
+#ifndef ROBIN_HOOD_HASH_HPP
+#define ROBIN_HOOD_HASH_HPP
+
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+#include <functional>
+#include "../Dictionaty/IDictionary.hpp"
+#include "../utils/sizingPolicy.hpp"
+
+/**
+ * @brief Tabela hash com endereçamento aberto, sondagem linear e Robin Hood.
+ *
+ * Variante de OpenAddressingHashTable em que cada slot guarda, além do par e do hash completo,
+ * a distância de sondagem do elemento (quantas posições ele está depois do seu slot inicial).
+ *
+ * - Inserção: ao sondar, se o elemento do slot está mais perto do seu slot inicial do que o elemento
+ *   sendo inserido, eles trocam de lugar e a inserção continua com o elemento desalojado ("tira dos
+ *   ricos e dá aos pobres"). Assim as distâncias ficam parecidas e a maior delas cresce devagar.
+ * - Busca: termina assim que encontra um slot vazio ou um elemento com distância menor que a já
+ *   percorrida; se a chave estivesse na tabela, ela teria desalojado esse elemento. Buscas sem
+ *   sucesso param cedo mesmo com a tabela cheia.
+ * - Remoção por deslocamento para trás (backward shift): os elementos seguintes, enquanto não
+ *   estiverem no slot inicial, voltam uma posição. Não há marcas de removido (tombstones), então
+ *   inserções e remoções alternadas não alongam as sondagens.
+ *
+ * O rehash dobra a tabela e reinsere os elementos a partir do hash guardado, sem chamar a função
+ * de hash. As métricas seguem OpenAddressingHashTable: uma comparação por slot visitado e uma
+ * colisão por inserção que não ficou no slot inicial.
+ *
+ * @tparam Key Tipo da chave.
+ * @tparam Value Tipo do valor associado à chave.
+ * @tparam Hash Functor de hash a ser utilizado (padrão: std::hash<Key>).
+ * @tparam Sizing Política de dimensionamento (ver sizingPolicy.hpp). O padrão é potência de 2 com
+ *         redução de Fibonacci: a sondagem linear depende de que hashes próximos não caiam em slots
+ *         vizinhos.
+ */
+template <typename Key, typename Value, typename Hash = std::hash<Key>, typename Sizing = PowerOfTwoSizing>
+class RobinHoodHashTable : public IDictionary<Key, Value>
+{
+private:
+    // Slot da tabela: dist é 0 se o slot está vazio e d + 1 se o elemento está a d posições do seu slot inicial
+    struct HashSlot
+    {
+        std::pair<Key, Value> data;
+        size_t hash = 0; // hash completo da chave, calculado uma única vez na inserção
+        uint32_t dist = 0;
+    };
+
+    // Membros da classe
+    size_t m_table_size;
+    Sizing m_sizing;
+    size_t m_number_of_elements;
+    float m_max_load_factor;
+    std::vector<HashSlot> m_table;
+    Hash m_hashing;
+
+    // Métricas de desempenho
+    mutable long long comparisons = 0;
+    mutable long long collisions = 0;
+    mutable long long skipped = 0; // Comparações de chave evitadas porque o hash guardado já era diferente
+    long long rehashes = 0;        // Quantidade de redimensionamentos da tabela
+
+    size_t next(size_t index) const;
+    size_t find_index(const Key &k, size_t h) const;
+    void insert_new(HashSlot &&slot);
+    void rehash(size_t new_size);
+
+public:
+    RobinHoodHashTable(size_t tableSize = 19, float max_load_factor = 0.9f);
+
+    void clear();
+    void reserve(size_t n) override;
+    bool contains(const Key &k) const override;
+    bool isEmpty() const override;
+    void add(const Key &k, const Value &v) override;
+    void remove(const Key &k) override;
+    size_t size() const override;
+    const Value &get(const Key &k) const override;
+    std::vector<Key> get_all_keys_sorted() const override;
+
+    // Getters e funções de status
+    long long get_comparisons() const override; // Retorna o número de comparações realizadas
+    long long get_collisions() const override;  // Retorna o número de colisões ocorridas
+    long long get_skipped_comparisons() const;  // Retorna o número de comparações de chave evitadas pelo hash guardado
+    size_t get_node_bytes() const override;     // Retorna o tamanho de cada posição da tabela
+    long long get_colors() const override;      // Função que retorna o número de troca de cores, essa ED não possui
+    long long get_rotations() const override;   // Função que retorna o número de rotações, essa ED não possui
+    long long get_rehashes() const override;    // Retorna o número de redimensionamentos da tabela
+    size_t bucket_count() const;                // Retorna o número de slots da tabela
+    double get_mean_probe_length() const;       // Média de slots visitados para encontrar cada elemento
+    size_t get_max_probe_length() const;        // Maior número de slots visitados para encontrar um elemento
+};
+
+/**
+ * @brief Retorna todas as chaves presentes na tabela, ordenadas.
+ */
+template <typename Key, typename Value, typename Hash, typename Sizing>
+std::vector<Key> RobinHoodHashTable<Key, Value, Hash, Sizing>::get_all_keys_sorted() const
+{
+    std::vector<Key> keys;
+    if (this->isEmpty()) return keys;
+
+    keys.reserve(this->size());
+    for (const auto &slot : m_table)
+    {
+        if (slot.dist != 0)
+        {
+            keys.push_back(slot.data.first);
+        }
+    }
+
+    std::sort(keys.begin(), keys.end());
+
+    return keys;
+}
+
+// Próximo slot da sondagem linear, voltando ao início no fim da tabela
+template <typename Key, typename Value, typename Hash, typename Sizing>
+size_t RobinHoodHashTable<Key, Value, Hash, Sizing>::next(size_t index) const
+{
+    return index + 1 == m_table_size ? 0 : index + 1;
+}
+
+/**
+ * @brief Procura a chave k (hash completo h) e retorna o seu slot, ou m_table_size se ela não estiver na tabela.
+ *
+ * A sondagem para no primeiro slot vazio ou no primeiro elemento mais perto do próprio slot inicial do
+ * que a distância já percorrida. A chave só é comparada quando o hash guardado é igual a h.
+ */
+template <typename Key, typename Value, typename Hash, typename Sizing>
+size_t RobinHoodHashTable<Key, Value, Hash, Sizing>::find_index(const Key &k, size_t h) const
+{
+    size_t index = m_sizing.index(h);
+    for (uint32_t dist = 1; m_table[index].dist >= dist; ++dist)
+    {
+        comparisons++;
+        if (m_table[index].hash != h)
+        {
+            skipped++;
+        }
+        else if (m_table[index].data.first == k)
+        {
+            return index;
+        }
+        index = next(index);
+    }
+    comparisons++; // o slot que encerrou a sondagem também foi visitado
+    return m_table_size;
+}
+
+/**
+ * @brief Insere um elemento cuja chave sabidamente não está na tabela.
+ *
+ * Sonda a partir do slot inicial; sempre que encontra um elemento mais perto do próprio slot inicial,
+ * troca de lugar com ele e continua inserindo o desalojado. Nenhuma chave é comparada.
+ *
+ * @param slot Elemento a inserir (o campo dist é recalculado); seu conteúdo é movido.
+ */
+template <typename Key, typename Value, typename Hash, typename Sizing>
+void RobinHoodHashTable<Key, Value, Hash, Sizing>::insert_new(HashSlot &&slot)
+{
+    size_t index = m_sizing.index(slot.hash);
+    slot.dist = 1;
+    while (m_table[index].dist != 0)
+    {
+        if (m_table[index].dist < slot.dist)
+        {
+            std::swap(m_table[index], slot);
+        }
+        index = next(index);
+        slot.dist++;
+    }
+    m_table[index] = std::move(slot);
+}
+
+/**
+ * @brief Redimensiona a tabela e reinsere todos os elementos a partir do hash guardado.
+ * As reinserções não contam colisões: o contador acumula apenas as das inserções, entre redimensionamentos.
+ *
+ * @param new_size Novo tamanho desejado (ajustado pela política de dimensionamento).
+ */
+template <typename Key, typename Value, typename Hash, typename Sizing>
+void RobinHoodHashTable<Key, Value, Hash, Sizing>::rehash(size_t new_size)
+{
+    m_sizing = Sizing(new_size);
+    m_table_size = m_sizing.size();
+    std::vector<HashSlot> old_table(m_table_size);
+    old_table.swap(m_table);
+    rehashes++;
+
+    for (auto &slot : old_table)
+    {
+        if (slot.dist != 0)
+        {
+            insert_new(std::move(slot));
+        }
+    }
+}
+
+/**
+ * @brief Redimensiona a tabela de uma vez para que n elementos caibam sem atingir o fator de carga
+ * máximo, evitando a sequência de rehash por dobra durante a ingestão. Não reduz a tabela.
+ *
+ * @param n Número de elementos esperado.
+ */
+template <typename Key, typename Value, typename Hash, typename Sizing>
+void RobinHoodHashTable<Key, Value, Hash, Sizing>::reserve(size_t n)
+{
+    if (static_cast<float>(n) / m_table_size >= m_max_load_factor)
+    {
+        rehash(static_cast<size_t>(n / m_max_load_factor) + 1);
+    }
+}
+
+/**
+ * @brief Constrói a tabela com pelo menos tableSize slots e o fator de carga máximo dado.
+ * A sondagem Robin Hood mantém as sondagens curtas em cargas altas, por isso o padrão é 0.9.
+ * @throws std::out_of_range Se max_load_factor estiver fora de (0, 1].
+ */
+template <typename Key, typename Value, typename Hash, typename Sizing>
+RobinHoodHashTable<Key, Value, Hash, Sizing>::RobinHoodHashTable(size_t tableSize, float max_load_factor)
+    : m_sizing(tableSize)
+{
+    if (max_load_factor <= 0 || max_load_factor > 1)
+    {
+        throw std::out_of_range("invalid load factor");
+    }
+    m_number_of_elements = 0;
+    m_table_size = m_sizing.size();
+    m_max_load_factor = max_load_factor;
+    m_table.resize(m_table_size);
+}
+
+/**
+ * @brief Insere o par (k, v) ou, se a chave já existir, atualiza o valor.
+ * Se a inserção fizer a carga atingir o fator máximo, a tabela dobra antes.
+ */
+template <typename Key, typename Value, typename Hash, typename Sizing>
+void RobinHoodHashTable<Key, Value, Hash, Sizing>::add(const Key &k, const Value &v)
+{
+    size_t h = m_hashing(k);
+    size_t index = find_index(k, h);
+    if (index != m_table_size)
+    {
+        m_table[index].data.second = v;
+        return;
+    }
+
+    // A tabela nunca enche por completo: a sondagem precisa de um slot vazio para terminar
+    if (static_cast<float>(m_number_of_elements + 1) / m_table_size >= m_max_load_factor ||
+        m_number_of_elements + 1 >= m_table_size)
+    {
+        rehash(2 * m_table_size);
+    }
+
+    if (m_table[m_sizing.index(h)].dist != 0)
+    {
+        collisions++;
+    }
+    insert_new(HashSlot{std::make_pair(k, v), h, 0});
+    m_number_of_elements++;
+}
+
+/**
+ * @brief Remove o elemento com chave k, se existir, por deslocamento para trás: cada elemento
+ * seguinte que não está no seu slot inicial volta uma posição, até um slot vazio ou um elemento
+ * já no slot inicial. Nenhuma marca de removido é deixada na tabela.
+ */
+template <typename Key, typename Value, typename Hash, typename Sizing>
+void RobinHoodHashTable<Key, Value, Hash, Sizing>::remove(const Key &k)
+{
+    size_t index = find_index(k, m_hashing(k));
+    if (index == m_table_size)
+    {
+        return;
+    }
+
+    for (size_t following = next(index); m_table[following].dist > 1; following = next(following))
+    {
+        m_table[index] = std::move(m_table[following]);
+        m_table[index].dist--;
+        index = following;
+    }
+    m_table[index].dist = 0;
+    m_number_of_elements--;
+}
+
+/**
+ * @brief Retorna o valor associado a k.
+ * @throws std::out_of_range Se a chave não for encontrada na tabela.
+ */
+template <typename Key, typename Value, typename Hash, typename Sizing>
+const Value &RobinHoodHashTable<Key, Value, Hash, Sizing>::get(const Key &k) const
+{
+    size_t index = find_index(k, m_hashing(k));
+    if (index == m_table_size)
+    {
+        throw std::out_of_range("Chave não encontrada");
+    }
+    return m_table[index].data.second;
+}
+
+/**
+ * @brief Remove todos os elementos, mantendo o tamanho da tabela.
+ */
+template <typename Key, typename Value, typename Hash, typename Sizing>
+void RobinHoodHashTable<Key, Value, Hash, Sizing>::clear()
+{
+    m_number_of_elements = 0;
+    for (auto &slot : m_table)
+    {
+        slot.dist = 0;
+    }
+    comparisons = 0;
+    collisions = 0;
+}
+
+template <typename Key, typename Value, typename Hash, typename Sizing>
+bool RobinHoodHashTable<Key, Value, Hash, Sizing>::contains(const Key &k) const
+{
+    return find_index(k, m_hashing(k)) != m_table_size;
+}
+
+/**
+ * @brief Média de slots visitados por uma busca bem-sucedida (a distância guardada de cada elemento).
+ */
+template <typename Key, typename Value, typename Hash, typename Sizing>
+double RobinHoodHashTable<Key, Value, Hash, Sizing>::get_mean_probe_length() const
+{
+    if (m_number_of_elements == 0) return 0;
+
+    size_t total = 0;
+    for (const auto &slot : m_table)
+    {
+        total += slot.dist;
+    }
+    return static_cast<double>(total) / m_number_of_elements;
+}
+
+/**
+ * @brief Maior número de slots visitados por uma busca bem-sucedida.
+ */
+template <typename Key, typename Value, typename Hash, typename Sizing>
+size_t RobinHoodHashTable<Key, Value, Hash, Sizing>::get_max_probe_length() const
+{
+    uint32_t longest = 0;
+    for (const auto &slot : m_table)
+    {
+        longest = std::max(longest, slot.dist);
+    }
+    return longest;
+}
+
+// Getters e funções de status
+template <typename Key, typename Value, typename Hash, typename Sizing>
+size_t RobinHoodHashTable<Key, Value, Hash, Sizing>::size() const { return m_number_of_elements; } // Retorna o número de elementos na tabela
+
+template <typename Key, typename Value, typename Hash, typename Sizing>
+bool RobinHoodHashTable<Key, Value, Hash, Sizing>::isEmpty() const { return m_number_of_elements == 0; } // Verifica se a tabela está vazia
+
+template <typename Key, typename Value, typename Hash, typename Sizing>
+size_t RobinHoodHashTable<Key, Value, Hash, Sizing>::bucket_count() const { return m_table_size; } // Retorna o número de slots da tabela
+
+template <typename Key, typename Value, typename Hash, typename Sizing>
+long long RobinHoodHashTable<Key, Value, Hash, Sizing>::get_comparisons() const { return comparisons; } // Retorna o número de comparações realizadas
+
+template <typename Key, typename Value, typename Hash, typename Sizing>
+long long RobinHoodHashTable<Key, Value, Hash, Sizing>::get_collisions() const { return collisions; } // Retorna o número de colisões ocorridas
+
+template <typename Key, typename Value, typename Hash, typename Sizing>
+long long RobinHoodHashTable<Key, Value, Hash, Sizing>::get_skipped_comparisons() const { return skipped; } // Retorna o número de comparações de chave evitadas
+
+template <typename Key, typename Value, typename Hash, typename Sizing>
+size_t RobinHoodHashTable<Key, Value, Hash, Sizing>::get_node_bytes() const { return sizeof(HashSlot); } // Cada elemento ocupa uma posição do vetor
+
+template <typename Key, typename Value, typename Hash, typename Sizing>
+long long RobinHoodHashTable<Key, Value, Hash, Sizing>::get_colors() const { return 0; } // Função que retorna o número de troca de cores, essa ED não possui
+
+template <typename Key, typename Value, typename Hash, typename Sizing>
+long long RobinHoodHashTable<Key, Value, Hash, Sizing>::get_rotations() const { return 0; } // Função que retorna o número de rotações, essa ED não possui
+
+template <typename Key, typename Value, typename Hash, typename Sizing>
+long long RobinHoodHashTable<Key, Value, Hash, Sizing>::get_rehashes() const { return rehashes; } // Retorna o número de redimensionamentos da tabela
+
+#endif
@@ -0,0 +1,450 @@
+#ifndef SWISS_HASH_HPP
+#define SWISS_HASH_HPP
+
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+#include <functional>
+#include "../Dictionaty/IDictionary.hpp"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/**
+ * @brief Tabela hash com endereçamento aberto no estilo SwissTable (Abseil), sondando 16 slots por vez.
+ *
+ * Além do vetor de slots, a tabela mantém um vetor de controle com um byte por slot: VAZIO, REMOVIDO
+ * ou, para slots ocupados, os 7 bits baixos do hash (a "impressão digital", h2). Os bits restantes do
+ * hash (h1) escolhem o grupo inicial. Uma busca carrega 16 bytes de controle, compara todos com h2 de
+ * uma vez (SSE2: _mm_cmpeq_epi8 e _mm_movemask_epi8) e só olha os slots cujo byte coincide; em média
+ * 1 em 128 slots ocupados passa pelo filtro. Se o grupo tiver algum slot VAZIO, a chave não está na
+ * tabela; caso contrário a busca segue para o próximo grupo em sondagem triangular (passos de 16, 32,
+ * 48... posições), que visita todos os grupos quando a capacidade é potência de 2.
+ *
+ * Como o filtro descarta quase todos os slots sem tocar no vetor de slots, a tabela aguenta fatores de
+ * carga altos (padrão 0.875) sem o crescimento das sondagens do duplo hash. Os primeiros 16 bytes de
+ * controle são repetidos no fim do vetor, então um grupo que passa do último slot é lido de uma vez.
+ *
+ * Remoções marcam o slot como REMOVIDO; inserções reaproveitam esses slots, e o rehash (na mesma
+ * capacidade, se os elementos vivos ainda couberem com folga; ver add()) os descarta. Cada slot guarda o hash completo:
+ * o rehash não chama a função de hash e a chave só é comparada quando o hash guardado é igual.
+ *
+ * Métricas: uma comparação por grupo sondado e uma por slot cuja impressão digital coincide; uma colisão
+ * por inserção fora da primeira posição da sondagem.
+ *
+ * @tparam Key Tipo da chave.
+ * @tparam Value Tipo do valor associado à chave.
+ * @tparam Hash Functor de hash a ser utilizado (padrão: std::hash<Key>). O código é misturado antes de
+ *         ser dividido em h1 e h2, então hashes fracos (como a identidade de std::hash<int>) servem.
+ */
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+class SwissHashTable : public IDictionary<Key, Value>
+{
+private:
+    static constexpr size_t GROUP_WIDTH = 16;
+    static constexpr int8_t EMPTY = -128;  // 0b10000000
+    static constexpr int8_t DELETED = -2;  // 0b11111110; slots ocupados têm o bit alto zerado (0..127)
+
+    // Slot da tabela: o par e o hash completo da chave, calculado uma única vez na inserção
+    struct HashSlot
+    {
+        std::pair<Key, Value> data;
+        size_t hash = 0;
+    };
+
+    // Máscara de bits de um grupo: o bit i corresponde ao slot (início do grupo + i)
+    using BitMask = uint32_t;
+
+    // Membros da classe
+    size_t m_capacity;       // potência de 2, pelo menos GROUP_WIDTH
+    size_t m_number_of_elements;
+    size_t m_deleted;        // slots marcados como REMOVIDO
+    float m_max_load_factor;
+    std::vector<int8_t> m_ctrl; // m_capacity + GROUP_WIDTH bytes (os 16 primeiros repetidos no fim)
+    std::vector<HashSlot> m_slots;
+    Hash m_hashing;
+
+    // Métricas de desempenho
+    mutable long long comparisons = 0;
+    mutable long long collisions = 0;
+    mutable long long skipped = 0; // Comparações de chave evitadas porque o hash guardado já era diferente
+    long long rehashes = 0;        // Quantidade de redimensionamentos da tabela
+
+    static size_t mix(size_t h);
+    static BitMask match_byte(const int8_t *group, int8_t byte);
+    static BitMask match_empty_or_deleted(const int8_t *group);
+    void set_ctrl(size_t index, int8_t byte);
+    size_t find_index(const Key &k, size_t h) const;
+    size_t find_free(size_t h) const;
+    size_t insert_new(HashSlot &&slot);
+    void rehash(size_t new_capacity);
+
+public:
+    SwissHashTable(size_t tableSize = 16, float max_load_factor = 0.875f);
+
+    void clear();
+    void reserve(size_t n) override;
+    bool contains(const Key &k) const override;
+    bool isEmpty() const override;
+    void add(const Key &k, const Value &v) override;
+    void remove(const Key &k) override;
+    size_t size() const override;
+    const Value &get(const Key &k) const override;
+    std::vector<Key> get_all_keys_sorted() const override;
+
+    // Getters e funções de status
+    long long get_comparisons() const override; // Retorna o número de comparações realizadas
+    long long get_collisions() const override;  // Retorna o número de colisões ocorridas
+    long long get_skipped_comparisons() const;  // Retorna o número de comparações de chave evitadas pelo hash guardado
+    size_t get_node_bytes() const override;     // Retorna o tamanho de cada posição da tabela (slot e byte de controle)
+    long long get_colors() const override;      // Função que retorna o número de troca de cores, essa ED não possui
+    long long get_rotations() const override;   // Função que retorna o número de rotações, essa ED não possui
+    long long get_rehashes() const override;    // Retorna o número de redimensionamentos da tabela
+    size_t bucket_count() const;                // Retorna o número de slots da tabela
+};
+
+/**
+ * @brief Retorna todas as chaves presentes na tabela, ordenadas.
+ */
+template <typename Key, typename Value, typename Hash>
+std::vector<Key> SwissHashTable<Key, Value, Hash>::get_all_keys_sorted() const
+{
+    std::vector<Key> keys;
+    if (this->isEmpty()) return keys;
+
+    keys.reserve(this->size());
+    for (size_t i = 0; i < m_capacity; ++i)
+    {
+        if (m_ctrl[i] >= 0)
+        {
+            keys.push_back(m_slots[i].data.first);
+        }
+    }
+
+    std::sort(keys.begin(), keys.end());
+
+    return keys;
+}
+
+// Mistura o código hash (multiplicação 64x64->128 dobrada): h1 e h2 passam a depender de todos os bits de h
+template <typename Key, typename Value, typename Hash>
+size_t SwissHashTable<Key, Value, Hash>::mix(size_t h)
+{
+    unsigned __int128 r = static_cast<unsigned __int128>(h) * 0x9E3779B97F4A7C15ull;
+    return static_cast<size_t>(static_cast<uint64_t>(r) ^ static_cast<uint64_t>(r >> 64));
+}
+
+// Bits dos slots do grupo cujo byte de controle é igual a byte
+template <typename Key, typename Value, typename Hash>
+typename SwissHashTable<Key, Value, Hash>::BitMask SwissHashTable<Key, Value, Hash>::match_byte(const int8_t *group, int8_t byte)
+{
+#if defined(__SSE2__)
+    __m128i ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i *>(group));
+    return static_cast<BitMask>(_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(byte))));
+#else
+    BitMask mask = 0;
+    for (size_t i = 0; i < GROUP_WIDTH; ++i)
+    {
+        mask |= static_cast<BitMask>(group[i] == byte) << i;
+    }
+    return mask;
+#endif
+}
+
+// Bits dos slots livres do grupo (VAZIO ou REMOVIDO): são os bytes com o bit alto ligado
+template <typename Key, typename Value, typename Hash>
+typename SwissHashTable<Key, Value, Hash>::BitMask SwissHashTable<Key, Value, Hash>::match_empty_or_deleted(const int8_t *group)
+{
+#if defined(__SSE2__)
+    return static_cast<BitMask>(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(group))));
+#else
+    BitMask mask = 0;
+    for (size_t i = 0; i < GROUP_WIDTH; ++i)
+    {
+        mask |= static_cast<BitMask>(group[i] < 0) << i;
+    }
+    return mask;
+#endif
+}
+
+// Escreve o byte de controle do slot index e, se ele estiver entre os 16 primeiros, a sua cópia no fim
+template <typename Key, typename Value, typename Hash>
+void SwissHashTable<Key, Value, Hash>::set_ctrl(size_t index, int8_t byte)
+{
+    m_ctrl[index] = byte;
+    if (index < GROUP_WIDTH)
+    {
+        m_ctrl[m_capacity + index] = byte;
+    }
+}
+
+/**
+ * @brief Procura a chave k (hash completo h) e retorna o seu slot, ou m_capacity se ela não estiver na tabela.
+ */
+template <typename Key, typename Value, typename Hash>
+size_t SwissHashTable<Key, Value, Hash>::find_index(const Key &k, size_t h) const
+{
+    size_t mixed = mix(h);
+    int8_t h2 = static_cast<int8_t>(mixed & 0x7F);
+    size_t mask = m_capacity - 1;
+    size_t pos = (mixed >> 7) & mask;
+
+    for (size_t stride = GROUP_WIDTH; ; stride += GROUP_WIDTH)
+    {
+        comparisons++;
+        const int8_t *group = &m_ctrl[pos];
+        for (BitMask candidates = match_byte(group, h2); candidates != 0; candidates &= candidates - 1)
+        {
+            size_t index = (pos + __builtin_ctz(candidates)) & mask;
+            comparisons++;
+            if (m_slots[index].hash != h)
+            {
+                skipped++;
+            }
+            else if (m_slots[index].data.first == k)
+            {
+                return index;
+            }
+        }
+        if (match_byte(group, EMPTY) != 0)
+        {
+            return m_capacity;
+        }
+        pos = (pos + stride) & mask;
+    }
+}
+
+/**
+ * @brief Retorna o primeiro slot livre (VAZIO ou REMOVIDO) na sequência de sondagem do hash h.
+ * A tabela sempre tem ao menos um slot VAZIO, então a sondagem termina.
+ */
+template <typename Key, typename Value, typename Hash>
+size_t SwissHashTable<Key, Value, Hash>::find_free(size_t h) const
+{
+    size_t mask = m_capacity - 1;
+    size_t pos = (mix(h) >> 7) & mask;
+
+    for (size_t stride = GROUP_WIDTH; ; stride += GROUP_WIDTH)
+    {
+        BitMask free_slots = match_empty_or_deleted(&m_ctrl[pos]);
+        if (free_slots != 0)
+        {
+            return (pos + __builtin_ctz(free_slots)) & mask;
+        }
+        pos = (pos + stride) & mask;
+    }
+}
+
+/**
+ * @brief Insere um elemento cuja chave sabidamente não está na tabela, sem comparar chaves.
+ *
+ * @param slot Elemento a inserir; seu conteúdo é movido.
+ * @return Índice do slot ocupado.
+ */
+template <typename Key, typename Value, typename Hash>
+size_t SwissHashTable<Key, Value, Hash>::insert_new(HashSlot &&slot)
+{
+    size_t mixed = mix(slot.hash);
+    size_t index = find_free(slot.hash);
+    if (m_ctrl[index] == DELETED)
+    {
+        m_deleted--;
+    }
+    set_ctrl(index, static_cast<int8_t>(mixed & 0x7F));
+    m_slots[index] = std::move(slot);
+    return index;
+}
+
+/**
+ * @brief Reconstrói a tabela com a capacidade dada, reinserindo os elementos a partir do hash guardado
+ * e descartando os slots REMOVIDOS. As reinserções não contam colisões, inclusive na reconstrução de
+ * mesma capacidade que só descarta removidos.
+ *
+ * @param new_capacity Capacidade mínima desejada (arredondada para potência de 2, pelo menos 16).
+ */
+template <typename Key, typename Value, typename Hash>
+void SwissHashTable<Key, Value, Hash>::rehash(size_t new_capacity)
+{
+    size_t capacity = GROUP_WIDTH;
+    while (capacity < new_capacity)
+    {
+        capacity <<= 1;
+    }
+
+    std::vector<int8_t> old_ctrl(capacity + GROUP_WIDTH, EMPTY);
+    std::vector<HashSlot> old_slots(capacity);
+    old_ctrl.swap(m_ctrl);
+    old_slots.swap(m_slots);
+    size_t old_capacity = m_capacity;
+    m_capacity = capacity;
+    m_deleted = 0;
+    rehashes++;
+
+    for (size_t i = 0; i < old_capacity; ++i)
+    {
+        if (old_ctrl[i] >= 0)
+        {
+            insert_new(std::move(old_slots[i]));
+        }
+    }
+}
+
+/**
+ * @brief Redimensiona a tabela de uma vez para que n elementos caibam sem atingir o fator de carga
+ * máximo, evitando a sequência de rehash por dobra durante a ingestão. Não reduz a tabela.
+ *
+ * @param n Número de elementos esperado.
+ */
+template <typename Key, typename Value, typename Hash>
+void SwissHashTable<Key, Value, Hash>::reserve(size_t n)
+{
+    if (static_cast<float>(n) / m_capacity >= m_max_load_factor)
+    {
+        rehash(static_cast<size_t>(n / m_max_load_factor) + 1);
+    }
+}
+
+/**
+ * @brief Constrói a tabela com pelo menos tableSize slots (potência de 2, no mínimo 16).
+ * @throws std::out_of_range Se max_load_factor estiver fora de (0, 1].
+ */
+template <typename Key, typename Value, typename Hash>
+SwissHashTable<Key, Value, Hash>::SwissHashTable(size_t tableSize, float max_load_factor)
+{
+    if (max_load_factor <= 0 || max_load_factor > 1)
+    {
+        throw std::out_of_range("invalid load factor");
+    }
+    m_number_of_elements = 0;
+    m_deleted = 0;
+    m_max_load_factor = max_load_factor;
+    m_capacity = GROUP_WIDTH;
+    while (m_capacity < tableSize)
+    {
+        m_capacity <<= 1;
+    }
+    m_ctrl.assign(m_capacity + GROUP_WIDTH, EMPTY);
+    m_slots.resize(m_capacity);
+}
+
+/**
+ * @brief Insere o par (k, v) ou, se a chave já existir, atualiza o valor.
+ *
+ * Elementos e slots REMOVIDOS contam para a carga, pois ambos alongam as sondagens. Ao atingir o fator
+ * máximo a tabela é reconstruída: na mesma capacidade, apenas descartando os removidos, se os elementos
+ * ocuparem no máximo 7/8 da carga máxima (a regra do Abseil, 25/32 da capacidade com fator 0.875);
+ * caso contrário, com o dobro da capacidade.
+ */
+template <typename Key, typename Value, typename Hash>
+void SwissHashTable<Key, Value, Hash>::add(const Key &k, const Value &v)
+{
+    size_t h = m_hashing(k);
+    size_t index = find_index(k, h);
+    if (index != m_capacity)
+    {
+        m_slots[index].data.second = v;
+        return;
+    }
+
+    size_t used = m_number_of_elements + m_deleted + 1;
+    if (static_cast<float>(used) / m_capacity >= m_max_load_factor || used >= m_capacity)
+    {
+        bool drop_deleted = (m_number_of_elements + 1) * 8 <= m_capacity * m_max_load_factor * 7;
+        rehash(drop_deleted ? m_capacity : 2 * m_capacity);
+    }
+
+    if (insert_new(HashSlot{std::make_pair(k, v), h}) != ((mix(h) >> 7) & (m_capacity - 1)))
+    {
+        collisions++;
+    }
+    m_number_of_elements++;
+}
+
+/**
+ * @brief Remove o elemento com chave k, se existir, marcando o slot como REMOVIDO.
+ */
+template <typename Key, typename Value, typename Hash>
+void SwissHashTable<Key, Value, Hash>::remove(const Key &k)
+{
+    size_t index = find_index(k, m_hashing(k));
+    if (index == m_capacity)
+    {
+        return;
+    }
+
+    set_ctrl(index, DELETED);
+    m_slots[index] = HashSlot{};
+    m_deleted++;
+    m_number_of_elements--;
+}
+
+/**
+ * @brief Retorna o valor associado a k.
+ * @throws std::out_of_range Se a chave não for encontrada na tabela.
+ */
+template <typename Key, typename Value, typename Hash>
+const Value &SwissHashTable<Key, Value, Hash>::get(const Key &k) const
+{
+    size_t index = find_index(k, m_hashing(k));
+    if (index == m_capacity)
+    {
+        throw std::out_of_range("Chave não encontrada");
+    }
+    return m_slots[index].data.second;
+}
+
+/**
+ * @brief Remove todos os elementos, mantendo a capacidade da tabela.
+ */
+template <typename Key, typename Value, typename Hash>
+void SwissHashTable<Key, Value, Hash>::clear()
+{
+    m_number_of_elements = 0;
+    m_deleted = 0;
+    std::fill(m_ctrl.begin(), m_ctrl.end(), EMPTY);
+    std::vector<HashSlot>(m_capacity).swap(m_slots);
+    comparisons = 0;
+    collisions = 0;
+}
+
+template <typename Key, typename Value, typename Hash>
+bool SwissHashTable<Key, Value, Hash>::contains(const Key &k) const
+{
+    return find_index(k, m_hashing(k)) != m_capacity;
+}
+
+// Getters e funções de status
+template <typename Key, typename Value, typename Hash>
+size_t SwissHashTable<Key, Value, Hash>::size() const { return m_number_of_elements; } // Retorna o número de elementos na tabela
+
+template <typename Key, typename Value, typename Hash>
+bool SwissHashTable<Key, Value, Hash>::isEmpty() const { return m_number_of_elements == 0; } // Verifica se a tabela está vazia
+
+template <typename Key, typename Value, typename Hash>
+size_t SwissHashTable<Key, Value, Hash>::bucket_count() const { return m_capacity; } // Retorna o número de slots da tabela
+
+template <typename Key, typename Value, typename Hash>
+long long SwissHashTable<Key, Value, Hash>::get_comparisons() const { return comparisons; } // Retorna o número de comparações realizadas
+
+template <typename Key, typename Value, typename Hash>
+long long SwissHashTable<Key, Value, Hash>::get_collisions() const { return collisions; } // Retorna o número de colisões ocorridas
+
+template <typename Key, typename Value, typename Hash>
+long long SwissHashTable<Key, Value, Hash>::get_skipped_comparisons() const { return skipped; } // Retorna o número de comparações de chave evitadas
+
+template <typename Key, typename Value, typename Hash>
+size_t SwissHashTable<Key, Value, Hash>::get_node_bytes() const { return sizeof(HashSlot) + 1; } // Slot mais o byte de controle
+
+template <typename Key, typename Value, typename Hash>
+long long SwissHashTable<Key, Value, Hash>::get_colors() const { return 0; } // Função que retorna o número de troca de cores, essa ED não possui
+
+template <typename Key, typename Value, typename Hash>
+long long SwissHashTable<Key, Value, Hash>::get_rotations() const { return 0; } // Função que retorna o número de rotações, essa ED não possui
+
+template <typename Key, typename Value, typename Hash>
+long long SwissHashTable<Key, Value, Hash>::get_rehashes() const { return rehashes; } // Retorna o número de redimensionamentos da tabela
+
+#endif
@@ -0,0 +1,66 @@
+#ifndef CONCURRENT_NODE_RB_HPP
+#define CONCURRENT_NODE_RB_HPP
+
+#include <atomic>
+#include "NodeRb.hpp"
+
+/**
+ * @brief Estrutura de nó para a árvore rubro-negra concorrente (um escritor, vários leitores).
+ *
+ * @tparam Key Tipo da chave armazenada no nó.
+ * @tparam Value Tipo do valor associado à chave.
+ *
+ * Os leitores só acessam a chave, o valor e os filhos; por isso apenas esses campos são atômicos.
+ * A chave é imutável e o valor é mantido por ponteiro para um objeto que nunca é alterado depois de
+ * publicado: uma atualização troca o ponteiro. Um ponteiro nulo indica um nó sendo removido.
+ * O pai e a cor são usados apenas pelo escritor e não precisam de sincronização.
+ */
+template <typename Key, typename Value>
+struct ConcurrentRBNode {
+    /**
+     * @brief Alias para ponteiro de ConcurrentRBNode.
+     */
+    using Nodeptr = ConcurrentRBNode<Key, Value>*;
+
+    /**
+     * @brief Chave do nó (nunca muda depois da criação).
+     */
+    const Key key;
+
+    /**
+     * @brief Valor associado à chave (posse do nó), ou nullptr durante a remoção.
+     */
+    std::atomic<Value*> value;
+
+    /**
+     * @brief Ponteiros para os filhos esquerdo e direito, lidos pelos leitores sem travas.
+     */
+    std::atomic<Nodeptr> left;
+    std::atomic<Nodeptr> right;
+
+    /**
+     * @brief Ponteiro para o pai e cor do nó (apenas o escritor os acessa).
+     */
+    Nodeptr parent;
+    Color color;
+
+    /**
+     * @brief Construtor do nó concorrente.
+     *
+     * @param key Chave do nó.
+     * @param value Valor alocado (posse transferida ao nó) ou nullptr para o sentinela.
+     * @param nil Sentinela usado como filho e pai vazios.
+     */
+    ConcurrentRBNode(const Key& key, Value* value, Nodeptr nil)
+        : key(key), value(value), left(nil), right(nil), parent(nil), color(RED) {}
+
+    /**
+     * @brief Publica um novo filho esquerdo ou direito para os leitores.
+     *
+     * A ordem release garante que um leitor que encontre o ponteiro veja o nó completamente construído.
+     */
+    void setLeft(Nodeptr node) { left.store(node, std::memory_order_release); }
+    void setRight(Nodeptr node) { right.store(node, std::memory_order_release); }
+};
+
+#endif
@@ -1,28 +1,31 @@
 #ifndef NODERB_HPP
 #define NODERB_HPP
 
+#include <cstdint>
 #include <utility>
 
 enum Color { RED, BLACK };
 
 /**
- * @brief Estrutura de nó para uma árvore rubro-negra (Red-Black Tree).
- * 
+ * @brief Estrutura de nó compacta para uma árvore rubro-negra (Red-Black Tree).
+ *
  * @tparam Key Tipo da chave armazenada no nó.
  * @tparam Value Tipo do valor associado à chave.
- * 
+ *
  * Esta estrutura representa um nó de uma árvore rubro-negra, contendo ponteiros para o pai,
- * filho esquerdo e filho direito, além de informações sobre a cor do nó, altura e os dados
- * armazenados (par chave-valor).
- * 
+ * filho esquerdo e filho direito, a cor do nó e os dados armazenados (par chave-valor).
+ *
+ * Como o nó é alinhado a pelo menos 2 bytes, o bit menos significativo do endereço do pai é
+ * sempre zero; a cor é guardada nesse bit. Assim o nó tem apenas os dados e três palavras,
+ * sem o campo de cor separado (e o seu preenchimento). O acesso ao pai e à cor é feito pelos
+ * métodos parent(), setParent(), color() e setColor().
+ *
  * Membros:
  * - data: Par contendo a chave e o valor armazenados no nó.
- * - color: Cor do nó (vermelho ou preto).
- * - parent: Ponteiro para o nó pai.
  * - left: Ponteiro para o filho esquerdo.
  * - right: Ponteiro para o filho direito.
- * - height: Altura do nó na árvore.
- * 
+ * - parentColor: Ponteiro para o nó pai com a cor no bit menos significativo.
+ *
  * Construtores:
  * - RBNode(const std::pair<Key, Value>& data): Inicializa o nó com um par chave-valor.
  * - RBNode(const Key& key, const Value& value): Inicializa o nó com chave e valor separados.
@@ -33,20 +36,34 @@ struct RBNode {
     using Nodeptr = RBNode<Key, Value>*;
 
     std::pair<Key, Value> data;
-    Color color;
-    Nodeptr parent;
     Nodeptr left;
     Nodeptr right;
-    int height;
 
+private:
+    static constexpr uintptr_t COLOR_MASK = 1;
+    uintptr_t parentColor; // Endereço do pai | cor
+
+public:
     RBNode(const std::pair<Key, Value>& data)
-        : data(data), color(RED), parent(nullptr), left(nullptr), right(nullptr), height(1) {}
+        : data(data), left(nullptr), right(nullptr), parentColor(RED) { check_alignment(); }
 
     RBNode(const Key& key, const Value& value)
-        : data(std::make_pair(key, value)), color(RED), parent(nullptr), left(nullptr), right(nullptr), height(1) {}
+        : data(std::make_pair(key, value)), left(nullptr), right(nullptr), parentColor(RED) { check_alignment(); }
 
     RBNode()
-        : data(std::make_pair(Key(), Value())), color(RED), parent(nullptr), left(nullptr), right(nullptr), height(1) {}
+        : data(std::make_pair(Key(), Value())), left(nullptr), right(nullptr), parentColor(RED) { check_alignment(); }
+
+    Nodeptr parent() const { return reinterpret_cast<Nodeptr>(parentColor & ~COLOR_MASK); }
+    void setParent(Nodeptr p) { parentColor = reinterpret_cast<uintptr_t>(p) | (parentColor & COLOR_MASK); }
+
+    Color color() const { return static_cast<Color>(parentColor & COLOR_MASK); }
+    void setColor(Color c) { parentColor = (parentColor & ~COLOR_MASK) | static_cast<uintptr_t>(c); }
+
+private:
+    static void check_alignment() {
+        static_assert(alignof(RBNode) >= 2, "O bit menos significativo do ponteiro para o pai guarda a cor");
+        static_assert(RED == 0 && BLACK == 1, "As cores devem caber em um bit");
+    }
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,585 @@
+#ifndef CONCURRENT_RB_HPP
+#define CONCURRENT_RB_HPP
+
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "ConcurrentNodeRb.hpp"
+#include "../utils/epoch.hpp"
+#include "../utils/threeWayCompare.hpp"
+
+/**
+ * @brief Árvore rubro-negra para consultas durante a ingestão: um escritor e vários leitores sem travas.
+ *
+ * O escritor executa os mesmos algoritmos de RB (inserção de baixo para cima e remoção com deleteFix).
+ * Os leitores nunca bloqueiam o escritor; a consistência é garantida por um seqlock:
+ * - Um contador de sequência global fica ímpar enquanto o escritor altera a forma da árvore
+ *   (rotações e remoções). Ligar uma nova folha e trocar cores não precisam disso: um leitor enxerga
+ *   a folha ou não, e as cores não são lidas pelos leitores.
+ * - Um leitor desce sem travas. Encontrar a chave com valor não nulo é uma resposta válida por si
+ *   só. Já "não encontrada" só é aceita se a sequência não mudou durante a descida; caso contrário,
+ *   a busca é repetida (uma rotação poderia ter tirado a chave do caminho percorrido).
+ * - Valores são imutáveis depois de publicados: atualizar troca o ponteiro. Nós removidos e valores
+ *   substituídos são liberados por épocas (EpochManager), pois um leitor ainda pode estar neles.
+ *
+ * Vários escritores são aceitos, mas são serializados por uma trava usada apenas entre eles.
+ * Como em ConcurrentAVL, get() devolve uma cópia do valor e a árvore não conta comparações.
+ *
+ * @tparam Key Tipo da chave (deve possuir construtor padrão, usado pelo nó sentinela).
+ * @tparam Value Tipo do valor associado a cada chave.
+ * @tparam Compare Política de comparação em três vias (padrão: ThreeWayCompare<Key>).
+ */
+template <typename Key, typename Value, typename Compare = ThreeWayCompare<Key>>
+class ConcurrentRB {
+private:
+    using NodeType = ConcurrentRBNode<Key, Value>;
+    using Nodeptr = NodeType*;
+
+    static constexpr int MAX_STEPS = 128; // limite de nós em uma descida (a altura real é no máximo 2 log n)
+
+    Nodeptr NIL; // Sentinela: folhas e pai da raiz
+    std::atomic<Nodeptr> root;
+    std::atomic<uint64_t> m_seq{0}; // Ímpar enquanto a forma da árvore está sendo alterada
+    unsigned m_writeDepth = 0;      // Seções de escrita aninhadas (apenas o escritor usa)
+    mutable std::mutex m_writer;    // Serializa escritores; leitores nunca a usam
+
+    std::atomic<long long> nodeCount{0};
+    std::atomic<long long> rotations{0};
+    std::atomic<long long> colors{0};
+    mutable std::atomic<long long> readRetries{0};
+    Compare m_compare; // Comparação em três vias das chaves
+    mutable EpochManager m_epoch; // Liberação segura de nós e valores removidos
+
+    // Seções de escrita do seqlock
+    void beginWrite();
+    void endWrite();
+
+    // Funções auxiliares do escritor
+    void leftRotate(Nodeptr x);
+    void rightRotate(Nodeptr y);
+    void insertFix(Nodeptr k);
+    void transplant(Nodeptr u, Nodeptr v);
+    void deleteFix(Nodeptr x);
+    void _remove(Nodeptr z);
+    Nodeptr minimum(Nodeptr node) const;
+    Nodeptr findNode(const Key& key) const;
+    void setColor(Nodeptr node, Color color);
+
+    // Funções auxiliares de leitura, memória e percurso
+    bool search(const Key& key, Value* out) const;
+    void destroy(Nodeptr node);
+    void in_Order_vec(Nodeptr node, std::vector<Key>& keys_vec) const;
+    int validate(Nodeptr node, Nodeptr parent, const Key* low, const Key* high) const;
+
+public:
+    ConcurrentRB() {
+        NIL = new NodeType(Key{}, nullptr, nullptr);
+        NIL->left.store(NIL);
+        NIL->right.store(NIL);
+        NIL->parent = NIL;
+        NIL->color = BLACK;
+        root.store(NIL);
+    }
+    ~ConcurrentRB() {
+        destroy(root.load());
+        delete NIL;
+    }
+    ConcurrentRB(const ConcurrentRB&) = delete;
+    ConcurrentRB& operator=(const ConcurrentRB&) = delete;
+
+    void add(const Key& key, const Value& value);
+    void remove(const Key& key);
+    bool find(const Key& key, Value& out) const;
+    bool contains(const Key& key) const;
+    Value get(const Key& key) const;
+    bool isEmpty() const;
+    size_t size() const;
+
+    std::vector<Key> get_all_keys_sorted() const;
+    bool validate() const;
+
+    // Funções para obter métricas
+    long long get_rotations() const;
+    long long get_colors() const;
+    long long get_read_retries() const;
+    long long get_reclaimed() const;
+};
+
+//------------- Seqlock --------------
+
+/**
+ * @brief Abre uma seção em que a forma da árvore muda (a sequência fica ímpar).
+ *
+ * Seções aninhadas (rotações dentro de uma remoção) não alteram a sequência novamente. A barreira
+ * release impede que as escritas da seção se tornem visíveis antes da sequência ímpar.
+ */
+template <typename Key, typename Value, typename Compare>
+void ConcurrentRB<Key, Value, Compare>::beginWrite() {
+    if (m_writeDepth++ == 0) {
+        m_seq.store(m_seq.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+    }
+}
+
+/**
+ * @brief Fecha a seção de escrita: a sequência volta a ser par e diferente da anterior.
+ */
+template <typename Key, typename Value, typename Compare>
+void ConcurrentRB<Key, Value, Compare>::endWrite() {
+    if (--m_writeDepth == 0) {
+        m_seq.store(m_seq.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+}
+
+//------------- Escritor --------------
+
+/**
+ * @brief Altera a cor de um nó e contabiliza a troca.
+ */
+template <typename Key, typename Value, typename Compare>
+void ConcurrentRB<Key, Value, Compare>::setColor(Nodeptr node, Color color) {
+    node->color = color;
+    colors.fetch_add(1, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Rotação à esquerda em torno de x, dentro de uma seção de escrita.
+ *
+ * A ordem das publicações mantém todo nó alcançável a partir de algum caminho; ainda assim, um leitor
+ * pode descer pelo lado errado durante a rotação, o que o seqlock detecta.
+ */
+template <typename Key, typename Value, typename Compare>
+void ConcurrentRB<Key, Value, Compare>::leftRotate(Nodeptr x) {
+    beginWrite();
+    rotations.fetch_add(1, std::memory_order_relaxed);
+
+    Nodeptr y = x->right.load();
+    Nodeptr b = y->left.load();
+    x->setRight(b);
+    if (b != NIL) b->parent = x;
+
+    y->parent = x->parent;
+    if (x->parent == NIL) root.store(y, std::memory_order_release);
+    else if (x == x->parent->left.load()) x->parent->setLeft(y);
+    else x->parent->setRight(y);
+
+    y->setLeft(x);
+    x->parent = y;
+    endWrite();
+}
+
+/**
+ * @brief Rotação à direita em torno de y, dentro de uma seção de escrita.
+ */
+template <typename Key, typename Value, typename Compare>
+void ConcurrentRB<Key, Value, Compare>::rightRotate(Nodeptr y) {
+    beginWrite();
+    rotations.fetch_add(1, std::memory_order_relaxed);
+
+    Nodeptr x = y->left.load();
+    Nodeptr b = x->right.load();
+    y->setLeft(b);
+    if (b != NIL) b->parent = y;
+
+    x->parent = y->parent;
+    if (y->parent == NIL) root.store(x, std::memory_order_release);
+    else if (y == y->parent->right.load()) y->parent->setRight(x);
+    else y->parent->setLeft(x);
+
+    x->setRight(y);
+    y->parent = x;
+    endWrite();
+}
+
+/**
+ * @brief Restaura as propriedades após a inserção de k (mesmo algoritmo de RB::insertFix).
+ */
+template <typename Key, typename Value, typename Compare>
+void ConcurrentRB<Key, Value, Compare>::insertFix(Nodeptr k) {
+    while (k != root.load() && k->parent->color == RED) {
+        Nodeptr g = k->parent->parent;
+        if (k->parent == g->right.load()) {
+            Nodeptr u = g->left.load();
+            if (u->color == RED) {
+                setColor(u, BLACK);
+                setColor(k->parent, BLACK);
+                setColor(g, RED);
+                k = g;
+            } else {
+                if (k == k->parent->left.load()) {
+                    k = k->parent;
+                    rightRotate(k);
+                }
+                setColor(k->parent, BLACK);
+                setColor(k->parent->parent, RED);
+                leftRotate(k->parent->parent);
+            }
+        } else {
+            Nodeptr u = g->right.load();
+            if (u->color == RED) {
+                setColor(u, BLACK);
+                setColor(k->parent, BLACK);
+                setColor(g, RED);
+                k = g;
+            } else {
+                if (k == k->parent->right.load()) {
+                    k = k->parent;
+                    leftRotate(k);
+                }
+                setColor(k->parent, BLACK);
+                setColor(k->parent->parent, RED);
+                rightRotate(k->parent->parent);
+            }
+        }
+    }
+    Nodeptr r = root.load();
+    if (r->color != BLACK) setColor(r, BLACK);
+}
+
+/**
+ * @brief Substitui a subárvore u pela subárvore v (v pode ser NIL, cujo pai passa a ser o de u).
+ */
+template <typename Key, typename Value, typename Compare>
+void ConcurrentRB<Key, Value, Compare>::transplant(Nodeptr u, Nodeptr v) {
+    if (u->parent == NIL) root.store(v, std::memory_order_release);
+    else if (u == u->parent->left.load()) u->parent->setLeft(v);
+    else u->parent->setRight(v);
+    v->parent = u->parent;
+}
+
+/**
+ * @brief Restaura as propriedades após a remoção de um nó preto (mesmo algoritmo de RB::deleteFix).
+ */
+template <typename Key, typename Value, typename Compare>
+void ConcurrentRB<Key, Value, Compare>::deleteFix(Nodeptr x) {
+    while (x != root.load() && x->color == BLACK) {
+        Nodeptr p = x->parent;
+        if (x == p->left.load()) {
+            Nodeptr s = p->right.load();
+            if (s->color == RED) {
+                setColor(s, BLACK);
+                setColor(p, RED);
+                leftRotate(p);
+                s = p->right.load();
+            }
+            if (s->left.load()->color == BLACK && s->right.load()->color == BLACK) {
+                setColor(s, RED);
+                x = p;
+            } else {
+                if (s->right.load()->color == BLACK) {
+                    setColor(s->left.load(), BLACK);
+                    setColor(s, RED);
+                    rightRotate(s);
+                    s = p->right.load();
+                }
+                setColor(s, p->color);
+                setColor(p, BLACK);
+                setColor(s->right.load(), BLACK);
+                leftRotate(p);
+                x = root.load();
+            }
+        } else {
+            Nodeptr s = p->left.load();
+            if (s->color == RED) {
+                setColor(s, BLACK);
+                setColor(p, RED);
+                rightRotate(p);
+                s = p->left.load();
+            }
+            if (s->left.load()->color == BLACK && s->right.load()->color == BLACK) {
+                setColor(s, RED);
+                x = p;
+            } else {
+                if (s->left.load()->color == BLACK) {
+                    setColor(s->right.load(), BLACK);
+                    setColor(s, RED);
+                    leftRotate(s);
+                    s = p->left.load();
+                }
+                setColor(s, p->color);
+                setColor(p, BLACK);
+                setColor(s->left.load(), BLACK);
+                rightRotate(p);
+                x = root.load();
+            }
+        }
+    }
+    if (x->color != BLACK) setColor(x, BLACK);
+}
+
+/**
+ * @brief Retorna o nó de menor chave da subárvore (que não pode ser NIL).
+ */
+template <typename Key, typename Value, typename Compare>
+typename ConcurrentRB<Key, Value, Compare>::Nodeptr ConcurrentRB<Key, Value, Compare>::minimum(Nodeptr node) const {
+    while (node->left.load() != NIL) node = node->left.load();
+    return node;
+}
+
+/**
+ * @brief Busca feita pelo escritor (com a trava de escritores): a árvore não muda durante a descida.
+ */
+template <typename Key, typename Value, typename Compare>
+typename ConcurrentRB<Key, Value, Compare>::Nodeptr ConcurrentRB<Key, Value, Compare>::findNode(const Key& key) const {
+    Nodeptr node = root.load();
+    while (node != NIL) {
+        int cmp = m_compare(key, node->key);
+        if (cmp == 0) return node;
+        node = (cmp < 0) ? node->left.load() : node->right.load();
+    }
+    return NIL;
+}
+
+/**
+ * @brief Remove o nó z (como RB::_remove), com toda a alteração dentro de uma única seção de escrita.
+ *
+ * O valor é anulado antes de o nó ser desligado, para que um leitor que ainda o alcance trate a chave
+ * como ausente e valide a sequência. O nó e o valor são aposentados, não apagados.
+ */
+template <typename Key, typename Value, typename Compare>
+void ConcurrentRB<Key, Value, Compare>::_remove(Nodeptr z) {
+    beginWrite();
+    Value* old = z->value.exchange(nullptr);
+
+    Nodeptr x;
+    Nodeptr y = z;
+    Color y_original_color = y->color;
+
+    if (z->left.load() == NIL) {
+        x = z->right.load();
+        transplant(z, x);
+    } else if (z->right.load() == NIL) {
+        x = z->left.load();
+        transplant(z, x);
+    } else {
+        y = minimum(z->right.load());
+        y_original_color = y->color;
+        x = y->right.load();
+        if (y->parent == z) {
+            x->parent = y; // Também em NIL: deleteFix sobe a partir de x->parent
+        } else {
+            transplant(y, x);
+            y->setRight(z->right.load());
+            y->right.load()->parent = y;
+        }
+        y->setLeft(z->left.load());
+        y->left.load()->parent = y;
+        y->color = z->color;
+        transplant(z, y);
+    }
+
+    if (y_original_color == BLACK) deleteFix(x);
+    endWrite();
+
+    nodeCount.fetch_sub(1, std::memory_order_relaxed);
+    m_epoch.retire([old]() { delete old; });
+    m_epoch.retire([z]() { delete z; });
+}
+
+/**
+ * @brief Insere um novo par chave-valor ou atualiza o valor de uma chave existente.
+ *
+ * A descida e a ligação da nova folha não abrem seção de escrita; apenas as rotações de insertFix o fazem.
+ * Uma atualização publica um novo objeto de valor e aposenta o anterior.
+ */
+template <typename Key, typename Value, typename Compare>
+void ConcurrentRB<Key, Value, Compare>::add(const Key& key, const Value& value) {
+    std::lock_guard<std::mutex> lock(m_writer);
+    EpochGuard guard(m_epoch);
+
+    Nodeptr y = NIL;
+    Nodeptr x = root.load();
+    int cmp = 0;
+    while (x != NIL) {
+        y = x;
+        cmp = m_compare(key, x->key);
+        if (cmp == 0) {
+            Value* old = x->value.exchange(new Value(value));
+            m_epoch.retire([old]() { delete old; });
+            return;
+        }
+        x = (cmp < 0) ? x->left.load() : x->right.load();
+    }
+
+    Nodeptr node = new NodeType(key, new Value(value), NIL);
+    node->parent = y;
+    if (y == NIL) root.store(node, std::memory_order_release);
+    else if (cmp < 0) y->setLeft(node);
+    else y->setRight(node);
+    nodeCount.fetch_add(1, std::memory_order_relaxed);
+
+    insertFix(node);
+}
+
+/**
+ * @brief Remove a chave da árvore, se ela existir.
+ */
+template <typename Key, typename Value, typename Compare>
+void ConcurrentRB<Key, Value, Compare>::remove(const Key& key) {
+    std::lock_guard<std::mutex> lock(m_writer);
+    EpochGuard guard(m_epoch);
+
+    Nodeptr node = findNode(key);
+    if (node != NIL) _remove(node);
+}
+
+//------------- Leitores --------------
+
+/**
+ * @brief Descida sem travas validada pelo seqlock.
+ *
+ * @param key Chave procurada.
+ * @param out Se não for nulo, recebe uma cópia do valor encontrado.
+ * @return true se a chave estiver presente.
+ */
+template <typename Key, typename Value, typename Compare>
+bool ConcurrentRB<Key, Value, Compare>::search(const Key& key, Value* out) const {
+    EpochGuard guard(m_epoch);
+    while (true) {
+        uint64_t seq = m_seq.load(std::memory_order_acquire);
+        if (seq & 1) { // Rotação em andamento: cede o processador ao escritor
+            std::this_thread::yield();
+            continue;
+        }
+
+        Nodeptr node = root.load(std::memory_order_acquire);
+        for (int steps = 0; node != NIL && steps < MAX_STEPS; ++steps) {
+            int cmp = m_compare(key, node->key);
+            if (cmp == 0) {
+                Value* value = node->value.load(std::memory_order_acquire);
+                if (value) {
+                    if (out) *out = *value;
+                    return true;
+                }
+                break; // Nó sendo removido
+            }
+            node = (cmp < 0) ? node->left.load(std::memory_order_acquire) : node->right.load(std::memory_order_acquire);
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (m_seq.load(std::memory_order_relaxed) == seq) return false;
+        readRetries.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief Procura a chave e, se encontrada, copia o seu valor para out.
+ */
+template <typename Key, typename Value, typename Compare>
+bool ConcurrentRB<Key, Value, Compare>::find(const Key& key, Value& out) const {
+    return search(key, &out);
+}
+
+/**
+ * @brief Verifica se a chave está presente.
+ */
+template <typename Key, typename Value, typename Compare>
+bool ConcurrentRB<Key, Value, Compare>::contains(const Key& key) const {
+    return search(key, nullptr);
+}
+
+/**
+ * @brief Retorna uma cópia do valor associado à chave.
+ *
+ * @throws std::runtime_error se a chave não estiver presente.
+ */
+template <typename Key, typename Value, typename Compare>
+Value ConcurrentRB<Key, Value, Compare>::get(const Key& key) const {
+    Value value{};
+    if (!search(key, &value)) {
+        throw std::runtime_error("Chave não encontrada");
+    }
+    return value;
+}
+
+template <typename Key, typename Value, typename Compare>
+bool ConcurrentRB<Key, Value, Compare>::isEmpty() const {
+    return nodeCount.load() == 0;
+}
+
+template <typename Key, typename Value, typename Compare>
+size_t ConcurrentRB<Key, Value, Compare>::size() const {
+    return static_cast<size_t>(nodeCount.load());
+}
+
+//------------- Percurso, validação e memória --------------
+
+template <typename Key, typename Value, typename Compare>
+void ConcurrentRB<Key, Value, Compare>::destroy(Nodeptr node) {
+    if (node == NIL) return;
+    destroy(node->left.load());
+    destroy(node->right.load());
+    delete node->value.load();
+    delete node;
+}
+
+template <typename Key, typename Value, typename Compare>
+void ConcurrentRB<Key, Value, Compare>::in_Order_vec(Nodeptr node, std::vector<Key>& keys_vec) const {
+    if (node == NIL) return;
+    in_Order_vec(node->left.load(), keys_vec);
+    keys_vec.push_back(node->key);
+    in_Order_vec(node->right.load(), keys_vec);
+}
+
+/**
+ * @brief Retorna as chaves em ordem. Usa a trava de escritores: não é uma operação de leitura concorrente.
+ */
+template <typename Key, typename Value, typename Compare>
+std::vector<Key> ConcurrentRB<Key, Value, Compare>::get_all_keys_sorted() const {
+    std::lock_guard<std::mutex> lock(m_writer);
+    std::vector<Key> keys_vec;
+    keys_vec.reserve(size());
+    in_Order_vec(root.load(), keys_vec);
+    return keys_vec;
+}
+
+/**
+ * @brief Verifica recursivamente ordem das chaves, ponteiros para o pai, ausência de vermelho-vermelho e altura negra.
+ *
+ * @return int Altura negra da subárvore, ou -1 se alguma propriedade for violada.
+ */
+template <typename Key, typename Value, typename Compare>
+int ConcurrentRB<Key, Value, Compare>::validate(Nodeptr node, Nodeptr parent, const Key* low, const Key* high) const {
+    if (node == NIL) return 1;
+
+    if (node->parent != parent || !node->value.load()) return -1;
+    if ((low && m_compare(node->key, *low) <= 0) || (high && m_compare(node->key, *high) >= 0)) return -1;
+    if (node->color == RED && (node->left.load()->color == RED || node->right.load()->color == RED)) return -1;
+
+    int bl = validate(node->left.load(), node, low, &node->key);
+    int br = validate(node->right.load(), node, &node->key, high);
+    if (bl < 0 || bl != br) return -1;
+
+    return bl + (node->color == BLACK ? 1 : 0);
+}
+
+/**
+ * @brief Verifica as propriedades da árvore rubro-negra (usada nos testes; trava escritores).
+ */
+template <typename Key, typename Value, typename Compare>
+bool ConcurrentRB<Key, Value, Compare>::validate() const {
+    std::lock_guard<std::mutex> lock(m_writer);
+    Nodeptr r = root.load();
+    return r->color == BLACK && validate(r, NIL, nullptr, nullptr) > 0;
+}
+
+//------------- Métricas --------------
+
+template <typename Key, typename Value, typename Compare>
+long long ConcurrentRB<Key, Value, Compare>::get_rotations() const { return rotations.load(); }
+
+template <typename Key, typename Value, typename Compare>
+long long ConcurrentRB<Key, Value, Compare>::get_colors() const { return colors.load(); }
+
+/**
+ * @brief Retorna quantas descidas de leitores foram repetidas porque a árvore mudou de forma durante elas.
+ */
+template <typename Key, typename Value, typename Compare>
+long long ConcurrentRB<Key, Value, Compare>::get_read_retries() const { return readRetries.load(); }
+
+template <typename Key, typename Value, typename Compare>
+long long ConcurrentRB<Key, Value, Compare>::get_reclaimed() const { return m_epoch.get_reclaimed(); }
+
+#endif
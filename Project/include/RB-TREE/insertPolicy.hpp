@@ -0,0 +1,18 @@
+#ifndef RB_INSERT_POLICY_HPP
+#define RB_INSERT_POLICY_HPP
+
+/**
+ * @brief Políticas de inserção da árvore rubro-negra, escolhidas pelo último parâmetro de template de RB.
+ *
+ * - BottomUpInsert: desce até uma folha, insere o nó vermelho e depois sobe pelos ponteiros para o
+ *   pai com insertFix, recolorindo e rotacionando (algoritmo clássico; padrão).
+ * - TopDownInsert: em uma única passada, divide na descida todo 4-nó (nó preto com dois filhos
+ *   vermelhos) por uma troca de cores, seguida de no máximo uma rotação simples ou dupla. Ao chegar
+ *   à folha, o novo nó só pode violar a regra vermelho-vermelho com o próprio pai, o que se corrige
+ *   localmente: nenhuma subida é necessária. Como a inserção só altera nós perto da posição corrente,
+ *   é uma boa base para travamento mais fino.
+ */
+struct BottomUpInsert {};
+struct TopDownInsert {};
+
+#endif
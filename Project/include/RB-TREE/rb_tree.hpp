@@ -4,14 +4,22 @@
 #include <iostream>
 #include <utility>
 #include <stdexcept>
+#include <type_traits>
 #include "../Dictionaty/IDictionary.hpp"
 #include "NodeRb.hpp"
+#include "insertPolicy.hpp"
+#include "../utils/threeWayCompare.hpp"
+#include "../Frozen/frozenTree.hpp"
+#include "../utils/frontCache.hpp"
+#include "../utils/nodePool.hpp"
 
 /**
  * @brief Classe template para implementação de uma Árvore Rubro-Negra (Red-Black Tree).
  * 
  * @tparam Key Tipo da chave utilizada para indexação dos nós.
  * @tparam Value Tipo do valor armazenado em cada nó.
+ * @tparam Compare Política de comparação em três vias (padrão: ThreeWayCompare<Key>).
+ * @tparam InsertPolicy Política de inserção: BottomUpInsert (padrão) ou TopDownInsert (ver insertPolicy.hpp).
  * 
  * Esta classe implementa uma árvore rubro-negra, uma estrutura de dados balanceada
  * que garante operações de inserção, remoção e busca em tempo O(log n).
@@ -33,7 +41,7 @@
  * 
  * Observação: A classe gerencia automaticamente a memória dos nós.
  */
-template <typename Key, typename Value>
+template <typename Key, typename Value, typename Compare = ThreeWayCompare<Key>, typename InsertPolicy = BottomUpInsert>
 class RB : public IDictionary<Key, Value> {
 private:
     using Nodeptr = RBNode<Key, Value>*;
@@ -45,24 +53,92 @@ private:
     mutable long long rotations = 0;
     mutable long long colors = 0;
     int nodeCount = 0;
+    Compare m_compare; // Comparação em três vias das chaves
+    mutable FrontCache<Key, Nodeptr> m_cache; // Cache opcional de chaves frequentes
+    NodePool<RBNode<Key, Value>> m_pool; // Blocos de onde os nós são alocados
+    Nodeptr m_rightmost; // Nó de maior chave (TNULL com a árvore vazia)
+    bool m_appendRun = false; // A última inserção foi no fim da ordem: tenta o atalho pelo maior nó
 
     void initializeTNULL();
     void leftRotate(Nodeptr x);
     void rightRotate(Nodeptr y);
     void insertFix(Nodeptr k);
+    void fixRedParent(Nodeptr k);
+    void splitFourNode(Nodeptr x);
     void transplant(Nodeptr u, Nodeptr v);
     void deleteFix(Nodeptr x);
     void destroy(Nodeptr node);
-    void _insert(const Key& key, const Value& value_to_add);
+    Nodeptr attach(Nodeptr parent, int side, const Key& key, const Value& value_to_add);
+    Nodeptr _insert(const Key& key, const Value& value_to_add);
+    Nodeptr _insert_top_down(const Key& key, const Value& value_to_add);
     void _remove(Nodeptr node);
-    Nodeptr minimum(Nodeptr node);
+    Nodeptr minimum(Nodeptr node) const;
+    Nodeptr maximum(Nodeptr node) const;
+    Nodeptr successor(Nodeptr node) const;
+    Nodeptr predecessor(Nodeptr node) const;
     Nodeptr findNode(const Key& key) const;
+    Nodeptr lookup(const Key& key) const;
     void in_Order_vec(Nodeptr node, std::vector<Key>& vec) const;
+    void in_Order_pairs(Nodeptr node, std::vector<std::pair<Key, Value>>& pairs) const;
+    int validate(Nodeptr node, Nodeptr parent, const Key* low, const Key* high) const;
 
 public:
+    /**
+     * @brief Iterador bidirecional que percorre os pares em ordem crescente de chave.
+     *
+     * Avança e recua pelos ponteiros para o pai, sem pilha auxiliar. end() é representado por TNULL.
+     * Permanece válido enquanto o nó apontado não for removido (rotações não movem os dados dos nós).
+     */
+    class iterator {
+    private:
+        friend class RB;
+        const RB* m_tree = nullptr;
+        Nodeptr m_node = nullptr;
+
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = std::pair<const Key&, Value&>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = value_type;
+
+        iterator() = default;
+        iterator(const RB* tree, Nodeptr node) : m_tree(tree), m_node(node) {}
+
+        const Key& key() const { return m_node->data.first; }
+        Value& value() const { return m_node->data.second; }
+        reference operator*() const { return reference(key(), value()); }
+
+        iterator& operator++() {
+            m_node = m_tree->successor(m_node);
+            return *this;
+        }
+
+        iterator operator++(int) {
+            iterator old = *this;
+            ++(*this);
+            return old;
+        }
+
+        iterator& operator--() {
+            m_node = (m_node == m_tree->TNULL) ? m_tree->m_rightmost : m_tree->predecessor(m_node);
+            return *this;
+        }
+
+        iterator operator--(int) {
+            iterator old = *this;
+            --(*this);
+            return old;
+        }
+
+        bool operator==(const iterator& other) const { return m_node == other.m_node; }
+        bool operator!=(const iterator& other) const { return m_node != other.m_node; }
+    };
+
     RB() {
         initializeTNULL();
         root = TNULL;
+        m_rightmost = TNULL;
         nodeCount = 0;
         comparisons = 0;
         rotations = 0;
@@ -71,24 +147,38 @@ public:
 
     ~RB() {
         destroy(root);
+        m_pool.release();
         delete TNULL;
     }
 
     void clear();
     void print() const; // Função de impressão para depuração
     void add(const Key& key, const Value& value_to_add) override;
+    iterator add_hint(iterator hint, const Key& key, const Value& value_to_add);
     void remove(const Key& key) override;
     bool isEmpty() const override;
     bool contains(const Key& key) const override;
     size_t size() const override;
     const Value& get(const Key& key) const override;
     std::vector<Key> get_all_keys_sorted() const override;
+    FrozenTree<Key, Value, Compare> freeze() const;
+    void enable_front_cache(size_t slots = 1024);
+    bool validate() const;
+
+    iterator begin() const { return iterator(this, root == TNULL ? TNULL : minimum(root)); }
+    iterator end() const { return iterator(this, TNULL); }
+    iterator find(const Key& key) const { return iterator(this, lookup(key)); }
 
     // Getters para métricas
     long long get_comparisons() const override;
     long long get_rotations() const override;
     long long get_colors() const override;
     long long get_collisions() const override;
+    size_t get_node_bytes() const override;
+    long long get_rehashes() const override;
+    void reserve(size_t n) override;
+    long long get_cache_hits() const;
+    long long get_cache_misses() const;
 
 private:
     void printTree(Nodeptr node, std::string prefix = "", bool isLeft = true) const;
@@ -105,8 +195,8 @@ private:
  * @param node Ponteiro para o nó atual da árvore a ser visitado.
  * @param keys_vec Referência para o vetor onde as chaves serão armazenadas em ordem.
  */
-template <typename Key, typename Value>
-void RB<Key, Value>::in_Order_vec(Nodeptr node, std::vector<Key>& keys_vec) const{
+template <typename Key, typename Value, typename Compare, typename InsertPolicy>
+void RB<Key, Value, Compare, InsertPolicy>::in_Order_vec(Nodeptr node, std::vector<Key>& keys_vec) const{
     if (node == TNULL) return;
     
     in_Order_vec(node->left, keys_vec);
@@ -123,8 +213,8 @@ void RB<Key, Value>::in_Order_vec(Nodeptr node, std::vector<Key>& keys_vec) cons
  *
  * @return std::vector<Key> Vetor com todas as chaves da árvore em ordem crescente.
  */
-template <typename Key, typename Value>
-std::vector<Key> RB<Key, Value>::get_all_keys_sorted() const {
+template <typename Key, typename Value, typename Compare, typename InsertPolicy>
+std::vector<Key> RB<Key, Value, Compare, InsertPolicy>::get_all_keys_sorted() const {
     std::vector<Key> keys_vec;
     if (this->isEmpty()) {
         return {}; 
@@ -136,6 +226,37 @@ std::vector<Key> RB<Key, Value>::get_all_keys_sorted() const {
     return keys_vec;
 }
 
+/**
+ * @brief Coleta os pares (chave, valor) da árvore rubro-negra em ordem crescente de chave.
+ *
+ * @param node Ponteiro para o nó atual da árvore a ser visitado.
+ * @param pairs Vetor onde os pares serão armazenados em ordem.
+ */
+template <typename Key, typename Value, typename Compare, typename InsertPolicy>
+void RB<Key, Value, Compare, InsertPolicy>::in_Order_pairs(Nodeptr node, std::vector<std::pair<Key, Value>>& pairs) const{
+    if (node == TNULL) return;
+
+    in_Order_pairs(node->left, pairs);
+    pairs.push_back(node->data);
+    in_Order_pairs(node->right, pairs);
+}
+
+/**
+ * @brief Gera uma cópia imutável da árvore em layout contíguo otimizado para leitura.
+ *
+ * Indicada quando a ingestão terminou e o dicionário passa a ser apenas consultado. A árvore
+ * original não é alterada e pode continuar sendo usada.
+ *
+ * @return FrozenTree<Key, Value, Compare> Estrutura congelada com as mesmas chaves e valores.
+ */
+template <typename Key, typename Value, typename Compare, typename InsertPolicy>
+FrozenTree<Key, Value, Compare> RB<Key, Value, Compare, InsertPolicy>::freeze() const {
+    std::vector<std::pair<Key, Value>> pairs;
+    pairs.reserve(this->size());
+    in_Order_pairs(root, pairs);
+    return FrozenTree<Key, Value, Compare>(std::move(pairs));
+}
+
 /**
  * @brief Inicializa o nó sentinela TNULL da Árvore Rubro-Negra.
  *
@@ -144,30 +265,31 @@ std::vector<Key> RB<Key, Value>::get_all_keys_sorted() const {
  * Esse nó é utilizado para representar a ausência de um filho na árvore, simplificando as operações
  * e garantindo que todas as folhas sejam pretas, conforme exigido pelas propriedades da Árvore Rubro-Negra.
  */
-template <typename Key, typename Value>
-void RB<Key, Value>::initializeTNULL() {
+template <typename Key, typename Value, typename Compare, typename InsertPolicy>
+void RB<Key, Value, Compare, InsertPolicy>::initializeTNULL() {
     TNULL = new RBNode<Key, Value>();
-    TNULL->color = BLACK;
+    TNULL->setColor(BLACK);
     TNULL->left = nullptr;
     TNULL->right = nullptr;
-    TNULL->parent = nullptr;
+    TNULL->setParent(nullptr);
 }
 
 /**
- * @brief Desaloca recursivamente todos os nós da subárvore a partir do nó fornecido.
+ * @brief Chama os destrutores de todos os nós da subárvore a partir do nó fornecido.
  *
- * Esta função realiza uma travessia pós-ordem para deletar com segurança todos os nós da subárvore,
- * garantindo que os filhos esquerdo e direito sejam deletados antes do próprio nó pai.
- * É normalmente utilizada para liberar a memória ao destruir toda a árvore rubro-negra.
+ * A memória dos nós pertence ao pool e é devolvida de uma vez por m_pool.release(), chamado em
+ * seguida pelo destrutor e por clear(). Se os nós forem trivialmente destrutíveis (por exemplo,
+ * chaves e valores inteiros), não há nada a percorrer e a função retorna imediatamente.
  *
- * @param node Ponteiro para a raiz da subárvore a ser destruída. Se node for TNULL, a função retorna imediatamente.
+ * @param node Ponteiro para a raiz da subárvore. Se node for TNULL, a função retorna imediatamente.
  */
-template <typename Key, typename Value>
-void RB<Key, Value>::destroy(Nodeptr node) {
+template <typename Key, typename Value, typename Compare, typename InsertPolicy>
+void RB<Key, Value, Compare, InsertPolicy>::destroy(Nodeptr node) {
+    if (std::is_trivially_destructible<RBNode<Key, Value>>::value) return;
     if (node == TNULL) return;
     destroy(node->left);
     destroy(node->right);
-    delete node;
+    node->~RBNode();
 }
 
 /**
@@ -175,29 +297,57 @@ void RB<Key, Value>::destroy(Nodeptr node) {
  *
  * Esta função percorre a árvore rubro-negra a partir da raiz, comparando a chave fornecida
  * com as chaves dos nós existentes. Se a chave for menor que a do nó atual, a busca segue para a subárvore à esquerda;
- * se for maior, segue para a subárvore à direita. O número de comparações realizadas é contabilizado na variável 'comparisons'.
+ * se for maior, segue para a subárvore à direita. Cada nó visitado custa uma única comparação em três vias,
+ * contabilizada na variável 'comparisons'.
  * 
  * @param key A chave a ser buscada na árvore.
  * @return Nodeptr Um ponteiro para o nó encontrado com a chave correspondente, ou TNULL caso a chave não exista na árvore.
  */
-template <typename Key, typename Value>
-typename RB<Key, Value>::Nodeptr RB<Key, Value>::findNode(const Key& key) const {
+template <typename Key, typename Value, typename Compare, typename InsertPolicy>
+typename RB<Key, Value, Compare, InsertPolicy>::Nodeptr RB<Key, Value, Compare, InsertPolicy>::findNode(const Key& key) const {
     Nodeptr current = root;
     while (current != TNULL) {
-        if (key < current->data.first) {
-            comparisons++;
+        comparisons++;
+        int cmp = m_compare(key, current->data.first);
+        if (cmp < 0) {
             current = current->left;
-        } else if (key > current->data.first) {
-            comparisons += 2;
+        } else if (cmp > 0) {
             current = current->right;
         } else {
-            comparisons += 2;
             return current;
         }
     }
     return TNULL;
 }
 
+/**
+ * @brief Procura a chave consultando primeiro o cache de chaves frequentes, se ativo.
+ *
+ * Em caso de acerto, a descida pela árvore é evitada. Em caso de falta, a busca normal é
+ * feita e o nó encontrado passa a ocupar a posição da chave no cache.
+ *
+ * @param key A chave a ser buscada na árvore.
+ * @return Nodeptr Ponteiro para o nó encontrado, ou TNULL caso a chave não exista na árvore.
+ */
+template <typename Key, typename Value, typename Compare, typename InsertPolicy>
+typename RB<Key, Value, Compare, InsertPolicy>::Nodeptr RB<Key, Value, Compare, InsertPolicy>::lookup(const Key& key) const {
+    if (!m_cache.enabled()) {
+        return findNode(key);
+    }
+
+    size_t slot = m_cache.slot_of(key);
+    Nodeptr node = m_cache.lookup(key, slot);
+    if (node) {
+        return node;
+    }
+
+    node = findNode(key);
+    if (node != TNULL) {
+        m_cache.store(slot, node);
+    }
+    return node;
+}
+
 /**
  * @brief Realiza uma rotação para a esquerda em torno do nó x em uma árvore rubro-negra.
  *
@@ -209,23 +359,23 @@ typename RB<Key, Value>::Nodeptr RB<Key, Value>::findNode(const Key& key) const
  * @tparam Value Tipo do valor associado à chave.
  * @param x Ponteiro para o nó em torno do qual a rotação será realizada.
  */
-template <typename Key, typename Value>
-void RB<Key, Value>::leftRotate(Nodeptr x) {
+template <typename Key, typename Value, typename Compare, typename InsertPolicy>
+void RB<Key, Value, Compare, InsertPolicy>::leftRotate(Nodeptr x) {
     rotations++;
 
     Nodeptr y = x->right;
     x->right = y->left;
 
-    if (y->left != TNULL) y->left->parent = x;
+    if (y->left != TNULL) y->left->setParent(x);
 
-    y->parent = x->parent;
+    y->setParent(x->parent());
 
-    if (y->parent == TNULL) root = y;
-    else if (x == x->parent->left) x->parent->left = y;
-    else x->parent->right = y;
+    if (y->parent() == TNULL) root = y;
+    else if (x == x->parent()->left) x->parent()->left = y;
+    else x->parent()->right = y;
 
     y->left = x;
-    x->parent = y;
+    x->setParent(y);
 }
 
 /**
@@ -239,23 +389,23 @@ void RB<Key, Value>::leftRotate(Nodeptr x) {
  * @tparam Value Tipo do valor associado à chave.
  * @param y Ponteiro para o nó em torno do qual a rotação à direita será realizada.
  */
-template <typename Key, typename Value>
-void RB<Key, Value>::rightRotate(Nodeptr y) {
+template <typename Key, typename Value, typename Compare, typename InsertPolicy>
+void RB<Key, Value, Compare, InsertPolicy>::rightRotate(Nodeptr y) {
     rotations++;
 
     Nodeptr x = y->left;
     y->left = x->right;
 
-    if (x->right != TNULL) x->right->parent = y;
+    if (x->right != TNULL) x->right->setParent(y);
     
     
-    x->parent = y->parent;
-    if (y->parent == TNULL) root = x;
-    else if (y == y->parent->right) y->parent->right = x;
-    else y->parent->left = x;
+    x->setParent(y->parent());
+    if (y->parent() == TNULL) root = x;
+    else if (y == y->parent()->right) y->parent()->right = x;
+    else y->parent()->left = x;
     
     x->right = y;
-    y->parent = x;
+    y->setParent(x);
 }
 
 /**
@@ -273,56 +423,111 @@ void RB<Key, Value>::rightRotate(Nodeptr y) {
  *
  * @note A função utiliza as funções auxiliares `leftRotate` e `rightRotate` para realizar rotações
  */
-template <typename Key, typename Value>
-void RB<Key, Value>::insertFix(Nodeptr k) {
+template <typename Key, typename Value, typename Compare, typename InsertPolicy>
+void RB<Key, Value, Compare, InsertPolicy>::insertFix(Nodeptr k) {
     Nodeptr u;
 
-    while (k != root && k->parent->color == RED) {
-        if (k->parent == k->parent->parent->right) {
-            u = k->parent->parent->left;
+    while (k != root && k->parent()->color() == RED) {
+        if (k->parent() == k->parent()->parent()->right) {
+            u = k->parent()->parent()->left;
 
-            if (u->color == RED) {
-                u->color = BLACK; colors++;
-                k->parent->color = BLACK; colors++;
-                k->parent->parent->color = RED; colors++;
+            if (u->color() == RED) {
+                u->setColor(BLACK); colors++;
+                k->parent()->setColor(BLACK); colors++;
+                k->parent()->parent()->setColor(RED); colors++;
 
-                k = k->parent->parent;
+                k = k->parent()->parent();
             } else {
-                if (k == k->parent->left) {
-                    k = k->parent;
+                if (k == k->parent()->left) {
+                    k = k->parent();
                     rightRotate(k);
                 }
 
-                k->parent->color = BLACK; colors++;
-                k->parent->parent->color = RED; colors++;
-                leftRotate(k->parent->parent);
+                k->parent()->setColor(BLACK); colors++;
+                k->parent()->parent()->setColor(RED); colors++;
+                leftRotate(k->parent()->parent());
             }
         } else {
-            u = k->parent->parent->right;
+            u = k->parent()->parent()->right;
 
-            if (u->color == RED) {
-                u->color = BLACK; colors++;
-                k->parent->color = BLACK; colors++;
-                k->parent->parent->color = RED; colors++;
-                k = k->parent->parent;
+            if (u->color() == RED) {
+                u->setColor(BLACK); colors++;
+                k->parent()->setColor(BLACK); colors++;
+                k->parent()->parent()->setColor(RED); colors++;
+                k = k->parent()->parent();
             } else {
-                if (k == k->parent->right) {
-                    k = k->parent;
+                if (k == k->parent()->right) {
+                    k = k->parent();
                     leftRotate(k);
                 }
             
-                k->parent->color = BLACK; colors++;
-                k->parent->parent->color = RED; colors++;
-                rightRotate(k->parent->parent);
+                k->parent()->setColor(BLACK); colors++;
+                k->parent()->parent()->setColor(RED); colors++;
+                rightRotate(k->parent()->parent());
             }
         }
     }
-    if (root->color != BLACK) {
-        root->color = BLACK;
+    if (root->color() != BLACK) {
+        root->setColor(BLACK);
         colors++;
     }
 }
 
+/**
+ * @brief Corrige, com no máximo duas rotações, um nó vermelho cujo pai também é vermelho e cujo tio é preto.
+ *
+ * É o caso terminal de insertFix, usado pela inserção de cima para baixo: como ela divide os 4-nós
+ * durante a descida, o tio de um nó com pai vermelho é sempre preto e a correção nunca se propaga.
+ * Se k for neto "interno" do avô, uma rotação no pai o torna externo; em seguida o pai (ou o próprio k)
+ * fica preto, o avô fica vermelho e uma rotação no avô restaura as propriedades.
+ *
+ * @param k Ponteiro para o nó vermelho com pai vermelho.
+ */
+template <typename Key, typename Value, typename Compare, typename InsertPolicy>
+void RB<Key, Value, Compare, InsertPolicy>::fixRedParent(Nodeptr k) {
+    Nodeptr p = k->parent();
+    Nodeptr g = p->parent();
+
+    if (p == g->left) {
+        if (k == p->right) {
+            leftRotate(p);
+            p = k;
+        }
+        p->setColor(BLACK); colors++;
+        g->setColor(RED); colors++;
+        rightRotate(g);
+    } else {
+        if (k == p->left) {
+            rightRotate(p);
+            p = k;
+        }
+        p->setColor(BLACK); colors++;
+        g->setColor(RED); colors++;
+        leftRotate(g);
+    }
+}
+
+/**
+ * @brief Divide o 4-nó enraizado em x (x com dois filhos vermelhos) durante a descida de cima para baixo.
+ *
+ * Os filhos ficam pretos e x fica vermelho, o que não altera a altura negra. Se x for a raiz, ele volta
+ * a ser preto; se o pai de x for vermelho, fixRedParent corrige a violação localmente.
+ *
+ * @param x Ponteiro para o nó com dois filhos vermelhos.
+ */
+template <typename Key, typename Value, typename Compare, typename InsertPolicy>
+void RB<Key, Value, Compare, InsertPolicy>::splitFourNode(Nodeptr x) {
+    x->setColor(RED); colors++;
+    x->left->setColor(BLACK); colors++;
+    x->right->setColor(BLACK); colors++;
+
+    if (x == root) {
+        x->setColor(BLACK); colors++;
+    } else if (x->parent()->color() == RED) {
+        fixRedParent(x);
+    }
+}
+
 /**
  * @brief Substitui um subárvore por outra dentro da árvore rubro-negra.
  *
@@ -338,17 +543,17 @@ void RB<Key, Value>::insertFix(Nodeptr k) {
  * @note Após a chamada, o pai de 'u' passa a apontar para 'v' e o pai de 'v' é atualizado para ser o pai de 'u'.
  *       Se 'u' for a raiz, 'v' se torna a nova raiz.
  */
-template <typename Key, typename Value>
-void RB<Key, Value>::transplant(Nodeptr u, Nodeptr v) {
+template <typename Key, typename Value, typename Compare, typename InsertPolicy>
+void RB<Key, Value, Compare, InsertPolicy>::transplant(Nodeptr u, Nodeptr v) {
 
-    if (u->parent == TNULL) {
+    if (u->parent() == TNULL) {
         root = v;
-    } else if (u == u->parent->left) {
-        u->parent->left = v;
+    } else if (u == u->parent()->left) {
+        u->parent()->left = v;
     } else {
-        u->parent->right = v;
+        u->parent()->right = v;
     }
-    v->parent = u->parent;
+    v->setParent(u->parent());
 }
 
 /**
@@ -366,70 +571,70 @@ void RB<Key, Value>::transplant(Nodeptr u, Nodeptr v) {
  * @note A função utiliza as funções auxiliares `leftRotate` e `rightRotate` para realizar rotações,
  * e manipula o contador `colors` para registrar o número de alterações de cor realizadas.
  */
-template <typename Key, typename Value>
-void RB<Key, Value>::deleteFix(Nodeptr x) {
+template <typename Key, typename Value, typename Compare, typename InsertPolicy>
+void RB<Key, Value, Compare, InsertPolicy>::deleteFix(Nodeptr x) {
     Nodeptr s;
 
-    while (x != root && x->color == BLACK) {
-        if (x == x->parent->left) {
-            s = x->parent->right;
+    while (x != root && x->color() == BLACK) {
+        if (x == x->parent()->left) {
+            s = x->parent()->right;
 
-            if (s->color == RED) {
-                s->color = BLACK; colors++;
-                x->parent->color = RED; colors++;
+            if (s->color() == RED) {
+                s->setColor(BLACK); colors++;
+                x->parent()->setColor(RED); colors++;
 
-                leftRotate(x->parent);
+                leftRotate(x->parent());
                 
-                s = x->parent->right;
+                s = x->parent()->right;
             }
             
-            if (s->left->color == BLACK && s->right->color == BLACK) {
-                s->color = RED; colors++;
-                x = x->parent;
+            if (s->left->color() == BLACK && s->right->color() == BLACK) {
+                s->setColor(RED); colors++;
+                x = x->parent();
             } else {
-                if (s->right->color == BLACK) {
-                    s->left->color = BLACK; colors++;
-                    s->color = RED; colors++;
+                if (s->right->color() == BLACK) {
+                    s->left->setColor(BLACK); colors++;
+                    s->setColor(RED); colors++;
                     rightRotate(s);
-                    s = x->parent->right;
+                    s = x->parent()->right;
                 }
                 
-                s->color = x->parent->color;
-                x->parent->color = BLACK; colors++;
-                s->right->color = BLACK; colors++;
-                leftRotate(x->parent);
+                s->setColor(x->parent()->color());
+                x->parent()->setColor(BLACK); colors++;
+                s->right->setColor(BLACK); colors++;
+                leftRotate(x->parent());
                 x = root;
             }
         } else {
-            s = x->parent->left;
+            s = x->parent()->left;
             
-            if (s->color == RED) {
-                s->color = BLACK; colors++;
-                x->parent->color = RED; colors++;
-                rightRotate(x->parent);
-                s = x->parent->left;
+            if (s->color() == RED) {
+                s->setColor(BLACK); colors++;
+                x->parent()->setColor(RED); colors++;
+                rightRotate(x->parent());
+                s = x->parent()->left;
             }
             
-            if (s->left->color == BLACK && s->right->color == BLACK) {
-                s->color = RED; colors++;
-                x = x->parent;
+            if (s->left->color() == BLACK && s->right->color() == BLACK) {
+                s->setColor(RED); colors++;
+                x = x->parent();
             } else {
-                if (s->left->color == BLACK) {
-                    s->right->color = BLACK; colors++;
-                    s->color = RED; colors++;
+                if (s->left->color() == BLACK) {
+                    s->right->setColor(BLACK); colors++;
+                    s->setColor(RED); colors++;
                     leftRotate(s);
-                    s = x->parent->left;
+                    s = x->parent()->left;
                 }
-                s->color = x->parent->color;
-                x->parent->color = BLACK; colors++;
-                s->left->color = BLACK; colors++;
-                rightRotate(x->parent);
+                s->setColor(x->parent()->color());
+                x->parent()->setColor(BLACK); colors++;
+                s->left->setColor(BLACK); colors++;
+                rightRotate(x->parent());
                 x = root;
             }
         }
     }
-    if (x->color != BLACK) {
-        x->color = BLACK;
+    if (x->color() != BLACK) {
+        x->setColor(BLACK);
         colors++;
     }
 }
@@ -444,8 +649,8 @@ void RB<Key, Value>::deleteFix(Nodeptr x) {
  * @param node Ponteiro para a raiz da subárvore na qual buscar o mínimo.
  * @return Nodeptr Ponteiro para o nó com a chave mínima na subárvore.
  */
-template <typename Key, typename Value>
-typename RB<Key, Value>::Nodeptr RB<Key, Value>::minimum(Nodeptr node) {
+template <typename Key, typename Value, typename Compare, typename InsertPolicy>
+typename RB<Key, Value, Compare, InsertPolicy>::Nodeptr RB<Key, Value, Compare, InsertPolicy>::minimum(Nodeptr node) const {
 
     while (node->left != TNULL) {
         node = node->left;
@@ -453,6 +658,88 @@ typename RB<Key, Value>::Nodeptr RB<Key, Value>::minimum(Nodeptr node) {
     return node;
 }
 
+/**
+ * @brief Retorna o nó de maior chave da subárvore enraizada em node (que não pode ser TNULL).
+ */
+template <typename Key, typename Value, typename Compare, typename InsertPolicy>
+typename RB<Key, Value, Compare, InsertPolicy>::Nodeptr RB<Key, Value, Compare, InsertPolicy>::maximum(Nodeptr node) const {
+    while (node->right != TNULL) {
+        node = node->right;
+    }
+    return node;
+}
+
+/**
+ * @brief Retorna o nó seguinte em ordem crescente, ou TNULL se node for o maior.
+ *
+ * Se node tiver subárvore direita, o sucessor é o seu mínimo; caso contrário, é o primeiro ancestral
+ * do qual node está na subárvore esquerda.
+ */
+template <typename Key, typename Value, typename Compare, typename InsertPolicy>
+typename RB<Key, Value, Compare, InsertPolicy>::Nodeptr RB<Key, Value, Compare, InsertPolicy>::successor(Nodeptr node) const {
+    if (node->right != TNULL) {
+        return minimum(node->right);
+    }
+    Nodeptr p = node->parent();
+    while (p != TNULL && node == p->right) {
+        node = p;
+        p = p->parent();
+    }
+    return p;
+}
+
+/**
+ * @brief Retorna o nó anterior em ordem crescente, ou TNULL se node for o menor.
+ */
+template <typename Key, typename Value, typename Compare, typename InsertPolicy>
+typename RB<Key, Value, Compare, InsertPolicy>::Nodeptr RB<Key, Value, Compare, InsertPolicy>::predecessor(Nodeptr node) const {
+    if (node->left != TNULL) {
+        return maximum(node->left);
+    }
+    Nodeptr p = node->parent();
+    while (p != TNULL && node == p->left) {
+        node = p;
+        p = p->parent();
+    }
+    return p;
+}
+
+/**
+ * @brief Cria um nó vermelho e o liga como filho vazio de parent, sem restaurar as propriedades.
+ *
+ * Se parent for TNULL, o nó se torna a raiz (preta). Atualiza o contador de nós e o maior nó.
+ * Cabe a quem chama corrigir uma eventual violação vermelho-vermelho.
+ *
+ * @param parent Nó que recebe o novo filho (ou TNULL para uma árvore vazia).
+ * @param side Lado do filho: negativo para a esquerda, positivo para a direita.
+ * @param key Chave do novo nó.
+ * @param value_to_add Valor do novo nó.
+ * @return Nodeptr Ponteiro para o nó criado.
+ */
+template <typename Key, typename Value, typename Compare, typename InsertPolicy>
+typename RB<Key, Value, Compare, InsertPolicy>::Nodeptr RB<Key, Value, Compare, InsertPolicy>::attach(Nodeptr parent, int side, const Key& key, const Value& value_to_add) {
+    Nodeptr node = m_pool.create(std::make_pair(key, value_to_add));
+    node->setParent(parent);
+    node->left = TNULL;
+    node->right = TNULL;
+    node->setColor(RED);
+
+    nodeCount++;
+
+    if (parent == TNULL) {
+        root = node;
+        m_rightmost = node;
+        node->setColor(BLACK);
+        colors++;
+    } else if (side < 0) {
+        parent->left = node;
+    } else {
+        parent->right = node;
+        if (parent == m_rightmost) m_rightmost = node;
+    }
+    return node;
+}
+
 /**
  * @brief Insere um novo nó na árvore rubro-negra com a chave e valor fornecidos.
  *
@@ -467,50 +754,98 @@ typename RB<Key, Value>::Nodeptr RB<Key, Value>::minimum(Nodeptr node) {
  *
  * @note O método atualiza os contadores de comparações, número de nós e cores conforme necessário.
  * @note Após a inserção, pode chamar a função de ajuste (insertFix) para manter as propriedades da árvore rubro-negra.
+ * @note Com a política TopDownInsert, a inserção é delegada a _insert_top_down.
+ * @note Se a inserção anterior foi no fim da ordem (nova maior chave), a chave é comparada primeiro com
+ *       o maior nó: em entradas ordenadas ela é anexada com uma única comparação, sem descer da raiz.
+ * @return Nodeptr Nó que contém a chave após a operação (novo ou atualizado).
  */
-template <typename Key, typename Value>
-void RB<Key, Value>::_insert(const Key& key, const Value& value_to_add) {
+template <typename Key, typename Value, typename Compare, typename InsertPolicy>
+typename RB<Key, Value, Compare, InsertPolicy>::Nodeptr RB<Key, Value, Compare, InsertPolicy>::_insert(const Key& key, const Value& value_to_add) {
+    if constexpr (std::is_same<InsertPolicy, TopDownInsert>::value) {
+        return _insert_top_down(key, value_to_add);
+    }
+
+    // Sequência crescente em andamento: uma comparação com o maior nó basta para anexar a chave
+    if (m_appendRun) {
+        comparisons++;
+        int cmp = m_compare(key, m_rightmost->data.first);
+        if (cmp > 0) {
+            Nodeptr node = attach(m_rightmost, 1, key, value_to_add);
+            insertFix(node);
+            return node;
+        }
+        if (cmp == 0) {
+            m_rightmost->data.second = value_to_add;
+            return m_rightmost;
+        }
+        m_appendRun = false;
+    }
+
     Nodeptr y = TNULL;
     Nodeptr x = root;
+    int cmp = 0;
 
     while (x != TNULL) {
         y = x;
-        if (key < x->data.first) {
-            comparisons++;
+        comparisons++;
+        cmp = m_compare(key, x->data.first);
+        if (cmp < 0) {
             x = x->left;
-        } else if (key > x->data.first) {
-            comparisons += 2;
+        } else if (cmp > 0) {
             x = x->right;
         } else {
-            comparisons += 2;
             x->data.second = value_to_add;
-            return;
+            return x;
         }
     }
 
-    Nodeptr node = new RBNode<Key, Value>(std::make_pair(key, value_to_add));
-    node->parent = y;
-    node->left = TNULL;
-    node->right = TNULL;
-    node->color = RED;
-    
-    nodeCount++;
-
-    if (y == TNULL) {
-        root = node;
-    } else if (key < y->data.first) {
-        y->left = node;
-    } else {
-        y->right = node;
+    Nodeptr node = attach(y, cmp, key, value_to_add); // Reaproveita a última comparação da descida
+    m_appendRun = (node == m_rightmost);
+    if (y != TNULL) {
+        insertFix(node);
     }
+    return node;
+}
 
-    if (node->parent == TNULL) {
-        node->color = BLACK;
-        colors++;
-        return;
+/**
+ * @brief Insere ou atualiza um par chave-valor em uma única passada de cima para baixo.
+ *
+ * Durante a descida, todo nó com dois filhos vermelhos é dividido por splitFourNode. Depois de uma
+ * divisão seguida de rotação dupla, o nó corrente sobe uma posição, mas a comparação já feita com a
+ * sua chave continua indicando o lado correto, então a descida prossegue sem comparação extra.
+ * Ao chegar à folha, o novo nó vermelho é ligado ao pai; se o pai for vermelho, seu irmão é preto
+ * (foi garantido pelas divisões) e fixRedParent resolve a violação sem subir pela árvore.
+ *
+ * @param key Chave a ser inserida ou atualizada.
+ * @param value_to_add Valor a ser associado à chave.
+ * @return Nodeptr Nó que contém a chave após a operação (novo ou atualizado).
+ */
+template <typename Key, typename Value, typename Compare, typename InsertPolicy>
+typename RB<Key, Value, Compare, InsertPolicy>::Nodeptr RB<Key, Value, Compare, InsertPolicy>::_insert_top_down(const Key& key, const Value& value_to_add) {
+    Nodeptr y = TNULL;
+    Nodeptr x = root;
+    int cmp = 0;
+
+    while (x != TNULL) {
+        if (x->left->color() == RED && x->right->color() == RED) {
+            splitFourNode(x);
+        }
+
+        comparisons++;
+        cmp = m_compare(key, x->data.first);
+        if (cmp == 0) {
+            x->data.second = value_to_add;
+            return x;
+        }
+        y = x;
+        x = (cmp < 0) ? x->left : x->right;
     }
 
-    insertFix(node);
+    Nodeptr node = attach(y, cmp, key, value_to_add);
+    if (y != TNULL && y->color() == RED) {
+        fixRedParent(node);
+    }
+    return node;
 }
 
 /**
@@ -528,13 +863,13 @@ void RB<Key, Value>::_insert(const Key& key, const Value& value_to_add) {
  *
  * @param node_to_delete Ponteiro para o nó que deve ser removido da árvore.
  */
-template <typename Key, typename Value>
-void RB<Key, Value>::_remove(Nodeptr node_to_delete) {
+template <typename Key, typename Value, typename Compare, typename InsertPolicy>
+void RB<Key, Value, Compare, InsertPolicy>::_remove(Nodeptr node_to_delete) {
     Nodeptr z = node_to_delete;
     Nodeptr x, y;
 
     y = z;
-    Color y_original_color = y->color;
+    Color y_original_color = y->color();
     
     if (z->left == TNULL) {
         x = z->right;
@@ -544,22 +879,27 @@ void RB<Key, Value>::_remove(Nodeptr node_to_delete) {
         transplant(z, z->left);
     } else {
         y = minimum(z->right);
-        y_original_color = y->color;
+        y_original_color = y->color();
         x = y->right;
-        if (y->parent == z) {
-            if (x != TNULL) x->parent = y;
+        if (y->parent() == z) {
+            x->setParent(y); // Também em TNULL: deleteFix sobe a partir de x->parent()
         } else {
             transplant(y, y->right);
             y->right = z->right;
-            y->right->parent = y;
+            y->right->setParent(y);
         }
         transplant(z, y);
         y->left = z->left;
-        y->left->parent = y;
-        y->color = z->color;
+        y->left->setParent(y);
+        y->setColor(z->color());
     }
 
-    delete z;
+    if (z == m_rightmost) {
+        m_rightmost = (z->left != TNULL) ? maximum(z->left) : z->parent();
+        m_appendRun = false;
+    }
+    m_cache.invalidate(z->data.first); // O nó deixará de existir
+    m_pool.destroy(z);
     nodeCount--;
 
     if (y_original_color == BLACK) {
@@ -578,9 +918,77 @@ void RB<Key, Value>::_remove(Nodeptr node_to_delete) {
  * @param key Chave a ser inserida na árvore.
  * @param value_to_add Valor associado à chave a ser inserido.
  */
-template <typename Key, typename Value>
-void RB<Key, Value>::add(const Key& key, const Value& value_to_add){
-    _insert(key, value_to_add);
+template <typename Key, typename Value, typename Compare, typename InsertPolicy>
+void RB<Key, Value, Compare, InsertPolicy>::add(const Key& key, const Value& value_to_add){
+    if (!m_cache.enabled()) {
+        _insert(key, value_to_add);
+        return;
+    }
+
+    size_t slot = m_cache.slot_of(key);
+    Nodeptr node = m_cache.lookup(key, slot);
+    if (node) {
+        node->data.second = value_to_add; // Acerto no cache: atualiza sem descer a árvore
+        return;
+    }
+
+    m_cache.store(slot, _insert(key, value_to_add));
+}
+
+/**
+ * @brief Insere um par chave-valor usando um iterador como dica de posição, como std::map::insert(hint, ...).
+ *
+ * A dica é útil quando a chave deve ficar imediatamente antes de hint (por exemplo, hint == end() ao
+ * carregar chaves em ordem crescente). A posição é confirmada com no máximo duas comparações, contra o
+ * nó da dica e o seu vizinho; então o nó é ligado como filho vazio de um dos dois e insertFix é chamado
+ * (com qualquer política de inserção). Se a dica estiver errada, a inserção é feita normalmente a partir
+ * da raiz. Se a chave já existir na posição indicada, apenas o valor é atualizado.
+ *
+ * @param hint Iterador para o elemento que deve suceder a chave (ou end()).
+ * @param key Chave a ser inserida.
+ * @param value_to_add Valor associado à chave.
+ * @return iterator Iterador para o elemento com a chave.
+ */
+template <typename Key, typename Value, typename Compare, typename InsertPolicy>
+typename RB<Key, Value, Compare, InsertPolicy>::iterator RB<Key, Value, Compare, InsertPolicy>::add_hint(iterator hint, const Key& key, const Value& value_to_add) {
+    Nodeptr next = hint.m_node;
+    Nodeptr prev = (next == TNULL) ? m_rightmost : predecessor(next);
+
+    // A chave deve ficar entre prev e next (TNULL nas pontas)
+    if (next != TNULL) {
+        comparisons++;
+        int cmp = m_compare(key, next->data.first);
+        if (cmp == 0) {
+            next->data.second = value_to_add;
+            return iterator(this, next);
+        }
+        if (cmp > 0) {
+            return iterator(this, _insert(key, value_to_add));
+        }
+    }
+    if (prev != TNULL) {
+        comparisons++;
+        int cmp = m_compare(key, prev->data.first);
+        if (cmp == 0) {
+            prev->data.second = value_to_add;
+            return iterator(this, prev);
+        }
+        if (cmp < 0) {
+            return iterator(this, _insert(key, value_to_add));
+        }
+    }
+
+    // Entre dois nós vizinhos, o filho esquerdo de next ou o direito de prev está vazio
+    Nodeptr node;
+    if (next != TNULL && next->left == TNULL) {
+        node = attach(next, -1, key, value_to_add);
+    } else {
+        node = attach(prev, 1, key, value_to_add);
+    }
+    if (node != root) {
+        insertFix(node);
+    }
+    return iterator(this, node);
 }
 
 /**
@@ -593,8 +1001,8 @@ void RB<Key, Value>::add(const Key& key, const Value& value_to_add){
  *
  * @param key Chave do nó a ser removido da árvore.
  */
-template <typename Key, typename Value>
-void RB<Key, Value>::remove(const Key& key) {
+template <typename Key, typename Value, typename Compare, typename InsertPolicy>
+void RB<Key, Value, Compare, InsertPolicy>::remove(const Key& key) {
     Nodeptr node = findNode(key);
     if (node == TNULL) {
         return;
@@ -612,24 +1020,28 @@ void RB<Key, Value>::remove(const Key& key) {
  * @param key A chave a ser buscada na árvore.
  * @return true se a chave estiver presente, false caso contrário.
  */
-template <typename Key, typename Value>
-bool RB<Key, Value>::contains(const Key& key) const {
-    return findNode(key) != TNULL;
+template <typename Key, typename Value, typename Compare, typename InsertPolicy>
+bool RB<Key, Value, Compare, InsertPolicy>::contains(const Key& key) const {
+    return lookup(key) != TNULL;
 }
 
 /**
  * @brief Remove todos os nós da Árvore Rubro-Negra, esvaziando seu conteúdo.
  *
- * Esta função desaloca todos os nós da árvore chamando a função auxiliar destroy() a partir da raiz.
+ * Esta função destrói todos os nós da árvore com a função auxiliar destroy() e devolve os blocos do pool de uma vez.
  * Após a exclusão de todos os nós, o ponteiro root é redefinido para TNULL e os contadores de nós,
  * comparações, rotações e alterações de cor são zerados.
  * 
  * Após a chamada desta função, a árvore estará vazia e todas as estatísticas associadas serão reiniciadas.
  */
-template <typename Key, typename Value>
-void RB<Key, Value>::clear() {
+template <typename Key, typename Value, typename Compare, typename InsertPolicy>
+void RB<Key, Value, Compare, InsertPolicy>::clear() {
     destroy(root);
+    m_pool.release();
     root = TNULL;
+    m_rightmost = TNULL;
+    m_appendRun = false;
+    m_cache.invalidate_all();
     nodeCount = 0;
     comparisons = 0;
     rotations = 0;
@@ -652,12 +1064,12 @@ void RB<Key, Value>::clear() {
  * @note Esta função é destinada à depuração e visualização.
  *       Não modifica a árvore.
  */
-template <typename Key, typename Value>
-void RB<Key, Value>::printTree(Nodeptr node, std::string prefix, bool isLeft) const {
+template <typename Key, typename Value, typename Compare, typename InsertPolicy>
+void RB<Key, Value, Compare, InsertPolicy>::printTree(Nodeptr node, std::string prefix, bool isLeft) const {
     if (node == TNULL) return;
 
     std::cout << prefix << (isLeft ? "├──" : "└──") << node->data.first 
-              << ":" << node->data.second << " (" << (node->color == RED ? "R" : "B") << ")" << std::endl;
+              << ":" << node->data.second << " (" << (node->color() == RED ? "R" : "B") << ")" << std::endl;
               
     printTree(node->left, prefix + (isLeft ? "│   " : "    "), true);
     printTree(node->right, prefix + (isLeft ? "│   " : "    "), false);
@@ -671,8 +1083,8 @@ void RB<Key, Value>::printTree(Nodeptr node, std::string prefix, bool isLeft) co
  * O formato e o destino da saída dependem da implementação de printTree.
  * Esta função não modifica a árvore.
  */
-template <typename Key, typename Value>
-void RB<Key, Value>::print() const {
+template <typename Key, typename Value, typename Compare, typename InsertPolicy>
+void RB<Key, Value, Compare, InsertPolicy>::print() const {
     printTree(root);
 }
 
@@ -687,9 +1099,9 @@ void RB<Key, Value>::print() const {
  * @return Referência ao valor associado à chave.
  * @throws std::runtime_error Se a chave não for encontrada na árvore.
  */
-template <typename Key, typename Value>
-const Value& RB<Key, Value>::get(const Key& key) const {
-    Nodeptr node = findNode(key);
+template <typename Key, typename Value, typename Compare, typename InsertPolicy>
+const Value& RB<Key, Value, Compare, InsertPolicy>::get(const Key& key) const {
+    Nodeptr node = lookup(key);
     if (node == TNULL) {
         throw std::runtime_error("Chave não encontrada na árvore.");
     }
@@ -704,8 +1116,8 @@ const Value& RB<Key, Value>::get(const Key& key) const {
  *
  * @return true se a árvore estiver vazia, false caso contrário.
  */
-template <typename Key, typename Value>
-bool RB<Key, Value>::isEmpty() const {
+template <typename Key, typename Value, typename Compare, typename InsertPolicy>
+bool RB<Key, Value, Compare, InsertPolicy>::isEmpty() const {
     return nodeCount == 0;
 }
 
@@ -714,8 +1126,8 @@ bool RB<Key, Value>::isEmpty() const {
  *
  * @return O número de nós atualmente armazenados na árvore.
  */
-template <typename Key, typename Value>
-size_t RB<Key, Value>::size() const {
+template <typename Key, typename Value, typename Compare, typename InsertPolicy>
+size_t RB<Key, Value, Compare, InsertPolicy>::size() const {
     return nodeCount;
 }
 
@@ -727,8 +1139,8 @@ size_t RB<Key, Value>::size() const {
  *
  * @return O total de comparações de chaves como um inteiro longo (long long).
  */
-template <typename Key, typename Value>
-long long RB<Key, Value>::get_comparisons() const {
+template <typename Key, typename Value, typename Compare, typename InsertPolicy>
+long long RB<Key, Value, Compare, InsertPolicy>::get_comparisons() const {
     return comparisons;
 }
 
@@ -740,8 +1152,8 @@ long long RB<Key, Value>::get_comparisons() const {
  *
  * @return Número de rotações realizadas.
  */
-template <typename Key, typename Value>
-long long RB<Key, Value>::get_rotations() const {
+template <typename Key, typename Value, typename Compare, typename InsertPolicy>
+long long RB<Key, Value, Compare, InsertPolicy>::get_rotations() const {
     return rotations;
 }
 
@@ -754,14 +1166,93 @@ long long RB<Key, Value>::get_rotations() const {
  *
  * @return long long O número de cores utilizadas na árvore.
  */
-template <typename Key, typename Value>
-long long RB<Key, Value>::get_colors() const {
+template <typename Key, typename Value, typename Compare, typename InsertPolicy>
+long long RB<Key, Value, Compare, InsertPolicy>::get_colors() const {
     return colors;
 }
 
-template <typename Key, typename Value>
-long long RB<Key, Value>::get_collisions() const {
+/**
+ * @brief Ativa o cache direto de chaves frequentes (ou o desativa, com slots = 0).
+ *
+ * Com o cache ativo, get, contains e add consultam primeiro uma tabela pequena de ponteiros
+ * para nós indexada pelo hash da chave; acertos evitam a descida pela árvore. Como as rotações
+ * não trocam o conteúdo dos nós, apenas a remoção precisa invalidar entradas.
+ *
+ * @param slots Número de posições do cache (arredondado para potência de 2).
+ */
+template <typename Key, typename Value, typename Compare, typename InsertPolicy>
+void RB<Key, Value, Compare, InsertPolicy>::enable_front_cache(size_t slots) {
+    m_cache.enable(slots);
+}
+
+/**
+ * @brief Retorna o número de acessos resolvidos pelo cache de chaves frequentes.
+ */
+template <typename Key, typename Value, typename Compare, typename InsertPolicy>
+long long RB<Key, Value, Compare, InsertPolicy>::get_cache_hits() const {
+    return m_cache.get_hits();
+}
+
+/**
+ * @brief Retorna o número de acessos que não foram resolvidos pelo cache e desceram a árvore.
+ */
+template <typename Key, typename Value, typename Compare, typename InsertPolicy>
+long long RB<Key, Value, Compare, InsertPolicy>::get_cache_misses() const {
+    return m_cache.get_misses();
+}
+
+template <typename Key, typename Value, typename Compare, typename InsertPolicy>
+long long RB<Key, Value, Compare, InsertPolicy>::get_collisions() const {
     return 0; // Retorna 0, pois não há colisões em uma árvore rubro-negra
 }
 
-#endif
\ No newline at end of file
+/**
+ * @brief Retorna o tamanho em bytes de cada nó da árvore (a cor está embutida no ponteiro para o pai).
+ */
+template <typename Key, typename Value, typename Compare, typename InsertPolicy>
+size_t RB<Key, Value, Compare, InsertPolicy>::get_node_bytes() const {
+    return sizeof(RBNode<Key, Value>);
+}
+
+template <typename Key, typename Value, typename Compare, typename InsertPolicy>
+long long RB<Key, Value, Compare, InsertPolicy>::get_rehashes() const {
+    return 0; // Retorna 0, pois uma árvore não é redimensionada
+}
+
+/**
+ * @brief Aloca antecipadamente no pool os blocos para n nós, de modo que as próximas inserções não chamem new.
+ */
+template <typename Key, typename Value, typename Compare, typename InsertPolicy>
+void RB<Key, Value, Compare, InsertPolicy>::reserve(size_t n) {
+    m_pool.reserve(n);
+}
+
+/**
+ * @brief Verifica recursivamente ordem das chaves, ponteiros para o pai, ausência de vermelho-vermelho e altura negra.
+ *
+ * @return int Altura negra da subárvore, ou -1 se alguma propriedade for violada.
+ */
+template <typename Key, typename Value, typename Compare, typename InsertPolicy>
+int RB<Key, Value, Compare, InsertPolicy>::validate(Nodeptr node, Nodeptr parent, const Key* low, const Key* high) const {
+    if (node == TNULL) return 1;
+
+    if (node->parent() != parent) return -1;
+    if ((low && m_compare(node->data.first, *low) <= 0) || (high && m_compare(node->data.first, *high) >= 0)) return -1;
+    if (node->color() == RED && (node->left->color() == RED || node->right->color() == RED)) return -1;
+
+    int bl = validate(node->left, node, low, &node->data.first);
+    int br = validate(node->right, node, &node->data.first, high);
+    if (bl < 0 || bl != br) return -1;
+
+    return bl + (node->color() == BLACK ? 1 : 0);
+}
+
+/**
+ * @brief Verifica se a árvore satisfaz todas as propriedades da árvore rubro-negra (usada nos testes).
+ */
+template <typename Key, typename Value, typename Compare, typename InsertPolicy>
+bool RB<Key, Value, Compare, InsertPolicy>::validate() const {
+    return root->color() == BLACK && validate(root, TNULL, nullptr, nullptr) > 0;
+}
+
+#endif
@@ -9,6 +9,8 @@
 #include <algorithm>
 #include <vector>
 #include <unordered_map>
+#include <unordered_set>
+#include <cmath>
 #include "../Dictionaty/IDictionary.hpp"
 #include "../utils/lexicalStr.hpp"
 
@@ -94,6 +96,85 @@ private:
         return final_word;
     }
 
+    // Amostragem da estimativa de vocabulário: SAMPLE_CHUNKS trechos de CHUNK_BYTES bytes espalhados pelo ficheiro
+    static constexpr size_t SAMPLE_CHUNKS = 8;
+    static constexpr size_t CHUNK_BYTES = 64 * 1024;
+
+    /**
+     * @brief Separa um trecho de texto em palavras já limpas e chama visit(palavra) para cada uma.
+     *
+     * O travessão é tratado como separador; letras acentuadas, dígitos e hífens entre letras fazem parte da palavra.
+     */
+    template <typename Visit>
+    void for_each_word(const std::string &line, Visit &&visit)
+    {
+        std::string processed_line;
+        processed_line.reserve(line.length());
+        for (size_t i = 0; i < line.length(); ++i)
+        {
+            // O travessão (em-dash) em UTF-8 é a sequência de 3 bytes: 0xE2, 0x80, 0x94
+            if (static_cast<unsigned char>(line[i]) == 0xE2 && i + 2 < line.length() &&
+                static_cast<unsigned char>(line[i + 1]) == 0x80 &&
+                static_cast<unsigned char>(line[i + 2]) == 0x94)
+            {
+                processed_line += ' ';
+                i += 2;
+            }
+            else
+            {
+                processed_line += line[i];
+            }
+        }
+
+        std::string token;
+        size_t i = 0;
+        while (i < processed_line.length())
+        {
+            unsigned char c = processed_line[i];
+
+            // Caractere UTF-8 (acentuado)
+            if (c == 0xc3 && i + 1 < processed_line.length())
+            {
+                token += c;
+                token += processed_line[i + 1];
+                i += 2;
+                continue;
+            }
+
+            // ASCII válido para a palavra (letra, dígito ou hífen no meio)
+            if (std::isalpha(c) || std::isdigit(c) ||
+                (c == '-' && !token.empty() && i + 1 < processed_line.length() && std::isalnum((unsigned char)processed_line[i + 1])))
+            {
+                token += std::tolower(c);
+            }
+            else
+            {
+                // Se bater um separador, processa a palavra atual
+                if (!token.empty())
+                {
+                    std::string cleaned = clean_word(token);
+                    if (!cleaned.empty())
+                    {
+                        visit(cleaned);
+                    }
+                    token.clear();
+                }
+            }
+
+            i++;
+        }
+
+        // Processa último token se houver
+        if (!token.empty())
+        {
+            std::string cleaned = clean_word(token);
+            if (!cleaned.empty())
+            {
+                visit(cleaned);
+            }
+        }
+    }
+
 public:
     ReadTxt()
     {
@@ -101,103 +182,118 @@ public:
     }
 
     /**
-     * @brief Processa um ficheiro de texto, conta a frequência das palavras e preenche o dicionário.
+     * @brief Estima o número de palavras distintas de um ficheiro sem lê-lo por inteiro.
+     *
+     * Ficheiros de até SAMPLE_CHUNKS * CHUNK_BYTES bytes são lidos inteiros e a contagem é exata. Nos
+     * maiores, SAMPLE_CHUNKS trechos espalhados pelo ficheiro são separados em palavras. Multiplicar o
+     * tamanho do ficheiro pela razão distintas/palavras da amostra superestimaria muito, porque essa
+     * razão cai à medida que o texto cresce; por isso o vocabulário é extrapolado pela lei de Heaps
+     * (V = K * N^beta), com beta medido entre a primeira metade da amostra e a amostra inteira.
+     *
+     * @return Estimativa de palavras distintas (0 se o ficheiro não puder ser aberto).
      */
-    void processFile(const std::string &filename, IDictionary<KeyType, size_t> &dictionary)
+    size_t estimate_distinct_words(const std::string &filename)
     {
-        std::ifstream file(filename);
+        std::ifstream file(filename, std::ios::binary);
         if (!file.is_open())
         {
-            std::cerr << "Erro: Nao foi possivel abrir o ficheiro " << filename << std::endl;
-            return;
+            return 0;
         }
+        file.seekg(0, std::ios::end);
+        size_t file_bytes = static_cast<size_t>(file.tellg());
+        bool whole = file_bytes <= SAMPLE_CHUNKS * CHUNK_BYTES;
 
-        std::string line;
-        while (std::getline(file, line))
+        std::unordered_set<std::string> distinct;
+        size_t words = 0;
+        size_t half_words = 0;
+        size_t half_distinct = 0;
+        size_t sampled_bytes = 0;
+        std::string chunk;
+
+        size_t chunks = whole ? 1 : SAMPLE_CHUNKS;
+        for (size_t c = 0; c < chunks; ++c)
         {
-            std::string processed_line;
-            processed_line.reserve(line.length());
-            for (size_t i = 0; i < line.length(); ++i)
+            chunk.resize(whole ? file_bytes : CHUNK_BYTES);
+            file.clear();
+            file.seekg(whole ? 0 : c * (file_bytes / SAMPLE_CHUNKS));
+            file.read(&chunk[0], chunk.size());
+            chunk.resize(static_cast<size_t>(file.gcount()));
+            sampled_bytes += chunk.size();
+
+            if (!whole)
             {
-                // O travessão (em-dash) em UTF-8 é a sequência de 3 bytes: 0xE2, 0x80, 0x94
-                if (static_cast<unsigned char>(line[i]) == 0xE2 && i + 2 < line.length() &&
-                    static_cast<unsigned char>(line[i + 1]) == 0x80 &&
-                    static_cast<unsigned char>(line[i + 2]) == 0x94)
-                {
-                    processed_line += ' ';
-                    i += 2;
-                }
-                else
-                {
-                    processed_line += line[i];
-                }
+                // Descarta as palavras possivelmente cortadas nas bordas do trecho
+                size_t first = c == 0 ? 0 : chunk.find_first_of(" \t\r\n");
+                size_t last = chunk.find_last_of(" \t\r\n");
+                chunk = (first == std::string::npos || last == std::string::npos || last <= first) ? std::string() : chunk.substr(first, last - first);
             }
+            for_each_word(chunk, [&](const std::string &word) {
+                words++;
+                distinct.insert(word);
+            });
 
-            std::string token;
-            size_t i = 0;
-            while (i < processed_line.length())
+            if (c + 1 == chunks / 2)
             {
-                unsigned char c = processed_line[i];
+                half_words = words;
+                half_distinct = distinct.size();
+            }
+        }
 
-                // Caractere UTF-8 (acentuado)
-                if (c == 0xc3 && i + 1 < processed_line.length())
-                {
-                    token += c;
-                    token += processed_line[i + 1];
-                    i += 2;
-                    continue;
-                }
+        if (whole || words == 0)
+        {
+            return distinct.size();
+        }
+
+        double beta = 0.5;
+        if (half_distinct > 0 && half_words < words && half_distinct < distinct.size())
+        {
+            beta = std::log(static_cast<double>(distinct.size()) / half_distinct) / std::log(static_cast<double>(words) / half_words);
+        }
+        beta = std::min(1.0, std::max(0.3, beta));
+
+        double total_words = static_cast<double>(words) * file_bytes / sampled_bytes;
+        double estimate = distinct.size() * std::pow(total_words / words, beta);
+        return static_cast<size_t>(std::min(estimate, total_words));
+    }
+
+    /**
+     * @brief Processa um ficheiro de texto, conta a frequência das palavras e preenche o dicionário.
+     *
+     * Se o dicionário estiver vazio e presize for verdadeiro, ele é antes preparado com reserve() para
+     * o vocabulário estimado por estimate_distinct_words(), evitando os rehash por dobra das tabelas.
+     * O padrão é false (opt-in; no programa principal, --presize): a amostragem custa de 20 a 65 ms (o
+     * ficheiro inteiro, até 512 KiB), mais do que os rehash que evita em textos pequenos. Nas árvores,
+     * reserve() apenas pré-aloca as placas do NodePool, sem rehash a evitar (ver benchmark_presize).
+     */
+    void processFile(const std::string &filename, IDictionary<KeyType, size_t> &dictionary, bool presize = false)
+    {
+        std::ifstream file(filename);
+        if (!file.is_open())
+        {
+            std::cerr << "Erro: Nao foi possivel abrir o ficheiro " << filename << std::endl;
+            return;
+        }
+
+        if (presize && dictionary.isEmpty())
+        {
+            dictionary.reserve(estimate_distinct_words(filename));
+        }
 
-                // ASCII válido para a palavra (letra, dígito ou hífen no meio)
-                if (std::isalpha(c) || std::isdigit(c) ||
-                    (c == '-' && !token.empty() && i + 1 < processed_line.length() && std::isalnum((unsigned char)processed_line[i + 1])))
+        std::string line;
+        while (std::getline(file, line))
+        {
+            for_each_word(line, [&](const std::string &cleaned) {
+                KeyType key(cleaned);
+                if (dictionary.contains(key))
                 {
-                    token += std::tolower(c);
+                    const int &current_freq = dictionary.get(key);
+                    dictionary.add(key, current_freq + 1);
                 }
                 else
                 {
-                    // Se bater um separador, processa a palavra atual
-                    if (!token.empty())
-                    {
-                        std::string cleaned = clean_word(token);
-                        if (!cleaned.empty())
-                        {
-                            KeyType key(cleaned);
-                            if (dictionary.contains(key))
-                            {
-                                const int &current_freq = dictionary.get(key);
-                                dictionary.add(key, current_freq + 1);
-                            }
-                            else
-                            {
-                                dictionary.add(key, 1);
-                            }
-                        }
-                        token.clear();
-                    }
-                }
-
-                i++;
-            }
-
-            // Processa último token se houver
-            if (!token.empty())
-            {
-                std::string cleaned = clean_word(token);
-                if (!cleaned.empty())
-                {
-                    KeyType key(cleaned);
-                    if (dictionary.contains(key))
-                    {
-                        const int &current_freq = dictionary.get(key);
-                        dictionary.add(key, current_freq + 1);
-                    }
-                    else
-                    {
-                        dictionary.add(key, 1);
-                    }
+                    dictionary.add(key, 1);
                 }
-            }
+            });
         }
     }
 };
@@ -0,0 +1,144 @@
+#ifndef RANKED_DICTIONARY_HPP
+#define RANKED_DICTIONARY_HPP
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "../Dictionaty/IDictionary.hpp"
+#include "../RB-TREE/rb_tree.hpp"
+#include "../utils/threeWayCompare.hpp"
+
+/**
+ * @brief Ordem do índice de frequências: primeiro pela contagem e, em caso de empate, pela chave invertida.
+ *
+ * Com a chave invertida, o maior elemento do índice é o de maior contagem e, entre empatados, o de
+ * menor chave. Assim, percorrer o índice do fim para o começo lista as palavras da mais frequente para
+ * a menos frequente, com empates em ordem alfabética.
+ *
+ * @tparam Value Tipo da contagem.
+ * @tparam Key Tipo da chave.
+ * @tparam KeyCompare Comparação em três vias das chaves.
+ */
+template <typename Value, typename Key, typename KeyCompare = ThreeWayCompare<Key>>
+struct RankCompare {
+    KeyCompare m_keyCompare;
+
+    int operator()(const std::pair<Value, Key>& a, const std::pair<Value, Key>& b) const {
+        if (a.first < b.first) return -1;
+        if (b.first < a.first) return 1;
+        return -m_keyCompare(a.second, b.second);
+    }
+};
+
+/**
+ * @brief Dicionário com um índice secundário de frequências, para consultar as k chaves mais frequentes.
+ *
+ * Envolve um dicionário qualquer (AVL, RB, tabelas hash) e mantém, em uma árvore rubro-negra (RB),
+ * um índice ordenado pelos pares (contagem, chave). Toda escrita passa pelo dicionário e pelo índice:
+ * ao mudar o valor de uma chave, o par antigo sai do índice e o novo entra. Com isso top_k(k) pode ser
+ * respondido a qualquer momento da ingestão, sem percorrer e ordenar todas as chaves.
+ *
+ * O custo é um trabalho extra por escrita: uma consulta ao valor anterior no dicionário e uma remoção
+ * e uma inserção no índice. As leituras vão direto ao dicionário envolvido. As métricas (comparações,
+ * rotações etc.) são as do dicionário envolvido; as do índice estão em get_index_comparisons().
+ *
+ * @tparam Key Tipo da chave.
+ * @tparam Value Tipo da contagem (deve ser ordenável com <).
+ * @tparam KeyCompare Comparação em três vias das chaves, usada no desempate do índice.
+ */
+template <typename Key, typename Value, typename KeyCompare = ThreeWayCompare<Key>>
+class RankedDictionary : public IDictionary<Key, Value> {
+private:
+    using RankKey = std::pair<Value, Key>;
+
+    std::unique_ptr<IDictionary<Key, Value>> m_dictionary; // Dicionário envolvido
+    RB<RankKey, bool, RankCompare<Value, Key, KeyCompare>> m_index; // Pares (contagem, chave)
+
+public:
+    /**
+     * @brief Construtor que assume a posse do dicionário a ser indexado (que deve estar vazio).
+     *
+     * @param dictionary Dicionário envolvido.
+     */
+    explicit RankedDictionary(std::unique_ptr<IDictionary<Key, Value>> dictionary)
+        : m_dictionary(std::move(dictionary)) {}
+
+    void add(const Key& key, const Value& value) override;
+    void remove(const Key& key) override;
+    bool contains(const Key& key) const override { return m_dictionary->contains(key); }
+    bool isEmpty() const override { return m_dictionary->isEmpty(); }
+    size_t size() const override { return m_dictionary->size(); }
+    const Value& get(const Key& key) const override { return m_dictionary->get(key); }
+    std::vector<Key> get_all_keys_sorted() const override { return m_dictionary->get_all_keys_sorted(); }
+
+    std::vector<std::pair<Key, Value>> top_k(size_t k) const;
+
+    // Funções para obter métricas
+    long long get_comparisons() const override { return m_dictionary->get_comparisons(); }
+    long long get_rotations() const override { return m_dictionary->get_rotations(); }
+    long long get_colors() const override { return m_dictionary->get_colors(); }
+    long long get_collisions() const override { return m_dictionary->get_collisions(); }
+    size_t get_node_bytes() const override { return m_dictionary->get_node_bytes() + m_index.get_node_bytes(); }
+    long long get_rehashes() const override { return m_dictionary->get_rehashes(); }
+    void reserve(size_t n) override { m_dictionary->reserve(n); m_index.reserve(n); }
+    long long get_index_comparisons() const { return m_index.get_comparisons(); }
+};
+
+//------------- Implementação --------------
+
+/**
+ * @brief Insere ou atualiza a chave no dicionário e reposiciona o seu par (contagem, chave) no índice.
+ *
+ * @param key Chave a ser inserida ou atualizada.
+ * @param value Novo valor (contagem) da chave.
+ */
+template <typename Key, typename Value, typename KeyCompare>
+void RankedDictionary<Key, Value, KeyCompare>::add(const Key& key, const Value& value) {
+    if (m_dictionary->contains(key)) {
+        const Value& old = m_dictionary->get(key);
+        if (!(old < value) && !(value < old)) {
+            return; // Mesma contagem: o índice não muda
+        }
+        m_index.remove(RankKey(old, key));
+    }
+    m_dictionary->add(key, value);
+    m_index.add(RankKey(value, key), true);
+}
+
+/**
+ * @brief Remove a chave do dicionário e o seu par do índice, se ela existir.
+ */
+template <typename Key, typename Value, typename KeyCompare>
+void RankedDictionary<Key, Value, KeyCompare>::remove(const Key& key) {
+    if (!m_dictionary->contains(key)) {
+        return;
+    }
+    m_index.remove(RankKey(m_dictionary->get(key), key));
+    m_dictionary->remove(key);
+}
+
+/**
+ * @brief Retorna as k chaves de maior valor, da maior para a menor (empates em ordem crescente de chave).
+ *
+ * O percurso começa no maior nó do índice, guardado pela árvore, e recua k passos pelo iterador:
+ * O(k + log n), independentemente do número de chaves.
+ *
+ * @param k Quantidade de chaves desejada (limitada ao tamanho do dicionário).
+ * @return std::vector<std::pair<Key, Value>> Pares (chave, valor) em ordem decrescente de valor.
+ */
+template <typename Key, typename Value, typename KeyCompare>
+std::vector<std::pair<Key, Value>> RankedDictionary<Key, Value, KeyCompare>::top_k(size_t k) const {
+    std::vector<std::pair<Key, Value>> result;
+    result.reserve(std::min(k, m_index.size()));
+
+    auto first = m_index.begin();
+    auto it = m_index.end();
+    while (result.size() < k && it != first) {
+        --it;
+        result.emplace_back(it.key().second, it.key().first);
+    }
+    return result;
+}
+
+#endif
@@ -0,0 +1,189 @@
+#ifndef EPOCH_HPP
+#define EPOCH_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Recuperação de memória baseada em épocas (epoch-based reclamation) para estruturas concorrentes.
+ *
+ * Leitores de estruturas sem bloqueio podem estar percorrendo um nó no exato momento em que outra
+ * thread o remove. O nó removido, portanto, não pode ser apagado imediatamente: ele é "aposentado"
+ * com retire() e só é liberado quando todas as threads que poderiam tê-lo visto terminaram suas
+ * operações.
+ *
+ * Funcionamento:
+ * - Existe uma época global. Toda operação sobre a estrutura é feita dentro de um EpochGuard, que
+ *   anuncia a época em que a thread entrou.
+ * - Um objeto aposentado na época e só pode ser alcançado por threads que entraram em épocas <= e.
+ * - A época global só avança de e para e+1 quando todas as threads ativas já anunciaram e. Logo,
+ *   quando a época global chega a e+2, nenhuma thread que poderia ver o objeto continua ativa.
+ *
+ * Cada thread participante recebe um registro próprio (criado na primeira entrada e reutilizado depois),
+ * com a sua lista de objetos aposentados. Registros só são apagados na destruição do gerenciador, que
+ * também executa as liberações pendentes; ele deve ser destruído sem nenhuma thread ativa.
+ */
+class EpochManager {
+private:
+    static constexpr uint64_t ACTIVE = 1;          // bit menos significativo do estado de um registro
+    static constexpr size_t RECLAIM_INTERVAL = 64; // aposentadorias entre tentativas de liberação
+
+    struct Retired {
+        uint64_t epoch;
+        std::function<void()> deleter;
+    };
+
+    struct Record {
+        std::atomic<uint64_t> state{0}; // (época << 1) | ACTIVE enquanto a thread estiver dentro de um guard
+        unsigned depth = 0;             // guards aninhados da mesma thread
+        std::vector<Retired> retired;   // objetos aposentados por esta thread
+        Record* next = nullptr;
+    };
+
+    std::atomic<uint64_t> m_epoch{0};
+    std::atomic<Record*> m_records{nullptr};
+    std::atomic<long long> m_reclaimed{0};
+    const uint64_t m_id; // identifica o gerenciador no cache de registros de cada thread
+
+    static uint64_t next_id() {
+        static std::atomic<uint64_t> ids{0};
+        return ++ids;
+    }
+
+    /**
+     * @brief Retorna o registro da thread corrente, criando-o na primeira chamada.
+     *
+     * Cada thread guarda um pequeno cache (id do gerenciador, registro), com o último consultado à
+     * frente. Os ids nunca se repetem, de modo que entradas de gerenciadores já destruídos
+     * simplesmente deixam de ser encontradas.
+     */
+    Record* local_record() {
+        thread_local std::pair<uint64_t, Record*> last{0, nullptr}; // caso comum: um único gerenciador
+        if (last.first == m_id) return last.second;
+
+        thread_local std::vector<std::pair<uint64_t, Record*>> cache;
+        for (const auto& entry : cache) {
+            if (entry.first == m_id) {
+                last = entry;
+                return entry.second;
+            }
+        }
+
+        Record* record = new Record();
+        record->next = m_records.load();
+        while (!m_records.compare_exchange_weak(record->next, record)) {}
+        cache.emplace_back(m_id, record);
+        last = cache.back();
+        return record;
+    }
+
+    /**
+     * @brief Avança a época global se todas as threads ativas já estiverem na época corrente.
+     */
+    bool try_advance() {
+        uint64_t epoch = m_epoch.load();
+        for (Record* r = m_records.load(); r; r = r->next) {
+            uint64_t state = r->state.load();
+            if ((state & ACTIVE) && (state >> 1) != epoch) return false;
+        }
+        return m_epoch.compare_exchange_strong(epoch, epoch + 1);
+    }
+
+    /**
+     * @brief Executa as liberações do registro cuja época de aposentadoria já ficou duas épocas para trás.
+     */
+    void reclaim(Record* record) {
+        uint64_t epoch = m_epoch.load();
+        auto& list = record->retired;
+        size_t kept = 0;
+        for (size_t i = 0; i < list.size(); ++i) {
+            if (list[i].epoch + 2 <= epoch) {
+                list[i].deleter();
+                m_reclaimed.fetch_add(1, std::memory_order_relaxed);
+            } else {
+                list[kept++] = std::move(list[i]);
+            }
+        }
+        list.resize(kept);
+    }
+
+public:
+    EpochManager() : m_id(next_id()) {}
+    EpochManager(const EpochManager&) = delete;
+    EpochManager& operator=(const EpochManager&) = delete;
+
+    ~EpochManager() {
+        Record* r = m_records.load();
+        while (r) {
+            for (auto& item : r->retired) item.deleter();
+            Record* next = r->next;
+            delete r;
+            r = next;
+        }
+    }
+
+    /**
+     * @brief Marca a thread corrente como ativa na época global atual.
+     */
+    void enter() {
+        Record* record = local_record();
+        if (record->depth++ == 0) {
+            record->state.store((m_epoch.load() << 1) | ACTIVE);
+        }
+    }
+
+    /**
+     * @brief Marca a thread corrente como inativa. Referências obtidas dentro do guard deixam de ser válidas.
+     */
+    void exit() {
+        Record* record = local_record();
+        if (--record->depth == 0) {
+            record->state.store(0);
+        }
+    }
+
+    /**
+     * @brief Agenda a liberação de um objeto já desconectado da estrutura.
+     *
+     * Deve ser chamado dentro de um EpochGuard, depois que o objeto deixou de ser alcançável.
+     *
+     * @param deleter Função que libera o objeto; executada quando nenhuma thread puder mais acessá-lo.
+     */
+    void retire(std::function<void()> deleter) {
+        Record* record = local_record();
+        record->retired.push_back({m_epoch.load(), std::move(deleter)});
+        if (record->retired.size() % RECLAIM_INTERVAL == 0) {
+            try_advance();
+            reclaim(record);
+        }
+    }
+
+    /**
+     * @brief Retorna a época global corrente.
+     */
+    uint64_t epoch() const { return m_epoch.load(); }
+
+    /**
+     * @brief Retorna quantos objetos aposentados já foram efetivamente liberados.
+     */
+    long long get_reclaimed() const { return m_reclaimed.load(); }
+};
+
+/**
+ * @brief Guard RAII que mantém a thread corrente ativa em um EpochManager durante o seu escopo.
+ */
+class EpochGuard {
+private:
+    EpochManager& m_manager;
+
+public:
+    explicit EpochGuard(EpochManager& manager) : m_manager(manager) { m_manager.enter(); }
+    ~EpochGuard() { m_manager.exit(); }
+    EpochGuard(const EpochGuard&) = delete;
+    EpochGuard& operator=(const EpochGuard&) = delete;
+};
+
+#endif
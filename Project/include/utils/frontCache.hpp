@@ -0,0 +1,118 @@
+#ifndef FRONT_CACHE_HPP
+#define FRONT_CACHE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Hash padrão do cache: std::hash<Key> quando existir.
+ *
+ * Para chaves sem std::hash (por exemplo, pares usados como chave composta) todas as chaves caem
+ * na mesma posição; o cache continua correto, apenas com pouca utilidade.
+ */
+template <typename Key, typename = void>
+struct FrontCacheHash {
+    size_t operator()(const Key&) const { return 0; }
+};
+
+template <typename Key>
+struct FrontCacheHash<Key, std::void_t<decltype(std::hash<Key>{}(std::declval<const Key&>()))>> : std::hash<Key> {};
+
+/**
+ * @brief Cache direto (direct-mapped) de ponteiros para nós recentemente acessados de uma árvore.
+ *
+ * Textos em linguagem natural seguem a lei de Zipf: poucas palavras ("de", "a", "o", "que")
+ * respondem por boa parte das ocorrências. O cache guarda, para cada posição hash(chave) & máscara,
+ * o último nó acessado com aquela posição, de modo que acessos repetidos à mesma chave evitam a
+ * descida O(log n) com comparações por collation. Uma entrada só é aceita se a chave do nó for
+ * exatamente igual à buscada; qualquer outra situação é tratada como falta (miss) e a árvore é
+ * consultada normalmente.
+ *
+ * O cache começa desativado (nenhuma posição). A árvore dona do cache deve chamar invalidate()
+ * sempre que um nó for liberado ou tiver seu par chave-valor trocado.
+ *
+ * @tparam Key Tipo da chave.
+ * @tparam Nodeptr Tipo do ponteiro de nó (o nó deve expor data.first).
+ * @tparam Hash Functor de hash utilizado para escolher a posição (padrão: FrontCacheHash<Key>).
+ */
+template <typename Key, typename Nodeptr, typename Hash = FrontCacheHash<Key>>
+class FrontCache {
+private:
+    std::vector<Nodeptr> m_slots;
+    size_t m_mask = 0;
+    Hash m_hashing;
+
+    mutable long long hits = 0;   // acessos resolvidos pelo cache
+    mutable long long misses = 0; // acessos que precisaram descer a árvore
+
+public:
+    /**
+     * @brief Ativa o cache com pelo menos 'slots' posições (arredondado para potência de 2).
+     *
+     * @param slots Número desejado de posições; 0 desativa o cache.
+     */
+    void enable(size_t slots) {
+        size_t capacity = 1;
+        while (capacity < slots) capacity <<= 1;
+
+        m_slots.assign(slots == 0 ? 0 : capacity, nullptr);
+        m_mask = m_slots.empty() ? 0 : capacity - 1;
+        hits = 0;
+        misses = 0;
+    }
+
+    /**
+     * @brief Retorna true se o cache estiver ativo.
+     */
+    bool enabled() const { return !m_slots.empty(); }
+
+    /**
+     * @brief Calcula a posição do cache associada à chave.
+     */
+    size_t slot_of(const Key& key) const { return m_hashing(key) & m_mask; }
+
+    /**
+     * @brief Procura a chave no cache.
+     *
+     * @param key Chave buscada.
+     * @param slot Posição já calculada com slot_of(key).
+     * @return Nodeptr Nó com a chave, ou nullptr em caso de falta.
+     */
+    Nodeptr lookup(const Key& key, size_t slot) const {
+        Nodeptr node = m_slots[slot];
+        if (node && node->data.first == key) {
+            hits++;
+            return node;
+        }
+        misses++;
+        return nullptr;
+    }
+
+    /**
+     * @brief Registra o nó na posição informada, substituindo o anterior.
+     */
+    void store(size_t slot, Nodeptr node) { m_slots[slot] = node; }
+
+    /**
+     * @brief Remove do cache a entrada que poderia apontar para o nó da chave informada.
+     */
+    void invalidate(const Key& key) {
+        if (enabled()) m_slots[slot_of(key)] = nullptr;
+    }
+
+    /**
+     * @brief Esvazia todas as posições (usado por clear()).
+     */
+    void invalidate_all() {
+        std::fill(m_slots.begin(), m_slots.end(), nullptr);
+    }
+
+    long long get_hits() const { return hits; }
+    long long get_misses() const { return misses; }
+};
+
+#endif
@@ -26,6 +26,7 @@
  *
  * Métodos:
  * - get(): Retorna uma referência constante para a string interna.
+ * - compare(): Comparação em três vias (uma única collation) usando o locale.
  * - operator<, operator>: Compara duas lexicalStr usando o locale.
  * - operator==, operator!=: Compara igualdade/desigualdade das strings internas.
  * - operator const std::string&(): Conversão explícita para std::string.
@@ -43,6 +44,25 @@ public:
 
     const std::string& get() const { return m_str; }
 
+    /**
+     * @brief Compara duas instâncias de lexicalStr em três vias segundo o locale.
+     *
+     * Executa a collation uma única vez e devolve o resultado completo, permitindo que
+     * quem precisa distinguir menor, igual e maior (como a descida nas árvores) pague
+     * apenas uma comparação por nó.
+     *
+     * @param other Outro objeto lexicalStr a ser comparado.
+     * @return Valor negativo se esta instância vier antes de 'other', zero se forem
+     *         equivalentes e positivo se vier depois, segundo as regras de collation do locale.
+     */
+    int compare(const lexicalStr& other) const {
+        const auto& collate = std::use_facet<std::collate<char>>(m_locale);
+        return collate.compare(
+            m_str.data(), m_str.data() + m_str.size(),
+            other.m_str.data(), other.m_str.data() + other.m_str.size()
+        );
+    }
+
     /**
      * @brief Operador de comparação menor (<) para objetos lexicalStr.
      *
@@ -54,13 +74,7 @@ public:
      * @return true se esta instância for considerada menor que 'other'
      *         de acordo com as regras de collation da localidade; caso contrário, false.
      */
-    bool operator<(const lexicalStr& other) const {
-        const auto& collate = std::use_facet<std::collate<char>>(m_locale);
-        return collate.compare(
-            m_str.data(), m_str.data() + m_str.size(),
-            other.m_str.data(), other.m_str.data() + other.m_str.size()
-        ) < 0;
-    }
+    bool operator<(const lexicalStr& other) const { return compare(other) < 0; }
 
     /**
      * @brief Operador de comparação maior (>) para objetos lexicalStr.
@@ -68,17 +82,11 @@ public:
      * Compara esta instância de lexicalStr com outra, utilizando as regras de ordenação
      * específicas da localidade (locale). Retorna true se esta instância for considerada
      * maior que 'other' de acordo com as regras de collation do locale configurado.
-     * A comparação é realizada utilizando o facet std::collate para garantir a correta
-     * ordenação sensível ao idioma.
      *
      * @param other Outro objeto lexicalStr a ser comparado.
      * @return true se esta instância for maior que 'other' segundo o locale; caso contrário, false.
      */
-    bool operator>(const lexicalStr& other) const {
-        const auto& coll = std::use_facet<std::collate<char>>(m_locale);
-        return coll.compare(m_str.data(), m_str.data() + m_str.size(),
-                            other.m_str.data(), other.m_str.data() + other.m_str.size()) > 0;
-    }
+    bool operator>(const lexicalStr& other) const { return compare(other) > 0; }
 
     /**
      * @brief Compara se duas instâncias de lexicalStr são iguais.
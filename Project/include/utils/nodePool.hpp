@@ -0,0 +1,126 @@
+#ifndef NODE_POOL_HPP
+#define NODE_POOL_HPP
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Alocador de nós em blocos (slab) de tamanho fixo.
+ *
+ * Em vez de uma chamada a new por nó, os nós são construídos em blocos contíguos de
+ * NodesPerSlab posições. Isso reduz o custo de alocação, elimina o cabeçalho do malloc de
+ * cada nó e deixa nós criados em sequência próximos na memória. Posições liberadas com
+ * destroy() entram em uma lista livre e são reaproveitadas pelas próximas criações.
+ *
+ * reserve(n) aloca antecipadamente os blocos necessários para n nós; eles ficam reservados e só
+ * passam a ser usados quando os blocos anteriores se esgotam.
+ *
+ * release() devolve todos os blocos de uma vez, sem percorrer os nós: é a liberação em massa
+ * usada pelos destrutores das árvores. Os destrutores dos objetos ainda vivos não são chamados
+ * por release(); quem usa o pool deve chamá-los antes, se não forem triviais.
+ *
+ * @tparam T Tipo do nó.
+ * @tparam NodesPerSlab Número de nós por bloco.
+ */
+template <typename T, size_t NodesPerSlab = 1024>
+class NodePool {
+private:
+    // Uma posição guarda um nó ou, enquanto livre, o ponteiro para a próxima posição livre
+    union Slot {
+        Slot* next;
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+    std::vector<std::unique_ptr<Slot[]>> m_slabs;
+    Slot* m_free = nullptr;               // lista de posições liberadas
+    size_t m_started = 0;                 // blocos já em uso; os seguintes foram reservados por reserve()
+    size_t m_usedInLast = NodesPerSlab;   // posições já entregues do último bloco em uso
+    size_t m_live = 0;                    // nós construídos e ainda não destruídos
+
+public:
+    NodePool() = default;
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+
+    /**
+     * @brief Constrói um nó em uma posição livre (reaproveitada ou nova).
+     *
+     * @param args Argumentos repassados ao construtor de T.
+     * @return T* Ponteiro para o nó construído.
+     */
+    template <typename... Args>
+    T* create(Args&&... args) {
+        Slot* slot;
+        if (m_free) {
+            slot = m_free;
+            m_free = slot->next;
+        } else {
+            if (m_usedInLast == NodesPerSlab) {
+                if (m_started == m_slabs.size()) {
+                    m_slabs.emplace_back(new Slot[NodesPerSlab]);
+                }
+                m_started++;
+                m_usedInLast = 0;
+            }
+            slot = &m_slabs[m_started - 1][m_usedInLast++];
+        }
+
+        try {
+            T* node = ::new (static_cast<void*>(slot->storage)) T(std::forward<Args>(args)...);
+            m_live++;
+            return node;
+        } catch (...) {
+            slot->next = m_free;
+            m_free = slot;
+            throw;
+        }
+    }
+
+    /**
+     * @brief Destrói o nó e devolve a sua posição à lista livre.
+     */
+    void destroy(T* node) {
+        node->~T();
+        Slot* slot = reinterpret_cast<Slot*>(node);
+        slot->next = m_free;
+        m_free = slot;
+        m_live--;
+    }
+
+    /**
+     * @brief Aloca blocos até que o pool comporte n nós no total (vivos, livres e ainda não entregues).
+     */
+    void reserve(size_t n) {
+        size_t slabs = (n + NodesPerSlab - 1) / NodesPerSlab;
+        m_slabs.reserve(slabs);
+        while (m_slabs.size() < slabs) {
+            m_slabs.emplace_back(new Slot[NodesPerSlab]);
+        }
+    }
+
+    /**
+     * @brief Libera todos os blocos de uma vez (sem chamar destrutores).
+     */
+    void release() {
+        m_slabs.clear();
+        m_free = nullptr;
+        m_started = 0;
+        m_usedInLast = NodesPerSlab;
+        m_live = 0;
+    }
+
+    /**
+     * @brief Retorna o número de nós vivos.
+     */
+    size_t live() const { return m_live; }
+
+    /**
+     * @brief Retorna o total de bytes reservados pelos blocos (inclusive os reservados por reserve()).
+     */
+    size_t bytes_reserved() const { return m_slabs.size() * NodesPerSlab * sizeof(Slot); }
+};
+
+#endif
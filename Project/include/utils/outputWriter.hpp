@@ -98,6 +98,17 @@ public:
             print_row({"Trocas de Cor", std::to_string(dictionary.get_colors())}, metric_widths);
         if (dictionary.get_collisions() > 0)
             print_row({"Colisões", std::to_string(dictionary.get_collisions())}, metric_widths);
+        if (dictionary.get_rehashes() > 0)
+            print_row({"Redimensionamentos", std::to_string(dictionary.get_rehashes())}, metric_widths);
+        print_line(metric_widths);
+
+        // --- Tabela de Memória ---
+        m_output_file << "\n--- Memória ---\n";
+        print_line(metric_widths);
+        print_row({"Métrica", "Valor"}, metric_widths);
+        print_line(metric_widths);
+        print_row({"Bytes por Nó", std::to_string(dictionary.get_node_bytes())}, metric_widths);
+        print_row({"Memória dos Nós (KB)", std::to_string(dictionary.get_node_bytes() * dictionary.size() / 1024)}, metric_widths);
         print_line(metric_widths);
 
         // --- Tabela de Frequência de Palavras ---
@@ -0,0 +1,92 @@
+#ifndef PROBING_POLICY_HPP
+#define PROBING_POLICY_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+
+/**
+ * @brief Políticas de sondagem da OpenAddressingHashTable, escolhidas pelo último parâmetro de template.
+ *
+ * Cada política é um cursor criado a partir do hash completo da chave e da política de dimensionamento
+ * da tabela (ver sizingPolicy.hpp): index() é o slot atual e next() avança para o próximo. Todas
+ * garantem que os primeiros size() slots visitados são distintos, ou seja, que a sondagem percorre a
+ * tabela inteira antes de repetir um slot; assim uma busca sempre encontra um slot vazio se ele existir.
+ *
+ * - DoubleHashProbing: passo derivado de outros bits do hash, primo com o tamanho da tabela. Com
+ *   tamanho primo, qualquer passo em [1, tamanho-1] serve; com potência de 2, o passo é ímpar; com
+ *   outros tamanhos (ModuloSizing), o passo é ajustado até o mdc com o tamanho ser 1.
+ * - LinearProbing: passo 1; cobre qualquer tamanho e percorre a memória em sequência.
+ * - TriangularProbing: sondagem quadrática com deslocamentos 1, 3, 6, 10... (i(i+1)/2); cobre a
+ *   tabela apenas com tamanho potência de 2, o que é verificado em tempo de compilação.
+ *
+ * Os avanços são menores que o tamanho da tabela, então o índice volta ao intervalo com uma subtração,
+ * sem o resto de uma divisão a cada passo.
+ */
+class DoubleHashProbing {
+private:
+    size_t m_index;
+    size_t m_step;
+    size_t m_size;
+
+public:
+    template <typename Sizing>
+    DoubleHashProbing(size_t h, const Sizing &sizing) : m_index(sizing.index(h)), m_size(sizing.size()) {
+        // bits altos do produto: dependem de todos os bits de h e são independentes do índice inicial
+        uint64_t bits = (static_cast<uint64_t>(h) * 0x9E3779B97F4A7C15ull) >> 32;
+        if constexpr (Sizing::power_of_two) {
+            m_step = (bits & (m_size - 1)) | 1;
+        } else {
+            m_step = m_size > 2 ? 1 + bits % (m_size - 1) : 1;
+            if constexpr (!Sizing::prime) {
+                while (std::gcd(m_step, m_size) != 1) {
+                    m_step = m_step + 1 == m_size ? 1 : m_step + 1;
+                }
+            }
+        }
+    }
+
+    size_t index() const { return m_index; }
+
+    void next() {
+        m_index += m_step;
+        if (m_index >= m_size) m_index -= m_size;
+    }
+};
+
+class LinearProbing {
+private:
+    size_t m_index;
+    size_t m_size;
+
+public:
+    template <typename Sizing>
+    LinearProbing(size_t h, const Sizing &sizing) : m_index(sizing.index(h)), m_size(sizing.size()) {}
+
+    size_t index() const { return m_index; }
+
+    void next() {
+        if (++m_index == m_size) m_index = 0;
+    }
+};
+
+class TriangularProbing {
+private:
+    size_t m_index;
+    size_t m_mask;
+    size_t m_offset = 0;
+
+public:
+    template <typename Sizing>
+    TriangularProbing(size_t h, const Sizing &sizing) : m_index(sizing.index(h)), m_mask(sizing.size() - 1) {
+        static_assert(Sizing::power_of_two, "TriangularProbing cobre a tabela apenas com tamanho potência de 2");
+    }
+
+    size_t index() const { return m_index; }
+
+    void next() {
+        m_index = (m_index + ++m_offset) & m_mask;
+    }
+};
+
+#endif
@@ -0,0 +1,142 @@
+#ifndef SIZING_POLICY_HPP
+#define SIZING_POLICY_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cmath>
+#include <stdexcept>
+
+/**
+ * @brief Políticas de dimensionamento das tabelas hash, escolhidas pelo último parâmetro de template
+ * de ChainedHashTable e OpenAddressingHashTable.
+ *
+ * Cada política é um valor pequeno guardado pela tabela: o construtor recebe o menor número de slots
+ * aceitável e escolhe a capacidade real (size()); index(h) reduz um código hash completo a um slot no
+ * intervalo [0 ... size()-1]. A redução é feita a cada busca, então o seu custo aparece em toda operação.
+ *
+ * - ModuloSizing: usa exatamente o tamanho pedido e h % size (comportamento original da tabela aberta).
+ * - TrialDivisionPrimeSizing: próximo primo por divisão por tentativa e h % primo (comportamento
+ *   original da tabela encadeada). A divisão inteira por um valor só conhecido em tempo de execução
+ *   custa dezenas de ciclos.
+ * - PrimeTableSizing: primos pré-calculados (aproximadamente em progressão 1, 1.5, 2, 3, 4...) e módulo
+ *   por multiplicação (Lemire, "faster remainder by direct computation"): o inverso do primo é
+ *   calculado uma vez no redimensionamento e cada redução custa duas multiplicações.
+ * - PowerOfTwoSizing: capacidade potência de 2 e redução de Fibonacci (multiplica pelo inverso da razão
+ *   áurea em 64 bits e fica com os bits mais altos). Uma multiplicação e um deslocamento; os bits altos
+ *   do produto dependem de todos os bits de h, então hashes fracos nos bits baixos não se concentram.
+ *
+ * As constantes power_of_two e prime descrevem os tamanhos escolhidos; as políticas de sondagem do
+ * endereçamento aberto (probingPolicy.hpp) as usam para escolher passos que cubram a tabela inteira.
+ */
+class ModuloSizing {
+private:
+    size_t m_size;
+
+public:
+    static constexpr bool power_of_two = false;
+    static constexpr bool prime = false;
+
+    explicit ModuloSizing(size_t min_size = 1) : m_size(min_size < 1 ? 1 : min_size) {}
+
+    size_t size() const { return m_size; }
+    size_t index(size_t h) const { return h % m_size; }
+};
+
+class TrialDivisionPrimeSizing {
+private:
+    size_t m_size;
+
+    // Menor primo maior que ou igual a x e maior que 2
+    static size_t next_prime(size_t x) {
+        if (x <= 2)
+            return 3;
+
+        x = (x % 2 == 0) ? x + 1 : x;
+
+        bool not_prime = true;
+        while (not_prime) {
+            not_prime = false;
+
+            for (size_t i = 3; i <= sqrt(x); i += 2) {
+                if (x % i == 0) {
+                    not_prime = true;
+                    break;
+                }
+            }
+            x += 2;
+        }
+        return x - 2;
+    }
+
+public:
+    static constexpr bool power_of_two = false;
+    static constexpr bool prime = true;
+
+    explicit TrialDivisionPrimeSizing(size_t min_size = 1) : m_size(next_prime(min_size)) {}
+
+    size_t size() const { return m_size; }
+    size_t index(size_t h) const { return h % m_size; }
+};
+
+class PrimeTableSizing {
+private:
+    static constexpr uint32_t PRIMES[] = {
+        3u, 5u, 7u, 11u, 13u, 17u, 29u, 37u, 53u, 67u, 97u, 131u, 193u, 257u, 389u, 521u, 769u, 1031u,
+        1543u, 2053u, 3079u, 4099u, 6151u, 8209u, 12289u, 16411u, 24593u, 32771u, 49157u, 65537u,
+        98317u, 131101u, 196613u, 262147u, 393241u, 524309u, 786433u, 1048583u, 1572869u, 2097169u,
+        3145739u, 4194319u, 6291469u, 8388617u, 12582917u, 16777259u, 25165843u, 33554467u, 50331653u,
+        67108879u, 100663319u, 134217757u, 201326611u, 268435459u, 402653189u, 536870923u, 805306457u,
+        1073741827u, 1610612741u, 2147483659u, 3221225473u
+    };
+
+    uint32_t m_size;
+    uint64_t m_inverse; // ceil(2^64 / m_size)
+
+public:
+    static constexpr bool power_of_two = false;
+    static constexpr bool prime = true;
+
+    explicit PrimeTableSizing(size_t min_size = 1) {
+        for (uint32_t p : PRIMES) {
+            if (p >= min_size) {
+                m_size = p;
+                m_inverse = UINT64_MAX / p + 1;
+                return;
+            }
+        }
+        throw std::length_error("PrimeTableSizing: tamanho acima do maior primo da tabela");
+    }
+
+    size_t size() const { return m_size; }
+
+    // O hash é dobrado para 32 bits, faixa em que o resto por multiplicação é exato
+    size_t index(size_t h) const {
+        uint32_t folded = static_cast<uint32_t>(h ^ (static_cast<uint64_t>(h) >> 32));
+        uint64_t low_bits = m_inverse * folded;
+        return static_cast<size_t>((static_cast<unsigned __int128>(low_bits) * m_size) >> 64);
+    }
+};
+
+class PowerOfTwoSizing {
+private:
+    static constexpr uint64_t FIBONACCI = 11400714819323198485ull; // 2^64 / razão áurea
+
+    size_t m_size;
+    unsigned m_shift; // 64 - log2(m_size)
+
+public:
+    static constexpr bool power_of_two = true;
+    static constexpr bool prime = false;
+
+    explicit PowerOfTwoSizing(size_t min_size = 1) : m_size(2), m_shift(63) {
+        while (m_size < min_size) {
+            m_size <<= 1;
+            m_shift--;
+        }
+    }
+
+    size_t size() const { return m_size; }
+    size_t index(size_t h) const { return static_cast<size_t>((static_cast<uint64_t>(h) * FIBONACCI) >> m_shift); }
+};
+
+#endif
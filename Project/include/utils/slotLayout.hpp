@@ -0,0 +1,170 @@
+#ifndef SLOT_LAYOUT_HPP
+#define SLOT_LAYOUT_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// Estado de cada slot da tabela com endereçamento aberto
+enum class SlotStatus : uint8_t
+{
+    EMPTY,
+    OCCUPIED,
+    DELETED
+};
+
+/**
+ * @brief Disposições em memória dos slots da OpenAddressingHashTable, escolhidas pelo último parâmetro
+ * de template.
+ *
+ * Cada disposição é uma etiqueta com o template Slots<Key, Value>, o vetor de slots usado pela tabela.
+ * A sondagem consulta status(i) e, em slots ocupados, matches(i, h) antes de comparar key(i); o rehash
+ * lê hash(i) e move o slot com move_from(), sem recalcular a função de hash. mark() e swap_slots()
+ * servem ao purge feito no próprio vetor: mudam o estado ou trocam dois slots sem alocar memória.
+ *
+ * - InterleavedSlots: vetor de structs (AoS) com par chave-valor, hash completo e estado lado a lado.
+ *   Cada slot visitado pela sondagem traz para a cache a chave e o valor, mesmo sem comparar a chave
+ *   (com std::string, um slot ocupa mais de meia linha de cache).
+ * - SplitSlots: vetores separados (SoA) de controle, hashes, chaves e valores. O controle tem um byte
+ *   por slot: vazio, removido ou ocupado com os 7 bits mais altos do hash (etiqueta). A sondagem
+ *   percorre apenas esse vetor denso (64 slots por linha de cache); o hash completo só é lido quando a
+ *   etiqueta coincide, e a chave só quando o hash também coincide.
+ */
+class InterleavedSlots {
+public:
+    template <typename Key, typename Value>
+    class Slots {
+    private:
+        struct HashSlot
+        {
+            std::pair<Key, Value> data;
+            size_t hash = 0; // hash completo da chave, calculado uma única vez na inserção
+            SlotStatus status = SlotStatus::EMPTY;
+        };
+
+        std::vector<HashSlot> m_slots;
+
+    public:
+        static constexpr size_t slot_bytes = sizeof(HashSlot);
+
+        Slots() = default;
+        explicit Slots(size_t n) : m_slots(n) {}
+
+        size_t size() const { return m_slots.size(); }
+        bool empty() const { return m_slots.empty(); }
+        void swap(Slots &other) { m_slots.swap(other.m_slots); }
+
+        SlotStatus status(size_t i) const { return m_slots[i].status; }
+        bool matches(size_t i, size_t h) const { return m_slots[i].hash == h; }
+        size_t hash(size_t i) const { return m_slots[i].hash; }
+        const Key &key(size_t i) const { return m_slots[i].data.first; }
+        Value &value(size_t i) { return m_slots[i].data.second; }
+        const Value &value(size_t i) const { return m_slots[i].data.second; }
+
+        void occupy(size_t i, const Key &k, const Value &v, size_t h)
+        {
+            m_slots[i].data = std::make_pair(k, v);
+            m_slots[i].hash = h;
+            m_slots[i].status = SlotStatus::OCCUPIED;
+        }
+
+        void erase(size_t i) { m_slots[i].status = SlotStatus::DELETED; }
+        void mark(size_t i, SlotStatus status) { m_slots[i].status = status; }
+        void swap_slots(size_t i, size_t j) { std::swap(m_slots[i], m_slots[j]); }
+
+        // Move o slot ocupado from de other para o slot to deste vetor
+        void move_from(Slots &other, size_t from, size_t to) { m_slots[to] = std::move(other.m_slots[from]); }
+
+        void clear()
+        {
+            for (auto &slot : m_slots)
+            {
+                slot.status = SlotStatus::EMPTY;
+            }
+        }
+    };
+};
+
+class SplitSlots {
+public:
+    template <typename Key, typename Value>
+    class Slots {
+    private:
+        static constexpr uint8_t CTRL_EMPTY = 0;
+        static constexpr uint8_t CTRL_DELETED = 1;
+        static constexpr uint8_t CTRL_OCCUPIED = 0x80; // bit alto marca ocupado; os outros 7 bits são a etiqueta
+
+        std::vector<uint8_t> m_ctrl;
+        std::vector<size_t> m_hashes;
+        std::vector<Key> m_keys;
+        std::vector<Value> m_values;
+
+        static uint8_t tag(size_t h) { return static_cast<uint8_t>(CTRL_OCCUPIED | (h >> (8 * sizeof(size_t) - 7))); }
+
+    public:
+        static constexpr size_t slot_bytes = sizeof(uint8_t) + sizeof(size_t) + sizeof(Key) + sizeof(Value);
+
+        Slots() = default;
+        explicit Slots(size_t n) : m_ctrl(n, CTRL_EMPTY), m_hashes(n), m_keys(n), m_values(n) {}
+
+        size_t size() const { return m_ctrl.size(); }
+        bool empty() const { return m_ctrl.empty(); }
+
+        void swap(Slots &other)
+        {
+            m_ctrl.swap(other.m_ctrl);
+            m_hashes.swap(other.m_hashes);
+            m_keys.swap(other.m_keys);
+            m_values.swap(other.m_values);
+        }
+
+        SlotStatus status(size_t i) const
+        {
+            return m_ctrl[i] & CTRL_OCCUPIED ? SlotStatus::OCCUPIED : m_ctrl[i] == CTRL_EMPTY ? SlotStatus::EMPTY : SlotStatus::DELETED;
+        }
+        bool matches(size_t i, size_t h) const { return m_ctrl[i] == tag(h) && m_hashes[i] == h; }
+        size_t hash(size_t i) const { return m_hashes[i]; }
+        const Key &key(size_t i) const { return m_keys[i]; }
+        Value &value(size_t i) { return m_values[i]; }
+        const Value &value(size_t i) const { return m_values[i]; }
+
+        void occupy(size_t i, const Key &k, const Value &v, size_t h)
+        {
+            m_keys[i] = k;
+            m_values[i] = v;
+            m_hashes[i] = h;
+            m_ctrl[i] = tag(h);
+        }
+
+        void erase(size_t i) { m_ctrl[i] = CTRL_DELETED; }
+
+        void mark(size_t i, SlotStatus status)
+        {
+            m_ctrl[i] = status == SlotStatus::OCCUPIED ? tag(m_hashes[i]) : status == SlotStatus::EMPTY ? CTRL_EMPTY : CTRL_DELETED;
+        }
+
+        void swap_slots(size_t i, size_t j)
+        {
+            using std::swap;
+            swap(m_ctrl[i], m_ctrl[j]);
+            swap(m_hashes[i], m_hashes[j]);
+            swap(m_keys[i], m_keys[j]);
+            swap(m_values[i], m_values[j]);
+        }
+
+        // Move o slot ocupado from de other para o slot to deste vetor
+        void move_from(Slots &other, size_t from, size_t to)
+        {
+            m_keys[to] = std::move(other.m_keys[from]);
+            m_values[to] = std::move(other.m_values[from]);
+            m_hashes[to] = other.m_hashes[from];
+            m_ctrl[to] = other.m_ctrl[from];
+        }
+
+        void clear() { std::fill(m_ctrl.begin(), m_ctrl.end(), CTRL_EMPTY); }
+    };
+};
+
+#endif
@@ -0,0 +1,153 @@
+#ifndef STRING_HASH_HPP
+#define STRING_HASH_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#include "lexicalStr.hpp"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <nmmintrin.h>
+#define STRING_HASH_HAS_SSE42_PATH 1
+#endif
+
+/**
+ * @brief Funções de hash de strings para o parâmetro Hash das tabelas (ChainedHashTable, FlatChainedHashTable,
+ * OpenAddressingHashTable e ConcurrentChainedHashTable).
+ *
+ * Todas aceitam std::string e lexicalStr (os bytes de get()), então a mesma função serve às chaves das
+ * tabelas e das árvores, e são selecionáveis na linha de comando do programa principal (--hash).
+ *
+ * - Fnv1aHash: FNV-1a de 64 bits, um byte por iteração (xor e multiplicação). Simples e de boa
+ *   dispersão, mas a cadeia de dependências byte a byte limita a vazão em palavras longas.
+ * - WyHash: no estilo do wyhash (não é idêntico bit a bit): lê 8 ou 16 bytes por vez e mistura com a
+ *   multiplicação 64x64->128 ("mum"), dobrando as duas metades do produto. Palavras de até 16 bytes,
+ *   quase todas em um texto, custam duas leituras e duas multiplicações.
+ * - Crc32cHash: CRC32C (polinômio de Castagnoli). Com SSE4.2 (verificado em tempo de execução) usa a
+ *   instrução crc32 sobre 8 bytes por vez; caso contrário, uma tabela de 256 entradas. O resultado tem
+ *   32 bits, suficiente para reduzir a qualquer tamanho de tabela deste projeto.
+ */
+namespace string_hash_detail {
+
+    inline const std::string& bytes_of(const std::string& s) { return s; }
+    inline const std::string& bytes_of(const lexicalStr& s) { return s.get(); }
+
+    inline uint64_t read64(const unsigned char* p) { uint64_t v; std::memcpy(&v, p, 8); return v; }
+    inline uint64_t read32(const unsigned char* p) { uint32_t v; std::memcpy(&v, p, 4); return v; }
+
+    // Multiplicação 64x64->128 dobrada em 64 bits
+    inline uint64_t mum(uint64_t a, uint64_t b) {
+        unsigned __int128 r = static_cast<unsigned __int128>(a) * b;
+        return static_cast<uint64_t>(r) ^ static_cast<uint64_t>(r >> 64);
+    }
+
+    // Tabela do CRC32C (polinômio refletido 0x82F63B78) para a versão sem SSE4.2
+    inline constexpr std::array<uint32_t, 256> CRC32C_TABLE = [] {
+        std::array<uint32_t, 256> table{};
+        for (uint32_t i = 0; i < 256; ++i) {
+            uint32_t crc = i;
+            for (int bit = 0; bit < 8; ++bit) {
+                crc = (crc >> 1) ^ (0x82F63B78u & (0u - (crc & 1u)));
+            }
+            table[i] = crc;
+        }
+        return table;
+    }();
+
+    inline uint32_t crc32c_table(const unsigned char* p, size_t len, uint32_t crc) {
+        for (size_t i = 0; i < len; ++i) {
+            crc = CRC32C_TABLE[(crc ^ p[i]) & 0xFFu] ^ (crc >> 8);
+        }
+        return crc;
+    }
+
+#ifdef STRING_HASH_HAS_SSE42_PATH
+    __attribute__((target("sse4.2")))
+    inline uint32_t crc32c_sse42(const unsigned char* p, size_t len, uint32_t crc) {
+        uint64_t crc64 = crc;
+        for (; len >= 8; p += 8, len -= 8) {
+            crc64 = _mm_crc32_u64(crc64, read64(p));
+        }
+        crc = static_cast<uint32_t>(crc64);
+        for (; len > 0; ++p, --len) {
+            crc = _mm_crc32_u8(crc, *p);
+        }
+        return crc;
+    }
+
+    inline bool cpu_has_sse42() {
+        static const bool has = __builtin_cpu_supports("sse4.2");
+        return has;
+    }
+#endif
+}
+
+struct Fnv1aHash {
+    template <typename Key>
+    size_t operator()(const Key& key) const {
+        const std::string& s = string_hash_detail::bytes_of(key);
+        uint64_t h = 14695981039346656037ull;
+        for (unsigned char c : s) {
+            h ^= c;
+            h *= 1099511628211ull;
+        }
+        return static_cast<size_t>(h);
+    }
+};
+
+struct WyHash {
+    static constexpr uint64_t P0 = 0xa0761d6478bd642full;
+    static constexpr uint64_t P1 = 0xe7037ed1a0b428dbull;
+
+    template <typename Key>
+    size_t operator()(const Key& key) const {
+        using namespace string_hash_detail;
+        const std::string& s = bytes_of(key);
+        const unsigned char* p = reinterpret_cast<const unsigned char*>(s.data());
+        size_t len = s.size();
+        uint64_t seed = P0;
+        uint64_t a;
+        uint64_t b;
+
+        if (len <= 16) {
+            if (len >= 4) {
+                size_t shift = (len >> 3) << 2; // 0 até 7 bytes, 4 a partir de 8: as leituras cobrem tudo
+                a = (read32(p) << 32) | read32(p + shift);
+                b = (read32(p + len - 4) << 32) | read32(p + len - 4 - shift);
+            } else if (len > 0) {
+                a = (static_cast<uint64_t>(p[0]) << 16) | (static_cast<uint64_t>(p[len >> 1]) << 8) | p[len - 1];
+                b = 0;
+            } else {
+                a = b = 0;
+            }
+        } else {
+            size_t i = len;
+            for (; i > 16; i -= 16, p += 16) {
+                seed = mum(read64(p) ^ P1, read64(p + 8) ^ seed);
+            }
+            a = read64(p + i - 16);
+            b = read64(p + i - 8);
+        }
+        return static_cast<size_t>(mum(P1 ^ len, mum(a ^ P1, b ^ seed)));
+    }
+};
+
+struct Crc32cHash {
+    template <typename Key>
+    size_t operator()(const Key& key) const {
+        using namespace string_hash_detail;
+        const std::string& s = bytes_of(key);
+        const unsigned char* p = reinterpret_cast<const unsigned char*>(s.data());
+#ifdef STRING_HASH_HAS_SSE42_PATH
+        if (cpu_has_sse42()) {
+            return ~crc32c_sse42(p, s.size(), ~0u);
+        }
+#endif
+        return ~crc32c_table(p, s.size(), ~0u);
+    }
+};
+
+#endif
@@ -0,0 +1,55 @@
+#ifndef THREE_WAY_COMPARE_HPP
+#define THREE_WAY_COMPARE_HPP
+
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief Política de comparação em três vias utilizada pelas árvores (AVL e Rubro-Negra).
+ *
+ * Devolve um inteiro negativo se a < b, zero se a == b e positivo se a > b. Assim, cada nó
+ * visitado durante uma descida custa uma única comparação de chaves, em vez do par
+ * `key < node` seguido de `key > node`.
+ *
+ * Se o tipo da chave possuir um método `int compare(const Key&) const` (como std::string e
+ * lexicalStr), ele é usado diretamente. Caso contrário, a ordem é derivada do operador <.
+ *
+ * @tparam Key Tipo da chave comparada.
+ */
+template <typename Key>
+struct ThreeWayCompare {
+private:
+    template <typename K>
+    static auto has_compare(int) -> decltype(std::declval<const K&>().compare(std::declval<const K&>()), std::true_type{});
+
+    template <typename K>
+    static std::false_type has_compare(...);
+
+public:
+    int operator()(const Key& a, const Key& b) const {
+        if constexpr (decltype(has_compare<Key>(0))::value) {
+            return a.compare(b);
+        } else {
+            return (a < b) ? -1 : ((b < a) ? 1 : 0);
+        }
+    }
+};
+
+/**
+ * @brief Política de comparação que reproduz o comportamento original das árvores.
+ *
+ * Usa `a < b` e, se necessário, `a > b`, ou seja, até duas comparações completas por nó.
+ * Mantida para tipos sem comparação em três vias e como referência nos benchmarks.
+ *
+ * @tparam Key Tipo da chave comparada.
+ */
+template <typename Key>
+struct LessThanCompare {
+    int operator()(const Key& a, const Key& b) const {
+        if (a < b) return -1;
+        if (a > b) return 1;
+        return 0;
+    }
+};
+
+#endif
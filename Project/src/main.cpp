@@ -13,34 +13,68 @@
 #include "../include/RB-TREE/rb_tree.hpp"
 #include "../include/Chained_Hash/ChainedHashTable.hpp"
 #include "../include/Open_Hash/OpenAddressingHashTable.hpp"
+#include "../include/Open_Hash/SwissHashTable.hpp"
 #include "../include/utils/outputWriter.hpp"
+#include "../include/utils/stringHash.hpp"
+
+/**
+ * @brief Cria a tabela hash pedida ("chained_hash", "open_hash" ou "swiss_hash") com a função de hash Hash.
+ *
+ * @return Ponteiro para a tabela, ou nullptr se structure_type não for uma tabela hash.
+ */
+template <typename KeyType, typename Hash>
+std::unique_ptr<IDictionary<KeyType, size_t>> make_hash_table(const std::string& structure_type) {
+    if (structure_type == "chained_hash") {
+        return std::make_unique<ChainedHashTable<KeyType, size_t, Hash>>();
+    } else if (structure_type == "open_hash") {
+        return std::make_unique<OpenAddressingHashTable<KeyType, size_t, Hash>>();
+    } else if (structure_type == "swiss_hash") {
+        return std::make_unique<SwissHashTable<KeyType, size_t, Hash>>();
+    }
+    return nullptr;
+}
 
 /**
  * @brief Executa o processamento de um arquivo de entrada utilizando uma estrutura de dados especificada,
  *        mede o tempo de execução e gera um relatório de saída.
  *
- * Esta função instancia dinamicamente uma estrutura de dicionário (AVL, Rubro-Negra, Hash Encadeado ou Hash Aberto)
+ * Esta função instancia dinamicamente uma estrutura de dicionário (AVL, Rubro-Negra, Hash Encadeado, Hash Aberto ou SwissTable)
  * de acordo com o parâmetro 'structure_type'. Em seguida, processa o arquivo de entrada informado por 'filename',
  * armazenando os dados na estrutura escolhida. O tempo de processamento é medido e, ao final, um relatório é gerado
  * e salvo no arquivo especificado por 'output_filename'.
  *
  * @tparam KeyType Tipo da chave utilizada no dicionário.
- * @param structure_type Tipo da estrutura de dados a ser utilizada ("avl", "rb", "chained_hash" ou "open_hash").
+ * @param structure_type Tipo da estrutura de dados a ser utilizada ("avl", "rb", "chained_hash", "open_hash" ou "swiss_hash").
  * @param filename Caminho para o arquivo de entrada a ser processado.
  * @param output_filename Caminho para o arquivo onde o relatório será salvo.
+ * @param hash_name Função de hash das tabelas ("std", "fnv1a", "wyhash" ou "crc32c"); ignorada pelas árvores.
+ * @param presize Se verdadeiro, a estrutura é dimensionada antes da leitura pelo vocabulário estimado
+ *        (ver ReadTxt::processFile).
  */
 template <typename KeyType>
-void run_and_generate_report(const std::string& structure_type, const std::string& filename, const std::string& output_filename) {
+void run_and_generate_report(const std::string& structure_type, const std::string& filename, const std::string& output_filename,
+                             const std::string& hash_name = "std", bool presize = false) {
     std::unique_ptr<IDictionary<KeyType, size_t>> dictionary;
+    std::string label = structure_type;
 
     if (structure_type == "avl") {
         dictionary = std::make_unique<AVL<KeyType, size_t>>();
     } else if (structure_type == "rb") {
         dictionary = std::make_unique<RB<KeyType, size_t>>();
-    } else if (structure_type == "chained_hash") {
-        dictionary = std::make_unique<ChainedHashTable<KeyType, size_t>>();
-    } else if (structure_type == "open_hash") {
-        dictionary = std::make_unique<OpenAddressingHashTable<KeyType, size_t>>();
+    } else if (structure_type == "chained_hash" || structure_type == "open_hash" || structure_type == "swiss_hash") {
+        if (hash_name == "std") {
+            dictionary = make_hash_table<KeyType, std::hash<KeyType>>(structure_type);
+        } else if (hash_name == "fnv1a") {
+            dictionary = make_hash_table<KeyType, Fnv1aHash>(structure_type);
+        } else if (hash_name == "wyhash") {
+            dictionary = make_hash_table<KeyType, WyHash>(structure_type);
+        } else if (hash_name == "crc32c") {
+            dictionary = make_hash_table<KeyType, Crc32cHash>(structure_type);
+        } else {
+            std::cerr << "Funcao de hash desconhecida: " << hash_name << std::endl;
+            return;
+        }
+        label += " (hash " + hash_name + ")";
     } else {
         std::cerr << "Tipo de estrutura desconhecido: " << structure_type << std::endl;
         return;
@@ -49,12 +83,12 @@ void run_and_generate_report(const std::string& structure_type, const std::strin
     ReadTxt<KeyType> processor;
 
     auto start = std::chrono::high_resolution_clock::now();
-    processor.processFile(filename, *dictionary);
+    processor.processFile(filename, *dictionary, presize);
     auto end = std::chrono::high_resolution_clock::now();
     double duration_seconds = std::chrono::duration<double>(end - start).count();
 
     OutputWriter<KeyType, size_t> writer(output_filename);
-    writer.write_report(structure_type, filename, duration_seconds, *dictionary);
+    writer.write_report(label, filename, duration_seconds, *dictionary);
 }
 
 /**
@@ -65,14 +99,18 @@ void run_and_generate_report(const std::string& structure_type, const std::strin
  * podendo também gerar relatórios de saída personalizados.
  *
  * Uso:
- *   ./programa <tipo_estrutura> <caminho_arquivo> [--out <arquivo_saida>]
- *   ./programa --all <caminho_arquivo>
+ *   ./programa <tipo_estrutura> <caminho_arquivo> [--out <arquivo_saida>] [--hash <funcao>] [--presize]
+ *   ./programa --all <caminho_arquivo> [--hash <funcao>] [--presize]
  *
  * Tipos de estrutura disponíveis:
  *   - avl
  *   - rb
  *   - chained_hash
  *   - open_hash
+ *   - swiss_hash
+ *
+ * Funções de hash das tabelas (--hash, padrão std): std, fnv1a, wyhash, crc32c (ver stringHash.hpp).
+ * --presize estima o vocabulário numa passagem de amostragem e dimensiona a estrutura antes da leitura.
  *
  * Parâmetros:
  *   @param argc Número de argumentos da linha de comando.
@@ -83,45 +121,53 @@ void run_and_generate_report(const std::string& structure_type, const std::strin
 int main(int argc, char* argv[]) {
     std::cout << "Bem-vindo ao Dicionário EDA!" << std::endl;
 
-    if ((argc != 3 && argc != 5) || (argc == 3 && argv[1] == std::string("--out"))) {
+    if (argc < 3 || argv[1] == std::string("--out") || argv[1] == std::string("--hash") || argv[1] == std::string("--presize")) {
         std::cerr << "Uso:\n"
-                  << "  " << argv[0] << " <tipo_estrutura> <caminho_arquivo> [--out <arquivo_saida>]\n"
-                  << "  " << argv[0] << " --all <caminho_arquivo>\n"
-                  << "Tipos disponíveis: avl, rb, chained_hash, open_hash\n";
+                  << "  " << argv[0] << " <tipo_estrutura> <caminho_arquivo> [--out <arquivo_saida>] [--hash <funcao>] [--presize]\n"
+                  << "  " << argv[0] << " --all <caminho_arquivo> [--hash <funcao>] [--presize]\n"
+                  << "Tipos disponíveis: avl, rb, chained_hash, open_hash, swiss_hash\n"
+                  << "Funções de hash: std, fnv1a, wyhash, crc32c\n";
         return 1;
     }
 
     std::string structure_type = argv[1];
     std::string filename = argv[2];
+    std::string output_filename = "output/resultado_" + structure_type + ".txt";
+    std::string hash_name = "std";
+    bool presize = false;
+
+    for (int i = 3; i < argc; ++i) {
+        std::string opt = argv[i];
+        if (opt == "--presize") {
+            presize = true;
+        } else if (opt == "--out" && structure_type != "--all" && i + 1 < argc) {
+            output_filename = argv[++i];
+        } else if (opt == "--hash" && i + 1 < argc) {
+            hash_name = argv[++i];
+        } else {
+            std::cerr << "Erro: argumento opcional inválido. Use '--out <arquivo_saida>', '--hash <funcao>' ou '--presize'" << std::endl;
+            return 1;
+        }
+    }
 
     if (structure_type == "--all") {
-        std::vector<std::string> structures = {"avl", "rb", "chained_hash", "open_hash"};
+        std::vector<std::string> structures = {"avl", "rb", "chained_hash", "open_hash", "swiss_hash"};
         for (const auto& s : structures) {
             std::string output_filename = "output/resultado_" + s + ".txt";
             std::cout << "\n--> Processando com estrutura: " << s << std::endl;
             if (s == "avl" || s == "rb") {
-                run_and_generate_report<lexicalStr>(s, filename, output_filename);
+                run_and_generate_report<lexicalStr>(s, filename, output_filename, "std", presize);
             } else {
-                run_and_generate_report<std::string>(s, filename, output_filename);
+                run_and_generate_report<std::string>(s, filename, output_filename, hash_name, presize);
             }
         }
     } else {
-        std::string output_filename = "output/resultado_" + structure_type + ".txt";
-        if (argc == 5) {
-            std::string opt = argv[3];
-            if (opt != "--out") {
-                std::cerr << "Erro: argumento opcional inválido. Use '--out <arquivo_saida>'" << std::endl;
-                return 1;
-            }
-            output_filename = argv[4];
-        }
-
         std::cout << "Processando '" << filename << "' com a estrutura '" << structure_type << "'..." << std::endl;
 
         if (structure_type == "avl" || structure_type == "rb") {
-            run_and_generate_report<lexicalStr>(structure_type, filename, output_filename);
-        } else if (structure_type == "chained_hash" || structure_type == "open_hash") {
-            run_and_generate_report<std::string>(structure_type, filename, output_filename);
+            run_and_generate_report<lexicalStr>(structure_type, filename, output_filename, "std", presize);
+        } else if (structure_type == "chained_hash" || structure_type == "open_hash" || structure_type == "swiss_hash") {
+            run_and_generate_report<std::string>(structure_type, filename, output_filename, hash_name, presize);
         } else {
             std::cerr << "Erro: Tipo de estrutura '" << structure_type << "' desconhecido." << std::endl;
             return 1;
@@ -7,13 +7,41 @@
 #include <algorithm>
 #include <random>
 #include <map>
+#include <set>
 #include <iomanip>
 #include <fstream>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <cmath>
+#include <unordered_set>
+#include <memory>
+#include <cstdlib>
+#include <new>
+#include <cstddef>
+#include <cstdio>
+#include <filesystem>
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 #include "../include/AVL/avl.hpp"
+#include "../include/AVL/persistentAvl.hpp"
+#include "../include/AVL/concurrentAvl.hpp"
 #include "../include/RB-TREE/rb_tree.hpp"
+#include "../include/RB-TREE/concurrentRb.hpp"
 #include "../include/Chained_Hash/ChainedHashTable.hpp"
+#include "../include/Chained_Hash/FlatChainedHashTable.hpp"
+#include "../include/Chained_Hash/ConcurrentChainedHashTable.hpp"
 #include "../include/Open_Hash/OpenAddressingHashTable.hpp"
+#include "../include/Open_Hash/RobinHoodHashTable.hpp"
+#include "../include/Open_Hash/SwissHashTable.hpp"
+#include "../include/ReadTxt/readTxt.hpp"
+#include "../include/TopK/rankedDictionary.hpp"
+#include "../include/utils/stringHash.hpp"
 
 //==================================================================
 // ESTRUTURA DE TESTES DE CORREÇÃO
@@ -49,6 +77,38 @@ void run_test(const std::function<bool()>& test_function, const std::string& tes
     }
 }
 
+// Functor de hash que conta quantas vezes foi chamado (para verificar que o rehash reutiliza o hash guardado)
+struct CountingHash {
+    static long long calls;
+    size_t operator()(const std::string& s) const { calls++; return std::hash<std::string>{}(s); }
+};
+long long CountingHash::calls = 0;
+
+// Hash fraco (soma dos bytes): todos os anagramas de uma palavra têm o mesmo hash completo
+struct ByteSumHash {
+    size_t operator()(const std::string& s) const { size_t h = 0; for (unsigned char c : s) h += c; return h; }
+};
+
+// --- Gera n anagramas distintos de "abcdefghij": sob ByteSumHash, todos colidem no mesmo slot ---
+std::vector<std::string> generate_colliding_keys(size_t n) {
+    std::vector<std::string> keys;
+    std::string w = "abcdefghij";
+    do { keys.push_back(w); } while (keys.size() < n && std::next_permutation(w.begin(), w.end()));
+    std::shuffle(keys.begin(), keys.end(), std::mt19937(67));
+    return keys;
+}
+
+// --- Escreve em um ficheiro temporário um texto com distribuição de Zipf (12 palavras por linha) e retorna o caminho ---
+std::vector<std::string> generate_zipf_stream(size_t vocabulary, size_t tokens, double s, unsigned seed);
+
+std::string write_zipf_text(const std::string& name, size_t vocabulary, size_t tokens, unsigned seed) {
+    std::string path = (std::filesystem::temp_directory_path() / name).string();
+    std::ofstream out(path);
+    std::vector<std::string> stream = generate_zipf_stream(vocabulary, tokens, 1.0, seed);
+    for (size_t i = 0; i < stream.size(); ++i) out << stream[i] << ((i + 1) % 12 ? ' ' : '\n');
+    return path;
+}
+
 void test_all_structures() {
     std::cout << "==========================================" << std::endl;
     std::cout << "        INICIANDO TESTES DE CORRECAO" << std::endl;
@@ -63,6 +123,13 @@ void test_all_structures() {
     run_test([](){ AVL<std::string, std::string> avl; avl.add("key1", "value1"); avl.add("key2", "value2"); avl.add("key3", "value3"); return avl.size() == 3; }, "AVL String Multiple adds");
     run_test([](){ AVL<std::string, std::string> avl; avl.add("key1", "value1"); avl.add("key2", "value2"); avl.remove("key1"); ASSERT_THROWS(avl.get("key1"), std::runtime_error); return avl.get("key2") == "value2"; }, "AVL String Remove");
 
+    // Testes AVL Persistente
+    run_test([](){ PersistentAVL<int,int> p; for (int i = 0; i < 100; ++i) p.add(i, i); p.remove(50); ASSERT_EQUAL(p.size(), 99u); ASSERT_EQUAL(p.contains(50), false); return p.get(99) == 99; }, "Persistent AVL add/remove");
+    run_test([](){ PersistentAVL<int,int> p; for (int i = 0; i < 64; ++i) p.add(i, 1); auto snap = p.snapshot(); for (int i = 0; i < 64; ++i) p.add(i, 2); p.add(100, 2); p.remove(10); ASSERT_EQUAL(snap.size(), 64u); ASSERT_EQUAL(snap.get(10), 1); ASSERT_EQUAL(snap.contains(100), false); return p.get(20) == 2 && !p.contains(10); }, "Persistent AVL snapshot is immutable");
+    run_test([](){ PersistentAVL<int,int> p; for (int i = 0; i < 1000; ++i) p.add(i, i); long long before = p.get_copies(); auto snap = p.snapshot(); p.add(1000, 0); return before == 0 && p.get_copies() > 0 && p.get_copies() < 30 && snap.get_all_keys_sorted().size() == 1000; }, "Persistent AVL copies only the path");
+    run_test([](){ ConcurrentAVL<int,int> c; std::map<int,int> m; std::mt19937 gen(7); for (int i = 0; i < 20000; ++i) { int k = gen() % 500; if (gen() % 3) { c.add(k, i); m[k] = i; } else { c.remove(k); m.erase(k); } } ASSERT_EQUAL(c.size(), m.size()); for (const auto& p : m) { ASSERT_EQUAL(c.get(p.first), p.second); } ASSERT_THROWS(c.get(1000), std::runtime_error); return c.validate(); }, "Concurrent AVL matches std::map");
+    run_test([](){ ConcurrentAVL<std::string,int> c; std::atomic<bool> stop{false}; std::atomic<int> wrong{0}; std::vector<std::thread> writers; for (int w = 0; w < 4; ++w) writers.emplace_back([&, w]() { for (int i = 0; i < 2000; ++i) { c.add("w" + std::to_string(w) + "_" + std::to_string(i), i); if (i % 3 == 0) c.remove("w" + std::to_string(w) + "_" + std::to_string(i / 2)); } }); std::thread reader([&]() { int v; while (!stop) for (int i = 0; i < 2000; i += 97) if (c.find("w0_" + std::to_string(i), v) && v != i) wrong++; }); for (auto& t : writers) t.join(); stop = true; reader.join(); std::set<std::string> expected; for (int w = 0; w < 4; ++w) { for (int i = 0; i < 2000; ++i) { expected.insert("w" + std::to_string(w) + "_" + std::to_string(i)); if (i % 3 == 0) expected.erase("w" + std::to_string(w) + "_" + std::to_string(i / 2)); } } ASSERT_EQUAL(wrong.load(), 0); ASSERT_EQUAL(c.size(), expected.size()); std::vector<std::string> keys = c.get_all_keys_sorted(); return c.validate() && std::equal(keys.begin(), keys.end(), expected.begin(), expected.end()); }, "Concurrent AVL parallel writers and readers");
+
     // Testes Rubro-Negra
     run_test([](){ RB<int,int> rb; rb.add(1,1); return rb.size() == 1; }, "RB add");
     run_test([](){ RB<int,int> rb; rb.add(1,1); return rb.get(1) == 1; }, "RB get");
@@ -71,6 +138,27 @@ void test_all_structures() {
     run_test([](){ RB<std::string, std::string> rb; rb.add("key1", "value1"); return rb.get("key1") == "value1"; }, "RB String add");
     run_test([](){ RB<std::string, std::string> rb; rb.add("key1", "value1"); rb.add("key2", "value2"); rb.add("key3", "value3"); return rb.size() == 3; }, "RB String Multiple adds");
     run_test([](){ RB<std::string, std::string> rb; rb.add("key1", "value1"); rb.add("key2", "value2"); rb.remove("key1"); ASSERT_THROWS(rb.get("key1"), std::runtime_error); return rb.get("key2") == "value2"; }, "RB String Remove");
+    run_test([](){ RB<int,int> rb; std::map<int,int> m; std::mt19937 gen(5); for (int i = 0; i < 20000; ++i) { int k = gen() % 500; if (gen() % 3 == 0) { if (m.erase(k)) rb.remove(k); } else { rb.add(k, i); m[k] = i; } } for (const auto& p : m) { ASSERT_EQUAL(rb.get(p.first), p.second); } return rb.size() == m.size(); }, "RB random insert/remove mix");
+
+    // Testes da comparação em três vias
+    run_test([](){ ThreeWayCompare<lexicalStr> cmp; ASSERT_EQUAL(cmp("a", "b") < 0, true); ASSERT_EQUAL(cmp("b", "a") > 0, true); return cmp("a", "a") == 0; }, "ThreeWayCompare lexicalStr");
+    run_test([](){ AVL<int,int> avl; avl.add(2,2); avl.add(1,1); avl.add(3,3); long long before = avl.get_comparisons(); avl.get(3); return avl.get_comparisons() - before == 2; }, "AVL one comparison per visited node");
+    run_test([](){ RB<int,int> rb; rb.add(2,2); rb.add(1,1); rb.add(3,3); long long before = rb.get_comparisons(); rb.get(3); return rb.get_comparisons() - before == 2; }, "RB one comparison per visited node");
+
+    // Testes da estrutura congelada
+    run_test([](){ AVL<int,int> avl; for (int i = 0; i < 1000; i += 2) avl.add(i, i * 10); auto frozen = avl.freeze(); ASSERT_EQUAL(frozen.size(), 500u); ASSERT_EQUAL(frozen.get(998), 9980); ASSERT_EQUAL(frozen.contains(1), false); ASSERT_EQUAL(frozen.contains(-1), false); ASSERT_EQUAL(frozen.contains(1001), false); ASSERT_THROWS(frozen.get(3), std::runtime_error); return frozen.get(0) == 0; }, "AVL freeze lookups");
+    run_test([](){ RB<std::string,int> rb; for (int i = 0; i < 257; ++i) rb.add("k" + std::to_string(i), i); auto frozen = rb.freeze(); ASSERT_EQUAL(frozen.get("k128"), 128); return frozen.get_all_keys_sorted() == rb.get_all_keys_sorted(); }, "RB freeze keeps order");
+    run_test([](){ AVL<std::string,int> avl; avl.enable_front_cache(64); for (int i = 0; i < 200; ++i) avl.add("k" + std::to_string(i % 20), i); for (int i = 0; i < 20; ++i) avl.remove("k" + std::to_string(i * 7 % 20)); ASSERT_EQUAL(avl.size(), 0u); avl.add("k3", 1); avl.add("k3", 2); ASSERT_EQUAL(avl.get("k3"), 2); ASSERT_THROWS(avl.get("k4"), std::runtime_error); return avl.get_cache_hits() > 0; }, "AVL front cache");
+    run_test([](){ RB<std::string,int> rb; rb.enable_front_cache(64); for (int i = 0; i < 300; ++i) rb.add("k" + std::to_string(i % 30), i); for (int i = 0; i < 30; i += 2) rb.remove("k" + std::to_string(i)); ASSERT_EQUAL(rb.size(), 15u); ASSERT_EQUAL(rb.contains("k2"), false); ASSERT_EQUAL(rb.get("k29"), 299); return rb.get_cache_hits() > 0; }, "RB front cache");
+    run_test([](){ RB<std::string,int> rb; for (int i = 0; i < 3000; ++i) rb.add("k" + std::to_string(i), i); for (int i = 0; i < 3000; i += 2) rb.remove("k" + std::to_string(i)); for (int i = 0; i < 3000; i += 2) rb.add("k" + std::to_string(i), -i); ASSERT_EQUAL(rb.size(), 3000u); ASSERT_EQUAL(rb.get("k10"), -10); ASSERT_EQUAL(rb.get("k11"), 11); rb.clear(); rb.add("z", 1); ASSERT_EQUAL(rb.get("z"), 1); return rb.get_node_bytes() == sizeof(std::pair<std::string,int>) + 3 * sizeof(void*); }, "RB compact pooled nodes");
+    run_test([](){ RB<int,int,ThreeWayCompare<int>,TopDownInsert> rb; std::map<int,int> m; std::mt19937 gen(3); for (int i = 0; i < 20000; ++i) { int k = gen() % 700; if (gen() % 4) { rb.add(k, i); m[k] = i; } else { rb.remove(k); m.erase(k); } } ASSERT_EQUAL(rb.size(), m.size()); for (const auto& p : m) { ASSERT_EQUAL(rb.get(p.first), p.second); } return rb.validate(); }, "RB top-down insert matches std::map");
+    run_test([](){ RB<int,int,ThreeWayCompare<int>,TopDownInsert> td; RB<int,int> bu; for (int i = 0; i < 5000; ++i) { td.add(i, i); bu.add(i, i); } return td.validate() && bu.validate() && td.get_all_keys_sorted() == bu.get_all_keys_sorted(); }, "RB top-down insert on sorted keys");
+    run_test([](){ RB<int,int> rb; auto it = rb.end(); for (int i = 100; i > 0; --i) it = rb.add_hint(it, i, -i); it = rb.add_hint(rb.find(50), 50, 0); ASSERT_EQUAL(it.value(), 0); rb.add_hint(rb.begin(), 1000, 1000); int expected = 1; for (auto p = rb.begin(); p != rb.find(1000); ++p, ++expected) { ASSERT_EQUAL(p.key(), expected); } auto last = rb.end(); --last; ASSERT_EQUAL(last.key(), 1000); ASSERT_EQUAL(rb.size(), 101u); return expected == 101 && rb.validate(); }, "RB iterator and add_hint");
+    run_test([](){ RB<int,int> rb; AVL<int,int> avl; for (int i = 0; i < 1000; ++i) { rb.add(i, i); avl.add(i, i); } rb.remove(999); avl.remove(999); rb.add(999, 1); avl.add(999, 1); ASSERT_EQUAL(avl.get(999), 1); return rb.validate() && rb.get_comparisons() < 1100 && avl.get_comparisons() < 1100; }, "Sorted input appends with one comparison");
+    run_test([](){ ConcurrentRB<int,int> c; std::map<int,int> m; std::mt19937 gen(9); for (int i = 0; i < 20000; ++i) { int k = gen() % 500; if (gen() % 3) { c.add(k, i); m[k] = i; } else { c.remove(k); m.erase(k); } } ASSERT_EQUAL(c.size(), m.size()); for (const auto& p : m) { ASSERT_EQUAL(c.get(p.first), p.second); } ASSERT_THROWS(c.get(1000), std::runtime_error); return c.validate(); }, "Concurrent RB matches std::map");
+    run_test([](){ ConcurrentRB<std::string,int> c; for (int i = 0; i < 1000; ++i) c.add("base" + std::to_string(i), i); std::atomic<bool> stop{false}; std::atomic<int> wrong{0}; std::vector<std::thread> readers; for (int r = 0; r < 3; ++r) readers.emplace_back([&, r]() { std::mt19937 gen(r); int v; while (!stop) { int i = gen() % 1000; if (!c.find("base" + std::to_string(i), v) || v != i) wrong++; } }); for (int i = 0; i < 5000; ++i) { c.add("w" + std::to_string(i), i); if (i % 4 == 0) c.remove("w" + std::to_string(i / 2)); } stop = true; for (auto& t : readers) t.join(); ASSERT_EQUAL(wrong.load(), 0); ASSERT_EQUAL(c.size(), 1000u + 5000u - 1250u); return c.validate(); }, "Concurrent RB readers during ingest");
+    run_test([](){ RankedDictionary<std::string, size_t> ranked(std::make_unique<ChainedHashTable<std::string, size_t>>()); std::map<std::string, size_t> counts; std::mt19937 gen(4); for (int i = 0; i < 5000; ++i) { std::string w = "w" + std::to_string(gen() % 300 % (1 + gen() % 300)); size_t c = ranked.contains(w) ? ranked.get(w) + 1 : 1; ranked.add(w, c); counts[w] = c; } ranked.remove("w0"); counts.erase("w0"); std::vector<std::pair<std::string, size_t>> expected(counts.begin(), counts.end()); std::sort(expected.begin(), expected.end(), [](const auto& a, const auto& b) { return a.second != b.second ? a.second > b.second : a.first < b.first; }); expected.resize(20); ASSERT_EQUAL(ranked.size(), counts.size()); ASSERT_EQUAL(ranked.top_k(1000).size(), counts.size()); return ranked.top_k(20) == expected; }, "Ranked dictionary top_k");
+    run_test([](){ RB<int,int> rb; for (int i = 1; i <= 6; ++i) rb.add(i, -i); auto frozen = rb.freeze(); int expected = 1; for (auto it = frozen.begin(); it != frozen.end(); ++it, ++expected) { ASSERT_EQUAL(it.key(), expected); ASSERT_EQUAL((*it).second, -expected); } ASSERT_THROWS(frozen.add(7, 7), std::logic_error); return expected == 7; }, "Frozen ordered iterator");
 
     // Testes Hash Encadeada
     run_test([](){ ChainedHashTable<int,int> ht; ht.add(1,1); return ht.size() == 1; }, "Chained Hash Insert");
@@ -80,6 +168,28 @@ void test_all_structures() {
     run_test([](){ ChainedHashTable<std::string, int> ht; ht.add("key1", 1); return ht.get("key1") == 1; }, "Chained Hash String Insert");
     run_test([](){ ChainedHashTable<std::string, int> ht; ht.add("key1", 1); ht.add("key2", 2); ht.add("key3", 3); return ht.size() == 3; }, "Chained Hash String Multiple Inserts");
     run_test([](){ ChainedHashTable<std::string, int> ht; ht.add("key1", 1); ht.add("key2", 2); ht.remove("key1"); ASSERT_THROWS(ht.get("key1"), std::out_of_range); return ht.get("key2") == 2; }, "Chained Hash String Remove"); 
+    run_test([](){ FlatChainedHashTable<int,int> ht; std::map<int,int> m; std::mt19937 gen(5); for (int i = 0; i < 20000; ++i) { int k = gen() % 3000; if (gen() % 4) { ht.add(k, i); m[k] = i; } else if (m.count(k)) { ht.remove(k); m.erase(k); } else { ASSERT_THROWS(ht.remove(k), std::out_of_range); } } ASSERT_EQUAL(ht.size(), m.size()); for (const auto& p : m) { ASSERT_EQUAL(ht.get(p.first), p.second); } ASSERT_THROWS(ht.get(-1), std::out_of_range); std::vector<int> keys = ht.get_all_keys_sorted(); return keys.size() == m.size() && std::equal(keys.begin(), keys.end(), m.begin(), [](int k, const auto& p) { return k == p.first; }); }, "Flat Chained Hash matches std::map");
+    run_test([](){ ChainedHashTable<std::string,int> list(101, 8.0); FlatChainedHashTable<std::string,int> flat(101, 8.0); for (int i = 0; i < 700; ++i) { list.add("k" + std::to_string(i), i); flat.add("k" + std::to_string(i), i); } for (int i = 0; i < 900; i += 3) { list.contains("k" + std::to_string(i)); flat.contains("k" + std::to_string(i)); } ASSERT_EQUAL(flat.get_collisions(), list.get_collisions()); return flat.get_comparisons() == list.get_comparisons() && flat.get_node_bytes() < list.get_node_bytes(); }, "Flat Chained Hash keeps list metrics");
+    run_test([](){ ChainedHashTable<std::string,int,CountingHash> list(3, 4.0); FlatChainedHashTable<std::string,int,CountingHash> flat(3, 4.0); CountingHash::calls = 0; for (int i = 0; i < 2000; ++i) { list.add("k" + std::to_string(i), i); flat.add("k" + std::to_string(i), i); } ASSERT_EQUAL(CountingHash::calls, 4000); for (int i = 0; i < 2000; i += 7) { ASSERT_EQUAL(list.get("k" + std::to_string(i)), i); ASSERT_EQUAL(flat.get("k" + std::to_string(i)), i); } return list.get_skipped_comparisons() > 0 && list.get_skipped_comparisons() == flat.get_skipped_comparisons(); }, "Chained Hash rehash reuses stored hashes");
+    run_test([](){ ChainedHashTable<std::string,int,ByteSumHash> ht(3); ht.enable_incremental_rehash(4); std::vector<std::string> keys = generate_colliding_keys(3000); std::map<std::string,int> m; std::mt19937 gen(13); for (int i = 0; i < 20000; ++i) { const std::string& k = keys[gen() % keys.size()]; if (gen() % 3) { ht.add(k, i); m[k] = i; } else if (m.count(k)) { ht.remove(k); m.erase(k); } else { ASSERT_THROWS(ht.remove(k), std::out_of_range); } } ASSERT_EQUAL(ht.size(), m.size()); for (const auto& p : m) { ASSERT_EQUAL(ht.get(p.first), p.second); } ASSERT_EQUAL(ht.get_treeified_buckets(), 1u); long long before = ht.get_comparisons(); ht.contains(m.begin()->first); ASSERT_EQUAL(ht.get_comparisons() - before < 30, true); ht.set_treeify_threshold(0); ASSERT_EQUAL(ht.get_treeified_buckets(), 0u); before = ht.get_comparisons(); ht.contains("jihgfedcba"); ASSERT_EQUAL(ht.get_comparisons() - before, static_cast<long long>(m.size())); ht.set_treeify_threshold(8); for (const auto& p : m) { if (ht.size() > 5) ht.remove(p.first); } std::vector<std::string> left = ht.get_all_keys_sorted(); return ht.get_treeified_buckets() == 0 && left.size() == 5 && ht.get(left.back()) == m[left.back()]; }, "Chained Hash treeified buckets match std::map");
+    run_test([](){ ChainedHashTable<std::string,int> ht(3); ht.add("first", -1); const int* value = &ht.get("first"); for (int i = 0; i < 5000; ++i) ht.add("k" + std::to_string(i), i); ASSERT_EQUAL(&ht.get("first"), value); ASSERT_EQUAL(ht.size(), 5001u); for (int i = 0; i < 5000; i += 13) { ASSERT_EQUAL(ht.get("k" + std::to_string(i)), i); } return *value == -1; }, "Chained Hash rehash moves nodes without copying");
+    run_test([](){ ChainedHashTable<int,int> ht(3); ht.enable_incremental_rehash(2); std::map<int,int> m; std::mt19937 gen(11); bool saw_rehash = false; for (int i = 0; i < 30000; ++i) { int k = gen() % 6000; if (gen() % 4) { ht.add(k, i); m[k] = i; } else if (m.count(k)) { ht.remove(k); m.erase(k); } else { ASSERT_THROWS(ht.remove(k), std::out_of_range); } saw_rehash = saw_rehash || ht.is_rehashing(); if (i % 97 == 0) { ASSERT_EQUAL(ht.contains(k), m.count(k) == 1); } } ASSERT_EQUAL(ht.size(), m.size()); for (const auto& p : m) { ASSERT_EQUAL(ht.get(p.first), p.second); } std::vector<int> keys = ht.get_all_keys_sorted(); return saw_rehash && keys.size() == m.size(); }, "Chained Hash incremental rehash matches std::map");
+    run_test([](){ PrimeTableSizing primes(1000); PowerOfTwoSizing pow2(1000); ASSERT_EQUAL(primes.size(), 1031u); ASSERT_EQUAL(pow2.size(), 1024u); std::mt19937_64 gen(17); for (int i = 0; i < 100000; ++i) { size_t h = gen(); size_t folded = static_cast<uint32_t>(h ^ (h >> 32)); ASSERT_EQUAL(primes.index(h), folded % 1031); ASSERT_EQUAL(pow2.index(h) < 1024, true); } return TrialDivisionPrimeSizing(1000).size() == 1009; }, "Sizing policies");
+    run_test([](){ ChainedHashTable<int,int,std::hash<int>,PowerOfTwoSizing> pow2(3); ChainedHashTable<int,int,std::hash<int>,PrimeTableSizing> primes(3); OpenAddressingHashTable<int,int,std::hash<int>,PowerOfTwoSizing> open(4); for (int i = 0; i < 20000; ++i) { pow2.add(i * 1024, i); primes.add(i, i); open.add(i * 64, i); } for (int i = 0; i < 20000; i += 3) { ASSERT_EQUAL(pow2.get(i * 1024), i); ASSERT_EQUAL(primes.get(i), i); ASSERT_EQUAL(open.get(i * 64), i); } ASSERT_EQUAL(open.contains(1), false); return pow2.size() == 20000 && pow2.get_comparisons() < 3 * 20000 * 2; }, "Hash tables with sizing policies");
+    run_test([](){ RobinHoodHashTable<int,int> rh(3); std::map<int,int> m; std::mt19937 gen(23); for (int i = 0; i < 40000; ++i) { int k = gen() % 5000; if (gen() % 3) { rh.add(k, i); m[k] = i; } else { rh.remove(k); m.erase(k); } } ASSERT_EQUAL(rh.size(), m.size()); for (const auto& p : m) { ASSERT_EQUAL(rh.get(p.first), p.second); } ASSERT_THROWS(rh.get(-1), std::out_of_range); ASSERT_EQUAL(rh.contains(5000), false); std::vector<int> keys = rh.get_all_keys_sorted(); ASSERT_EQUAL(keys.size(), m.size()); RobinHoodHashTable<std::string,int,CountingHash> counted(8); CountingHash::calls = 0; for (int i = 0; i < 3000; ++i) counted.add("k" + std::to_string(i), i); ASSERT_EQUAL(CountingHash::calls, 3000); return keys.front() == m.begin()->first && rh.get_max_probe_length() < 40 && counted.get_rehashes() > 5; }, "Robin Hood Hash matches std::map");
+    run_test([](){ RobinHoodHashTable<int,int> rh(1 << 12, 0.99f); std::mt19937 gen(29); std::vector<int> live; for (int i = 0; i < 3800; ++i) { rh.add(i, i); live.push_back(i); } for (int i = 3800; i < 60000; ++i) { size_t victim = gen() % live.size(); rh.remove(live[victim]); live[victim] = i; rh.add(i, i); } ASSERT_EQUAL(rh.bucket_count(), 4096u); ASSERT_EQUAL(rh.size(), 3800u); for (int k : live) { ASSERT_EQUAL(rh.get(k), k); } long long comparisons = rh.get_comparisons(); for (int miss = -1; miss > -1001; --miss) rh.contains(miss); return rh.get_mean_probe_length() < 8 && (rh.get_comparisons() - comparisons) / 1000 < 20; }, "Robin Hood Hash churn keeps probes short");
+    run_test([](){ ASSERT_THROWS((RobinHoodHashTable<int,int>(8, 0.0f)), std::out_of_range); ASSERT_THROWS((RobinHoodHashTable<int,int>(8, 1.5f)), std::out_of_range); RobinHoodHashTable<int,int> rh(8); long long last_collisions = 0; for (int i = 0; i < 5000; ++i) { rh.add(i * 7, i); ASSERT_EQUAL(rh.get_collisions() >= last_collisions, true); last_collisions = rh.get_collisions(); } return rh.get_rehashes() > 5 && last_collisions > 0 && last_collisions < 5000 && rh.get(4999 * 7) == 4999; }, "Robin Hood Hash validates load factor and keeps collisions across rehash");
+    run_test([](){ SwissHashTable<int,int> sw; std::map<int,int> m; std::mt19937 gen(31); for (int i = 0; i < 60000; ++i) { int k = gen() % 6000; if (gen() % 3) { sw.add(k, i); m[k] = i; } else { sw.remove(k); m.erase(k); } } ASSERT_EQUAL(sw.size(), m.size()); for (const auto& p : m) { ASSERT_EQUAL(sw.get(p.first), p.second); } ASSERT_THROWS(sw.get(-1), std::out_of_range); ASSERT_EQUAL(sw.contains(6000), false); std::vector<int> keys = sw.get_all_keys_sorted(); ASSERT_EQUAL(keys.size(), m.size()); SwissHashTable<int,int> tiny; for (int i = 0; i < 13; ++i) tiny.add(i * 16, i); ASSERT_EQUAL(tiny.bucket_count(), 16u); for (int i = 0; i < 13; ++i) { ASSERT_EQUAL(tiny.get(i * 16), i); } SwissHashTable<std::string,int,CountingHash> counted; CountingHash::calls = 0; for (int i = 0; i < 3000; ++i) counted.add("k" + std::to_string(i), i); ASSERT_EQUAL(CountingHash::calls, 3000); return keys.front() == m.begin()->first && counted.get_rehashes() > 5 && counted.get("k2999") == 2999; }, "Swiss Hash matches std::map");
+    run_test([](){ SwissHashTable<int,int> sw(1 << 12); std::mt19937 gen(37); std::vector<int> live; for (int i = 0; i < 3000; ++i) { sw.add(i, i); live.push_back(i); } for (int i = 3000; i < 60000; ++i) { size_t victim = gen() % live.size(); sw.remove(live[victim]); live[victim] = i; sw.add(i, i); } ASSERT_EQUAL(sw.bucket_count(), 4096u); ASSERT_EQUAL(sw.size(), 3000u); for (int k : live) { ASSERT_EQUAL(sw.get(k), k); } long long before = sw.get_comparisons(); for (int miss = -1; miss > -1001; --miss) sw.contains(miss); return (sw.get_comparisons() - before) / 1000 < 4; }, "Swiss Hash churn at high load");
+    run_test([](){ ASSERT_THROWS((SwissHashTable<int,int>(16, 0.0f)), std::out_of_range); ASSERT_THROWS((SwissHashTable<int,int>(16, 1.5f)), std::out_of_range); SwissHashTable<int,int> sw(1 << 10); long long last_collisions = 0; for (int i = 0; i < 60000; ++i) { sw.add(i, i); if (i >= 600) sw.remove(i - 600); ASSERT_EQUAL(sw.get_collisions() >= last_collisions, true); last_collisions = sw.get_collisions(); } return sw.bucket_count() == 1024u && sw.get_rehashes() > 5 && last_collisions > 0 && sw.get(59999) == 59999; }, "Swiss Hash validates load factor and keeps collisions across purges");
+    run_test([](){ ChainedHashTable<int,int> c; FlatChainedHashTable<int,int> f; OpenAddressingHashTable<int,int> o; ChainedHashTable<int,int> grown; c.reserve(20000); f.reserve(20000); o.reserve(20000); for (int i = 0; i < 20000; ++i) { c.add(i, i); f.add(i, i); o.add(i, i); grown.add(i, i); } ASSERT_EQUAL(c.get_rehashes(), 1); ASSERT_EQUAL(f.get_rehashes(), 1); ASSERT_EQUAL(o.get_rehashes(), 1); c.reserve(100); o.reserve(100); ASSERT_EQUAL(c.get_rehashes() + o.get_rehashes(), 2); for (int i = 0; i < 20000; i += 7) { ASSERT_EQUAL(c.get(i) + f.get(i) + o.get(i), 3 * i); } return grown.get_rehashes() > 8; }, "Hash tables reserve avoids rehash");
+    
+    run_test([](){ std::string check = "123456789"; const unsigned char* bytes = reinterpret_cast<const unsigned char*>(check.data()); ASSERT_EQUAL(Crc32cHash{}(check), 0xE3069283u); ASSERT_EQUAL(~string_hash_detail::crc32c_table(bytes, check.size(), ~0u), 0xE3069283u); ASSERT_EQUAL(Fnv1aHash{}(std::string("a")), 0xaf63dc4c8601ec8cull); ASSERT_EQUAL(WyHash{}(lexicalStr("palavra")), WyHash{}(std::string("palavra"))); std::set<size_t> seen; for (int len = 0; len < 40; ++len) seen.insert(WyHash{}(std::string(len, 'x'))); ASSERT_EQUAL(seen.size(), 40u); ChainedHashTable<std::string,int,WyHash> chained; FlatChainedHashTable<std::string,int,Fnv1aHash> flat; OpenAddressingHashTable<std::string,int,Crc32cHash> open; for (int i = 0; i < 5000; ++i) { std::string k = "w" + std::to_string(i); chained.add(k, i); flat.add(k, i); open.add(k, i); } for (int i = 0; i < 5000; i += 7) { std::string k = "w" + std::to_string(i); ASSERT_EQUAL(chained.get(k) + flat.get(k) + open.get(k), 3 * i); } return !chained.contains("w5000") && open.size() == 5000; }, "String hash functions");
+    run_test([](){ ConcurrentChainedHashTable<int,int> c(4, 3); std::map<int,int> m; std::mt19937 gen(21); for (int i = 0; i < 20000; ++i) { int k = gen() % 2000; int dice = gen() % 4; if (dice == 0) { c.remove(k); m.erase(k); } else if (dice == 1) { ASSERT_EQUAL(c.increment(k, 3), m[k] += 3); } else { c.add(k, i); m[k] = i; } } ASSERT_EQUAL(c.size(), m.size()); for (const auto& p : m) { ASSERT_EQUAL(c.get(p.first), p.second); } ASSERT_THROWS(c.get(5000), std::out_of_range); std::vector<int> keys = c.get_all_keys_sorted(); return c.get_resizes() > 0 && keys.size() == m.size() && keys.front() == m.begin()->first; }, "Concurrent Chained Hash matches std::map");
+    run_test([](){ ConcurrentChainedHashTable<std::string,int> c(8); for (int i = 0; i < 20000; ++i) c.add("k" + std::to_string(i), i); size_t grown = c.bucket_count(); for (int i = 0; i < 20000; ++i) c.remove("k" + std::to_string(i)); ASSERT_EQUAL(c.size(), 0u); for (int i = 0; i < 2000; ++i) c.add("n" + std::to_string(i), i); ASSERT_EQUAL(c.size(), 2000u); ASSERT_EQUAL(c.get("n1999"), 1999); return c.bucket_count() == grown; }, "Concurrent Chained Hash stripe counts survive resizes");
+    run_test([](){ ConcurrentChainedHashTable<std::string,long long> c(8); std::vector<std::thread> threads; for (int t = 0; t < 8; ++t) threads.emplace_back([&, t]() { for (int i = 0; i < 5000; ++i) { c.increment("hot" + std::to_string(i % 4)); c.increment("t" + std::to_string(t) + "_" + std::to_string(i)); if (i % 5 == 0) c.remove("t" + std::to_string(t) + "_" + std::to_string(i / 2)); } }); for (auto& th : threads) th.join(); for (int h = 0; h < 4; ++h) { ASSERT_EQUAL(c.get("hot" + std::to_string(h)), 8 * 1250LL); } std::set<std::string> expected; for (int i = 0; i < 5000; ++i) { expected.insert("t0_" + std::to_string(i)); if (i % 5 == 0) expected.erase("t0_" + std::to_string(i / 2)); } size_t own = 0; c.for_each([&](const std::string& k, long long v) { if (k.compare(0, 3, "t0_") == 0) { own++; if (v != 1 || !expected.count(k)) own = 1u << 30; } }); ASSERT_EQUAL(own, expected.size()); return c.size() == 4 + 8 * expected.size() && c.get_resizes() > 0; }, "Concurrent Chained Hash parallel increments");
+    run_test([](){ NodePool<int> pool; pool.reserve(2048); size_t reserved = pool.bytes_reserved(); std::vector<int*> nodes; for (int i = 0; i < 2048; ++i) nodes.push_back(pool.create(i)); ASSERT_EQUAL(pool.bytes_reserved(), reserved); ASSERT_EQUAL(*nodes[2047], 2047); AVL<std::string,int> avl; RB<std::string,int> rb; avl.reserve(3000); rb.reserve(3000); for (int i = 0; i < 3000; ++i) { avl.add(std::to_string(i), i); rb.add(std::to_string(i), i); } for (int i = 0; i < 3000; i += 2) { avl.remove(std::to_string(i)); rb.remove(std::to_string(i)); } ASSERT_EQUAL(avl.size(), 1500u); ASSERT_EQUAL(avl.get("2999"), 2999); avl.clear(); avl.add("x", 1); return rb.validate() && rb.size() == 1500 && rb.get("1") == 1 && avl.get("x") == 1; }, "Tree node pool reserve");
+    run_test([](){ std::string path = write_zipf_text("readtxt_estimate_test.txt", 40000, 300000, 17); ReadTxt<std::string> reader; ChainedHashTable<std::string,size_t> exact; reader.processFile(path, exact, false); ChainedHashTable<std::string,size_t> presized; reader.processFile(path, presized, true); double ratio = static_cast<double>(reader.estimate_distinct_words(path)) / exact.size(); std::remove(path.c_str()); ASSERT_EQUAL(presized.size(), exact.size()); for (const auto& k : exact.get_all_keys_sorted()) { ASSERT_EQUAL(presized.get(k), exact.get(k)); } std::string small = (std::filesystem::temp_directory_path() / "readtxt_small_test.txt").string(); std::ofstream(small) << "Casa casa-grande\ncasa Água água"; size_t small_estimate = reader.estimate_distinct_words(small); std::remove(small.c_str()); ASSERT_EQUAL(small_estimate, 3u); return ratio > 0.5 && ratio < 2.0 && presized.get_rehashes() <= 2 && exact.get_rehashes() > 8; }, "ReadTxt estimates distinct words and presizes");
     
     // Testes Hash Endereçamento Aberto
     run_test([](){ OpenAddressingHashTable<int,int> oht(10); oht.add(1,1); return oht.size() == 1; }, "Open Addressing Hash Insert");
@@ -89,12 +199,49 @@ void test_all_structures() {
     run_test([](){ OpenAddressingHashTable<std::string, int> oht(10); oht.add("key1", 1); return oht.get("key1") == 1; }, "Open Addressing Hash String Insert");
     run_test([](){ OpenAddressingHashTable<std::string, int> oht(10); oht.add("key1", 1); oht.add("key2", 2); oht.add("key3", 3); return oht.size() == 3; }, "Open Addressing Hash String Multiple Inserts");
     run_test([](){ OpenAddressingHashTable<std::string, int> oht(10); oht.add("key1", 1); oht.add("key2", 2); oht.remove("key1"); ASSERT_THROWS(oht.get("key1"), std::out_of_range); return oht.get("key2") == 2; }, "Open Addressing Hash String Remove");
+    run_test([](){ OpenAddressingHashTable<std::string,int,CountingHash> oht(7); CountingHash::calls = 0; for (int i = 0; i < 3000; ++i) oht.add("k" + std::to_string(i), i); ASSERT_EQUAL(CountingHash::calls, 3000); for (int i = 0; i < 3000; i += 2) oht.remove("k" + std::to_string(i)); ASSERT_EQUAL(oht.size(), 1500u); ASSERT_EQUAL(oht.contains("k10"), false); ASSERT_THROWS(oht.get("k3000"), std::out_of_range); for (int i = 1; i < 3000; i += 2) { ASSERT_EQUAL(oht.get("k" + std::to_string(i)), i); } return oht.get_skipped_comparisons() > 0; }, "Open Addressing Hash rehash reuses stored hashes");
+    run_test([](){ OpenAddressingHashTable<int,int,std::hash<int>,ModuloSizing> even(38, 0.99f); OpenAddressingHashTable<int,int,std::hash<int>,PowerOfTwoSizing,TriangularProbing> triangular(64, 0.99f); OpenAddressingHashTable<int,int,std::hash<int>,PrimeTableSizing,LinearProbing> linear(67, 0.99f); for (int i = 0; i < 37; ++i) { even.add(i * 38, i); } for (int i = 0; i < 63; ++i) { triangular.add(i * 64, i); linear.add(i * 67, i); } for (int i = 0; i < 37; ++i) { ASSERT_EQUAL(even.get(i * 38), i); } for (int i = 0; i < 63; ++i) { ASSERT_EQUAL(triangular.get(i * 64), i); ASSERT_EQUAL(linear.get(i * 67), i); } ASSERT_EQUAL(even.get_rehashes() + triangular.get_rehashes() + linear.get_rehashes(), 0); long long before = even.get_comparisons(); ASSERT_EQUAL(even.contains(-38), false); ASSERT_EQUAL(even.get_comparisons() - before <= 39, true); for (int i = 0; i < 36; ++i) even.remove(i * 38); for (int i = 100; i < 136; ++i) even.add(i * 38, i); for (int i = 100; i < 136; ++i) { ASSERT_EQUAL(even.get(i * 38), i); } return even.size() == 37 && even.get(36 * 38) == 36; }, "Open Addressing probe sequences cover the table");
+    run_test([](){ OpenAddressingHashTable<int,int> oht(1031); std::map<int,int> m; for (int i = 0; i < 500; ++i) { oht.add(i, i); m[i] = i; } double worst_ratio = 0; for (int i = 500; i < 40000; ++i) { oht.remove(i - 500); m.erase(i - 500); oht.add(i, i); m[i] = i; worst_ratio = std::max(worst_ratio, oht.get_tombstone_ratio()); ASSERT_EQUAL(oht.size(), m.size()); } for (const auto& p : m) { ASSERT_EQUAL(oht.get(p.first), p.second); } ASSERT_EQUAL(oht.contains(100), false); ASSERT_EQUAL(worst_ratio < 0.75, true); return oht.get_purges() > 10 && oht.get_rehashes() - oht.get_purges() <= 2; }, "Open Addressing Hash purges tombstones under churn");
+    run_test([](){ auto churn = [](auto& oht) { std::map<std::string,int> m; long long last_collisions = 0; for (int i = 0; i < 20000; ++i) { oht.add("k" + std::to_string(i), i); m["k" + std::to_string(i)] = i; if (i >= 300) { oht.remove("k" + std::to_string(i - 300)); m.erase("k" + std::to_string(i - 300)); } if (oht.get_collisions() < last_collisions) return false; last_collisions = oht.get_collisions(); } for (const auto& p : m) { if (oht.get(p.first) != p.second) return false; } return oht.size() == m.size() && !oht.contains("k0") && oht.get_purges() > 10 && last_collisions > 0; }; OpenAddressingHashTable<std::string,int> aos(1031); OpenAddressingHashTable<std::string,int,std::hash<std::string>,PowerOfTwoSizing,TriangularProbing,SplitSlots> soa(1024); OpenAddressingHashTable<std::string,int,std::hash<std::string>,PrimeTableSizing,LinearProbing> linear(1031); return churn(aos) && churn(soa) && churn(linear); }, "Open Addressing Hash in-place purge keeps entries and metrics");
+    run_test([](){ OpenAddressingHashTable<std::string,int,std::hash<std::string>,PrimeTableSizing,DoubleHashProbing,SplitSlots> oht(7); oht.enable_incremental_rehash(4); std::map<std::string,int> m; std::mt19937 gen(31); for (int i = 0; i < 30000; ++i) { std::string k = "k" + std::to_string(gen() % 5000); if (gen() % 3) { oht.add(k, i); m[k] = i; } else { oht.remove(k); m.erase(k); } ASSERT_EQUAL(oht.contains(k), m.count(k) == 1); } ASSERT_EQUAL(oht.size(), m.size()); for (const auto& p : m) { ASSERT_EQUAL(oht.get(p.first), p.second); } ASSERT_THROWS(oht.get("k5000"), std::out_of_range); std::vector<std::string> keys = oht.get_all_keys_sorted(); oht.clear(); return keys.size() == m.size() && oht.isEmpty() && !oht.contains(keys.front()) && oht.get_rehashes() > 0; }, "Open Addressing Hash split slot layout matches std::map");
+    run_test([](){ ASSERT_THROWS((OpenAddressingHashTable<int,int>(7, 1.5f)), std::out_of_range); ASSERT_THROWS((OpenAddressingHashTable<int,int>(7, 0.0f)), std::out_of_range); OpenAddressingHashTable<int,int,std::hash<int>,ModuloSizing> full(7, 1.0f); std::map<int,int> m; for (int i = 0; i < 100; ++i) { full.add(i, i); m[i] = i; if (i % 3 == 0) { full.remove(i / 2); m.erase(i / 2); } } for (int i = 0; i < 100; ++i) { ASSERT_EQUAL(full.contains(i), m.count(i) == 1); } return full.size() == m.size() && full.get(99) == 99 && full.get_rehashes() > 0; }, "Open Addressing Hash rejects load factors above 1");
+    run_test([](){ OpenAddressingHashTable<int,int> oht(53); oht.enable_incremental_rehash(4); int n = 0; while (!oht.is_rehashing()) { oht.add(n, n); n++; } for (int i = 0; i < 4 && oht.is_rehashing(); ++i) oht.add(1000 + i, i); ASSERT_EQUAL(oht.is_rehashing(), true); size_t before = oht.size(); for (int k = 0; k < n; ++k) { oht.remove(k); ASSERT_EQUAL(oht.contains(k), false); oht.remove(k); ASSERT_EQUAL(oht.size(), before - 1); oht.add(k, -k); ASSERT_EQUAL(oht.get(k), -k); ASSERT_EQUAL(oht.size(), before); } std::vector<int> keys = oht.get_all_keys_sorted(); return keys.size() == oht.size() && std::adjacent_find(keys.begin(), keys.end()) == keys.end(); }, "Open Addressing Hash migrated int keys are not seen twice");
+    run_test([](){ OpenAddressingHashTable<std::string,int> oht(7); oht.enable_incremental_rehash(4); std::map<std::string,int> m; std::mt19937 gen(13); bool saw_rehash = false; for (int i = 0; i < 30000; ++i) { std::string k = "k" + std::to_string(gen() % 6000); if (gen() % 4) { oht.add(k, i); m[k] = i; } saw_rehash = saw_rehash || oht.is_rehashing(); ASSERT_EQUAL(oht.contains(k), m.count(k) == 1); } for (int i = 0; i < 6000; i += 5) { std::string k = "k" + std::to_string(i); oht.remove(k); m.erase(k); } ASSERT_EQUAL(oht.size(), m.size()); for (const auto& p : m) { ASSERT_EQUAL(oht.get(p.first), p.second); } ASSERT_EQUAL(oht.contains("k5"), false); std::vector<std::string> keys = oht.get_all_keys_sorted(); return saw_rehash && keys.size() == m.size(); }, "Open Addressing Hash incremental rehash matches std::map");
 
 }
 
 //==================================================================
 // ESTRUTURA DE BENCHMARK
 //==================================================================
+// --- Contagem dos bytes vivos no heap, ligada apenas durante as medições de pico de memória ---
+// Cada bloco leva um cabeçalho com o tamanho pedido, lido de volta no delete; assim a contagem não
+// depende de extensões do alocador (como malloc_usable_size, só da glibc)
+std::atomic<bool> g_track_heap{false};
+std::atomic<long long> g_heap_live{0};
+std::atomic<long long> g_heap_peak{0};
+constexpr size_t HEAP_HEADER = alignof(std::max_align_t); // mantém o bloco devolvido alinhado como o de malloc
+
+void* operator new(size_t size) {
+    char* block = static_cast<char*>(std::malloc(HEAP_HEADER + (size ? size : 1)));
+    if (!block) throw std::bad_alloc();
+    *reinterpret_cast<size_t*>(block) = size;
+    if (g_track_heap.load(std::memory_order_relaxed)) {
+        long long live = g_heap_live += static_cast<long long>(size);
+        long long peak = g_heap_peak.load(std::memory_order_relaxed);
+        while (live > peak && !g_heap_peak.compare_exchange_weak(peak, live)) {}
+    }
+    return block + HEAP_HEADER;
+}
+
+void operator delete(void* p) noexcept {
+    if (!p) return;
+    char* block = static_cast<char*>(p) - HEAP_HEADER;
+    if (g_track_heap.load(std::memory_order_relaxed)) g_heap_live -= static_cast<long long>(*reinterpret_cast<size_t*>(block));
+    std::free(block);
+}
+
+void operator delete(void* p, size_t) noexcept { operator delete(p); }
+
 struct BenchmarkResults {
     long long insert_time_ms = 0;
     long long search_time_ms = 0;
@@ -196,6 +343,1042 @@ BenchmarkResults benchmark_open_hash(const std::vector<std::string>& data) {
     return results;
 }
 
+// --- Mede o tempo (ms) de uma função ---
+template <typename Fn>
+double time_ms(Fn&& fn) {
+    auto start = std::chrono::high_resolution_clock::now();
+    fn();
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+// --- Conta as falhas de cache (contador de hardware do Linux) durante uma função; -1 se o contador não estiver disponível ---
+template <typename Fn>
+long long count_cache_misses(Fn&& fn) {
+#ifdef __linux__
+    perf_event_attr attr{};
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = PERF_COUNT_HW_CACHE_MISSES;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    int fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+    if (fd >= 0) {
+        ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+        fn();
+        ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+        long long misses = 0;
+        bool ok = read(fd, &misses, sizeof(misses)) == static_cast<ssize_t>(sizeof(misses));
+        close(fd);
+        return ok ? misses : -1;
+    }
+#endif
+    fn();
+    return -1;
+}
+
+// --- Benchmark: ingestão com snapshots persistentes lidos por outra thread ---
+void benchmark_persistent_snapshots(const std::vector<std::string>& data) {
+    const size_t SNAPSHOT_INTERVAL = 1000;
+
+    AVL<std::string, int> avl;
+    double avl_ms = time_ms([&]() { for (const auto& val : data) avl.add(val, 1); });
+
+    PersistentAVL<std::string, int> plain;
+    double plain_ms = time_ms([&]() { for (const auto& val : data) plain.add(val, 1); });
+
+    // Uma thread de relatório percorre o snapshot mais recente sem bloquear a árvore;
+    // o mutex protege apenas a troca do snapshot publicado.
+    PersistentAVL<std::string, int> persistent;
+    std::mutex handoff;
+    AVLSnapshot<std::string, int> published;
+    std::atomic<bool> done{false};
+    std::atomic<long long> walks{0};
+
+    std::thread reporter([&]() {
+        while (!done.load()) {
+            AVLSnapshot<std::string, int> snap;
+            {
+                std::lock_guard<std::mutex> lock(handoff);
+                snap = published;
+            }
+            snap.get_all_keys_sorted();
+            walks++;
+        }
+    });
+
+    double snap_ms = time_ms([&]() {
+        size_t count = 0;
+        for (const auto& val : data) {
+            persistent.add(val, 1);
+            if (++count % SNAPSHOT_INTERVAL == 0) {
+                AVLSnapshot<std::string, int> snap = persistent.snapshot();
+                std::lock_guard<std::mutex> lock(handoff);
+                published = std::move(snap);
+            }
+        }
+    });
+    done = true;
+    reporter.join();
+
+    std::cout << "\n--- AVL persistente: ingestão com snapshot a cada " << SNAPSHOT_INTERVAL << " insercoes ---\n";
+    std::cout << std::left << std::setw(35) << "Variante" << std::setw(20) << "Tempo (ms)" << "Nos copiados" << std::endl;
+    std::cout << std::setw(35) << "AVL" << std::setw(20) << avl_ms << "-" << std::endl;
+    std::cout << std::setw(35) << "PersistentAVL (sem snapshots)" << std::setw(20) << plain_ms << plain.get_copies() << std::endl;
+    std::cout << std::setw(35) << "PersistentAVL (com snapshots)" << std::setw(20) << snap_ms << persistent.get_copies() << std::endl;
+    std::cout << "Percursos completos feitos pela thread de relatorio: " << walks.load() << std::endl;
+}
+
+// --- Benchmark: comparação em três vias vs. operadores < e > nas árvores ---
+// get_comparisons() conta nós visitados, uma chamada à política por nó. As políticas abaixo contam as
+// comparações de chaves feitas de fato: LessThanCompare faz a segunda (>) sempre que a chave não é menor.
+struct KeyComparisons {
+    static long long count;
+};
+long long KeyComparisons::count = 0;
+
+template <typename Key>
+struct CountedLessThanCompare {
+    int operator()(const Key& a, const Key& b) const {
+        KeyComparisons::count++;
+        if (a < b) return -1;
+        KeyComparisons::count++;
+        if (a > b) return 1;
+        return 0;
+    }
+};
+
+template <typename Key>
+struct CountedThreeWayCompare {
+    int operator()(const Key& a, const Key& b) const { KeyComparisons::count++; return ThreeWayCompare<Key>{}(a, b); }
+};
+
+template <typename Tree, typename KeyType>
+void run_compare_policy(const std::string& name, const std::vector<KeyType>& keys) {
+    Tree tree;
+    KeyComparisons::count = 0;
+    double insert_ms = time_ms([&]() { for (const auto& k : keys) tree.add(k, 1); });
+    long long insert_cmp = KeyComparisons::count;
+    double search_ms = time_ms([&]() { for (const auto& k : keys) tree.get(k); });
+    std::cout << std::left << std::setw(40) << name
+              << std::setw(20) << insert_ms
+              << std::setw(20) << search_ms
+              << std::setw(20) << insert_cmp
+              << KeyComparisons::count - insert_cmp << std::endl;
+}
+
+void benchmark_three_way_compare(const std::vector<std::string>& data) {
+    std::vector<lexicalStr> lexical_data(data.begin(), data.end());
+
+    std::cout << "\n--- Arvores: comparacao em tres vias (ThreeWayCompare) vs. < e > (LessThanCompare) ---\n";
+    std::cout << std::left << std::setw(40) << "Estrutura / chave / politica"
+              << std::setw(20) << "Insercao (ms)"
+              << std::setw(20) << "Busca (ms)"
+              << std::setw(20) << "Comp. chaves (Ins.)"
+              << "Comp. chaves (Busca)" << std::endl;
+
+    run_compare_policy<AVL<std::string, int, CountedLessThanCompare<std::string>>>("AVL / string / < e >", data);
+    run_compare_policy<AVL<std::string, int, CountedThreeWayCompare<std::string>>>("AVL / string / tres vias", data);
+    run_compare_policy<AVL<lexicalStr, int, CountedLessThanCompare<lexicalStr>>>("AVL / lexicalStr / < e >", lexical_data);
+    run_compare_policy<AVL<lexicalStr, int, CountedThreeWayCompare<lexicalStr>>>("AVL / lexicalStr / tres vias", lexical_data);
+    run_compare_policy<RB<std::string, int, CountedLessThanCompare<std::string>>>("RB / string / < e >", data);
+    run_compare_policy<RB<std::string, int, CountedThreeWayCompare<std::string>>>("RB / string / tres vias", data);
+    run_compare_policy<RB<lexicalStr, int, CountedLessThanCompare<lexicalStr>>>("RB / lexicalStr / < e >", lexical_data);
+    run_compare_policy<RB<lexicalStr, int, CountedThreeWayCompare<lexicalStr>>>("RB / lexicalStr / tres vias", lexical_data);
+}
+
+// --- Benchmark: vazão de consultas na árvore de ponteiros vs. layout congelado ---
+template <typename Dict, typename KeyType>
+double queries_per_second(const Dict& dict, const std::vector<KeyType>& queries) {
+    size_t found = 0;
+    double ms = time_ms([&]() { for (const auto& q : queries) found += dict.contains(q); });
+    if (found != queries.size()) std::cerr << "  -> consulta nao encontrada no benchmark de freeze" << std::endl;
+    return queries.size() / (ms / 1000.0);
+}
+
+void benchmark_frozen_layout(const std::vector<std::string>& data) {
+    std::vector<std::string> queries = data;
+    std::shuffle(queries.begin(), queries.end(), std::mt19937(42));
+    std::vector<int> int_queries(queries.size());
+    std::iota(int_queries.begin(), int_queries.end(), 0);
+    std::shuffle(int_queries.begin(), int_queries.end(), std::mt19937(7));
+
+    AVL<std::string, int> avl;
+    RB<std::string, int> rb;
+    AVL<int, int> avl_int;
+    RB<int, int> rb_int;
+    for (size_t i = 0; i < data.size(); ++i) {
+        avl.add(data[i], 1);
+        rb.add(data[i], 1);
+        avl_int.add(static_cast<int>(i), 1);
+        rb_int.add(static_cast<int>(i), 1);
+    }
+
+    std::cout << "\n--- Consultas: arvore de ponteiros vs. freeze() (layout de Eytzinger) ---\n";
+    std::cout << std::left << std::setw(30) << "Estrutura" << std::setw(25) << "Ponteiros (consultas/s)" << "Congelada (consultas/s)" << std::endl;
+    std::cout << std::setw(30) << "AVL / string" << std::setw(25) << queries_per_second(avl, queries) << queries_per_second(avl.freeze(), queries) << std::endl;
+    std::cout << std::setw(30) << "RB / string" << std::setw(25) << queries_per_second(rb, queries) << queries_per_second(rb.freeze(), queries) << std::endl;
+    std::cout << std::setw(30) << "AVL / int" << std::setw(25) << queries_per_second(avl_int, int_queries) << queries_per_second(avl_int.freeze(), int_queries) << std::endl;
+    std::cout << std::setw(30) << "RB / int" << std::setw(25) << queries_per_second(rb_int, int_queries) << queries_per_second(rb_int.freeze(), int_queries) << std::endl;
+}
+
+// --- Benchmark: nó RB compacto (cor no ponteiro para o pai, alocado em blocos) ---
+// Réplica do nó anterior, apenas para comparar o tamanho: cor em campo próprio e altura não utilizada.
+struct LegacyRBNode {
+    std::pair<int, int> data;
+    Color color;
+    LegacyRBNode* left;
+    LegacyRBNode* right;
+    LegacyRBNode* parent;
+    int height;
+};
+
+void benchmark_rb_compact_nodes(size_t num_keys) {
+    std::vector<int> keys(num_keys);
+    std::iota(keys.begin(), keys.end(), 0);
+    std::shuffle(keys.begin(), keys.end(), std::mt19937(11));
+
+    std::cout << "\n--- RB compacta: " << num_keys << " chaves int ---\n";
+    std::cout << "Bytes por no: anterior " << sizeof(LegacyRBNode) << " (+ cabecalho do malloc), atual " << sizeof(RBNode<int, int>) << " (em blocos)" << std::endl;
+
+    std::unique_ptr<RB<int, int>> rb(new RB<int, int>());
+    double insert_ms = time_ms([&]() { for (int k : keys) rb->add(k, k); });
+    std::shuffle(keys.begin(), keys.end(), std::mt19937(12));
+    size_t found = 0;
+    double search_ms = time_ms([&]() { for (int k : keys) found += rb->contains(k); });
+    if (found != keys.size()) std::cerr << "  -> consulta nao encontrada no benchmark da RB compacta" << std::endl;
+    double destroy_ms = time_ms([&]() { rb.reset(); });
+
+    std::cout << std::left << std::setw(30) << "Insercoes (ms)" << insert_ms << std::endl;
+    std::cout << std::setw(30) << "Descidas (consultas/s)" << keys.size() / (search_ms / 1000.0) << std::endl;
+    std::cout << std::setw(30) << "Destruicao (ms)" << destroy_ms << std::endl;
+}
+
+// --- Gera um fluxo de palavras com distribuição de Zipf (expoente s) sobre um vocabulário aleatório ---
+std::vector<std::string> generate_random_string_vocabulary(size_t vocabulary, unsigned seed);
+
+std::vector<std::string> generate_zipf_stream(size_t vocabulary, size_t tokens, double s, unsigned seed) {
+    std::vector<std::string> words = generate_random_string_vocabulary(vocabulary, seed);
+    std::vector<double> weights(vocabulary);
+    for (size_t r = 0; r < vocabulary; ++r) weights[r] = 1.0 / std::pow(static_cast<double>(r + 1), s);
+
+    std::mt19937 gen(seed);
+    std::discrete_distribution<size_t> rank(weights.begin(), weights.end());
+    std::vector<std::string> stream;
+    stream.reserve(tokens);
+    for (size_t i = 0; i < tokens; ++i) stream.push_back(words[rank(gen)]);
+    return stream;
+}
+
+// --- Conta frequências como ReadTxt::processFile (contains + get + add por palavra) ---
+template <typename KeyType>
+void count_like_readtxt(IDictionary<KeyType, size_t>& dict, const std::vector<KeyType>& tokens) {
+    for (const auto& key : tokens) {
+        if (dict.contains(key)) {
+            dict.add(key, dict.get(key) + 1);
+        } else {
+            dict.add(key, 1);
+        }
+    }
+}
+
+// --- Benchmark: cache de chaves frequentes nas árvores sob distribuição de Zipf ---
+template <typename Tree>
+void run_front_cache(const std::string& name, const std::vector<lexicalStr>& tokens, const std::string& corpus) {
+    Tree plain;
+    Tree cached;
+    cached.enable_front_cache(1024);
+    double plain_ms;
+    double cached_ms;
+
+    if (corpus.empty()) {
+        plain_ms = time_ms([&]() { count_like_readtxt(plain, tokens); });
+        cached_ms = time_ms([&]() { count_like_readtxt(cached, tokens); });
+    } else {
+        ReadTxt<lexicalStr> reader;
+        plain_ms = time_ms([&]() { reader.processFile(corpus, plain); });
+        cached_ms = time_ms([&]() { reader.processFile(corpus, cached); });
+    }
+
+    long long accesses = cached.get_cache_hits() + cached.get_cache_misses();
+    double hit_rate = accesses ? 100.0 * cached.get_cache_hits() / accesses : 0.0;
+    std::cout << std::left << std::setw(20) << name
+              << std::setw(20) << plain_ms
+              << std::setw(20) << cached_ms
+              << std::setw(15) << plain_ms / cached_ms
+              << hit_rate << "%" << std::endl;
+}
+
+void benchmark_front_cache(const std::string& corpus) {
+    std::vector<lexicalStr> tokens;
+    if (corpus.empty()) {
+        std::vector<std::string> stream = generate_zipf_stream(20000, 300000, 1.0, 11);
+        tokens.assign(stream.begin(), stream.end());
+    }
+
+    std::cout << "\n--- Cache de chaves frequentes (" << (corpus.empty() ? "fluxo Zipf s=1.0, 300000 palavras" : corpus) << ") ---\n";
+    std::cout << std::left << std::setw(20) << "Estrutura"
+              << std::setw(20) << "Sem cache (ms)"
+              << std::setw(20) << "Com cache (ms)"
+              << std::setw(15) << "Speedup"
+              << "Taxa de acerto" << std::endl;
+    run_front_cache<AVL<lexicalStr, size_t>>("AVL", tokens, corpus);
+    run_front_cache<RB<lexicalStr, size_t>>("RB", tokens, corpus);
+}
+
+// --- Benchmark: inserção de baixo para cima (insertFix) vs. de cima para baixo (divisão de 4-nós) ---
+template <typename Tree>
+void run_insert_policy(const std::string& name, const std::vector<std::string>& keys) {
+    Tree rb;
+    double ms = time_ms([&]() { for (const auto& k : keys) rb.add(k, 1); });
+    std::cout << std::left << std::setw(30) << name
+              << std::setw(15) << ms
+              << std::setw(15) << rb.get_rotations()
+              << rb.get_colors() << std::endl;
+}
+
+void benchmark_rb_insert_policy(const std::vector<std::string>& data) {
+    std::vector<std::string> sorted_keys = data;
+    std::sort(sorted_keys.begin(), sorted_keys.end());
+    std::vector<std::string> zipf_keys = generate_zipf_stream(20000, 300000, 1.0, 5);
+
+    using BottomUp = RB<std::string, int>;
+    using TopDown = RB<std::string, int, ThreeWayCompare<std::string>, TopDownInsert>;
+
+    std::cout << "\n--- RB: insercao de baixo para cima vs. de cima para baixo ---\n";
+    std::cout << std::left << std::setw(30) << "Ordem / politica" << std::setw(15) << "Tempo (ms)" << std::setw(15) << "Rotacoes" << "Trocas de cor" << std::endl;
+    run_insert_policy<BottomUp>("Aleatoria / baixo-cima", data);
+    run_insert_policy<TopDown>("Aleatoria / cima-baixo", data);
+    run_insert_policy<BottomUp>("Ordenada / baixo-cima", sorted_keys);
+    run_insert_policy<TopDown>("Ordenada / cima-baixo", sorted_keys);
+    run_insert_policy<BottomUp>("Zipf / baixo-cima", zipf_keys);
+    run_insert_policy<TopDown>("Zipf / cima-baixo", zipf_keys);
+}
+
+// --- Benchmark: carga de chaves já ordenadas (atalho pelo maior nó e add_hint) ---
+template <typename Tree>
+void run_sorted_load(const std::string& name, const std::vector<std::string>& keys, bool hinted) {
+    Tree tree;
+    double ms;
+    if constexpr (std::is_same<Tree, RB<std::string, int>>::value) {
+        ms = time_ms([&]() { for (const auto& k : keys) { if (hinted) tree.add_hint(tree.end(), k, 1); else tree.add(k, 1); } });
+    } else {
+        ms = time_ms([&]() { for (const auto& k : keys) tree.add(k, 1); });
+    }
+    std::cout << std::left << std::setw(30) << name
+              << std::setw(15) << ms
+              << static_cast<double>(tree.get_comparisons()) / keys.size() << std::endl;
+}
+
+void benchmark_sorted_load(const std::vector<std::string>& data) {
+    std::vector<std::string> sorted_keys = data;
+    std::sort(sorted_keys.begin(), sorted_keys.end());
+
+    std::cout << "\n--- Carga de " << data.size() << " chaves: ordem aleatoria vs. ja ordenadas ---\n";
+    std::cout << std::left << std::setw(30) << "Estrutura / ordem" << std::setw(15) << "Tempo (ms)" << "Comparacoes por insercao" << std::endl;
+    run_sorted_load<AVL<std::string, int>>("AVL / aleatoria", data, false);
+    run_sorted_load<AVL<std::string, int>>("AVL / ordenada", sorted_keys, false);
+    run_sorted_load<RB<std::string, int>>("RB / aleatoria", data, false);
+    run_sorted_load<RB<std::string, int>>("RB / ordenada", sorted_keys, false);
+    run_sorted_load<RB<std::string, int>>("RB / ordenada / add_hint", sorted_keys, true);
+
+    std::cout << "RB com chaves int ordenadas (ns por insercao):";
+    for (int n : {100000, 1000000}) {
+        RB<int, int> rb;
+        double ms = time_ms([&]() { for (int i = 0; i < n; ++i) rb.add(i, i); });
+        std::cout << "  n=" << n << ": " << ms * 1e6 / n;
+    }
+    std::cout << std::endl;
+}
+
+// --- Benchmark: custo por incremento do índice de frequências (top-k) ---
+template <typename Dict>
+double increment_ns(Dict& dict, const std::vector<lexicalStr>& tokens) {
+    return time_ms([&]() { count_like_readtxt(dict, tokens); }) * 1e6 / tokens.size();
+}
+
+void benchmark_top_k() {
+    std::vector<std::string> stream = generate_zipf_stream(20000, 300000, 1.0, 13);
+    std::vector<lexicalStr> tokens(stream.begin(), stream.end());
+    const size_t K = 100;
+
+    std::cout << "\n--- Indice de frequencias: " << tokens.size() << " palavras (Zipf s=1.0), top " << K << " ---\n";
+    std::cout << std::left << std::setw(20) << "Estrutura" << std::setw(22) << "Sem indice (ns/inc)"
+              << std::setw(22) << "Com indice (ns/inc)" << std::setw(22) << "top_k (us)" << "Varredura + sort (us)" << std::endl;
+
+    auto run = [&](const std::string& name, std::unique_ptr<IDictionary<lexicalStr, size_t>> plain, std::unique_ptr<IDictionary<lexicalStr, size_t>> inner) {
+        RankedDictionary<lexicalStr, size_t> ranked(std::move(inner));
+        double plain_ns = increment_ns(*plain, tokens);
+        double ranked_ns = increment_ns(ranked, tokens);
+
+        std::vector<std::pair<lexicalStr, size_t>> top;
+        double top_us = time_ms([&]() { top = ranked.top_k(K); }) * 1000;
+        double scan_us = time_ms([&]() {
+            std::vector<std::pair<lexicalStr, size_t>> all;
+            for (const auto& key : plain->get_all_keys_sorted()) all.emplace_back(key, plain->get(key));
+            std::partial_sort(all.begin(), all.begin() + std::min(K, all.size()), all.end(),
+                              [](const auto& a, const auto& b) { return a.second > b.second; });
+        }) * 1000;
+
+        std::cout << std::setw(20) << name << std::setw(22) << plain_ns << std::setw(22) << ranked_ns
+                  << std::setw(22) << top_us << scan_us << std::endl;
+    };
+
+    run("RB", std::make_unique<RB<lexicalStr, size_t>>(), std::make_unique<RB<lexicalStr, size_t>>());
+    run("Chained Hash", std::make_unique<ChainedHashTable<lexicalStr, size_t>>(), std::make_unique<ChainedHashTable<lexicalStr, size_t>>());
+}
+
+// --- Benchmark: encadeamento em std::list x arena contígua, com o fator de carga fixado ---
+template <typename Table>
+void run_chained_layout(const std::string& name, float lf, const std::vector<std::string>& data, const std::vector<std::string>& misses) {
+    std::unique_ptr<Table> ht(new Table(static_cast<size_t>(data.size() / lf), lf));
+    double insert_ms = time_ms([&]() { for (const auto& val : data) ht->add(val, 1); });
+    long long before = ht->get_comparisons();
+    size_t found = 0;
+    double hit_ms = time_ms([&]() { for (const auto& val : data) found += ht->contains(val); });
+    double comparisons = static_cast<double>(ht->get_comparisons() - before) / data.size();
+    double miss_ms = time_ms([&]() { for (const auto& val : misses) found += ht->contains(val); });
+    double destroy_ms = time_ms([&]() { ht.reset(); });
+    if (found != data.size()) std::cerr << "  -> consulta incorreta no benchmark de encadeamento" << std::endl;
+
+    std::cout << std::left << std::setw(8) << lf << std::setw(14) << name
+              << std::setw(16) << insert_ms * 1e6 / data.size() << std::setw(16) << hit_ms * 1e6 / data.size()
+              << std::setw(16) << miss_ms * 1e6 / misses.size() << std::setw(16) << comparisons << destroy_ms << std::endl;
+}
+
+void benchmark_flat_chaining(const std::vector<std::string>& data) {
+    std::vector<std::string> misses;
+    misses.reserve(data.size());
+    for (const auto& val : data) misses.push_back(val + "#");
+
+    std::cout << "\n--- Encadeamento: std::list x arena (" << data.size() << " chaves) ---\n";
+    std::cout << "Bytes por no: lista " << ChainedHashTable<std::string, int>().get_node_bytes() << " (+ cabecalho do malloc), arena "
+              << FlatChainedHashTable<std::string, int>().get_node_bytes() << std::endl;
+    std::cout << std::left << std::setw(8) << "Carga" << std::setw(14) << "Estrutura" << std::setw(16) << "Insercao (ns)"
+              << std::setw(16) << "Acerto (ns)" << std::setw(16) << "Falha (ns)" << std::setw(16) << "Comp./acerto" << "Destruicao (ms)" << std::endl;
+    for (float lf : {0.5f, 1.0f, 2.0f, 4.0f}) {
+        run_chained_layout<ChainedHashTable<std::string, int>>("std::list", lf, data, misses);
+        run_chained_layout<FlatChainedHashTable<std::string, int>>("arena", lf, data, misses);
+    }
+}
+
+// --- Benchmark: slots arborizados com chaves que colidem (pior caso de busca O(n) x O(log n)) ---
+void benchmark_treeified_buckets() {
+    std::cout << "\n--- Slots arborizados: anagramas sob hash por soma de bytes (todas as chaves no mesmo slot) ---\n";
+    std::cout << std::left << std::setw(10) << "Chaves" << std::setw(12) << "Slot" << std::setw(16) << "Insercao (ms)"
+              << std::setw(16) << "Busca (ns)" << "Comp./busca" << std::endl;
+    for (size_t n : {64, 512, 4096, 8192}) {
+        std::vector<std::string> keys = generate_colliding_keys(n);
+        std::vector<std::string> lookups;
+        for (size_t i = 0; i < keys.size(); i += std::max<size_t>(1, keys.size() / 2000)) lookups.push_back(keys[i]);
+        for (bool tree : {false, true}) {
+            ChainedHashTable<std::string, int, ByteSumHash> ht;
+            if (!tree) ht.set_treeify_threshold(0);
+            double insert_ms = time_ms([&]() { for (const auto& k : keys) ht.add(k, 1); });
+            long long before = ht.get_comparisons();
+            size_t found = 0;
+            double lookup_ms = time_ms([&]() { for (const auto& k : lookups) found += ht.contains(k); });
+            if (found != lookups.size()) std::cerr << "  -> consulta incorreta no benchmark de slots arborizados" << std::endl;
+            std::cout << std::left << std::setw(10) << n << std::setw(12) << (tree ? "arvore" : "lista") << std::setw(16) << insert_ms
+                      << std::setw(16) << lookup_ms * 1e6 / lookups.size()
+                      << static_cast<double>(ht.get_comparisons() - before) / lookups.size() << std::endl;
+        }
+    }
+}
+
+// --- Benchmark: Robin Hood x duplo hash com tombstones (comprimento de sondagem e vazão por carga) ---
+template <typename Table>
+void run_probe_lengths(const std::string& name, float load, Table& table, const std::vector<std::string>& keys,
+                       const std::vector<std::string>& misses, const std::vector<std::string>& churn, int name_width = 16) {
+    double insert_ms = time_ms([&]() { for (const auto& k : keys) table.add(k, 1); });
+
+    long long longest = 0;
+    long long before = table.get_comparisons();
+    for (const auto& k : keys) {
+        long long start = table.get_comparisons();
+        table.get(k);
+        longest = std::max(longest, table.get_comparisons() - start);
+    }
+    double mean_hit = static_cast<double>(table.get_comparisons() - before) / keys.size();
+
+    size_t found = 0;
+    double hit_ms = time_ms([&]() { for (const auto& k : keys) found += table.contains(k); });
+    if (found != keys.size()) std::cerr << "  -> consulta incorreta no benchmark de Robin Hood" << std::endl;
+
+    before = table.get_comparisons();
+    for (const auto& k : misses) table.contains(k);
+    double mean_miss = static_cast<double>(table.get_comparisons() - before) / misses.size();
+
+    // Rotatividade: remove uma chave antiga e insere uma nova, com a carga constante
+    for (size_t i = 0; i < churn.size(); ++i) {
+        table.remove(keys[i]);
+        table.add(churn[i], 1);
+    }
+    before = table.get_comparisons();
+    for (const auto& k : misses) table.contains(k);
+    double mean_churn_miss = static_cast<double>(table.get_comparisons() - before) / misses.size();
+
+    std::cout << std::left << std::setw(8) << load << std::setw(name_width) << name << std::setw(16) << keys.size() / (insert_ms * 1e3)
+              << std::setw(16) << keys.size() / (hit_ms * 1e3) << std::setw(14) << mean_hit << std::setw(12) << longest
+              << std::setw(14) << mean_miss << mean_churn_miss << std::endl;
+}
+
+void benchmark_robin_hood() {
+    const size_t PRIME_CAPACITY = 131071;      // 2^17 - 1; a politica padrao do duplo hash (tabela de primos) usa 131101 slots
+    const size_t POWER_CAPACITY = size_t(1) << 17;
+
+    std::cout << "\n--- Robin Hood (sondagem linear, remocao por deslocamento) x duplo hash com tombstones (" << POWER_CAPACITY << " slots) ---\n";
+    std::cout << std::left << std::setw(8) << "Carga" << std::setw(16) << "Estrutura" << std::setw(16) << "Insercao (M/s)"
+              << std::setw(16) << "Busca (M/s)" << std::setw(14) << "Sond. media" << std::setw(12) << "Sond. max"
+              << std::setw(14) << "Sond. falha" << "Falha apos churn" << std::endl;
+    for (float load : {0.5f, 0.75f, 0.9f, 0.95f}) {
+        size_t n = static_cast<size_t>(load * PRIME_CAPACITY);
+        std::vector<std::string> all = generate_random_string_vocabulary(n + (PRIME_CAPACITY - n) / 2, 71);
+        std::vector<std::string> keys(all.begin(), all.begin() + n);
+        std::vector<std::string> churn(all.begin() + n, all.end()); // rotatividade limitada a metade dos slots vazios: os tombstones do duplo hash ficam abaixo do fator de carga, sem purge
+        std::vector<std::string> misses;
+        for (size_t i = 0; i < keys.size(); i += 4) misses.push_back(keys[i] + "#");
+
+        OpenAddressingHashTable<std::string, int> double_hashing(PRIME_CAPACITY, 0.99f);
+        run_probe_lengths("duplo hash", load, double_hashing, keys, misses, churn);
+        RobinHoodHashTable<std::string, int> robin_hood(POWER_CAPACITY, 0.99f);
+        run_probe_lengths("Robin Hood", load, robin_hood, keys, misses, churn);
+    }
+}
+
+// --- Benchmark: cobertura da sondagem no endereçamento aberto (combinações de tamanho e sondagem em carga alta) ---
+void benchmark_probe_coverage() {
+    const size_t CAPACITY = size_t(1) << 17;
+
+    std::cout << "\n--- Endereçamento aberto: tamanho x sondagem em carga alta (" << CAPACITY << " slots pedidos) ---\n";
+    std::cout << std::left << std::setw(8) << "Carga" << std::setw(30) << "Tamanho / sondagem" << std::setw(16) << "Insercao (M/s)"
+              << std::setw(16) << "Busca (M/s)" << std::setw(14) << "Sond. media" << std::setw(12) << "Sond. max"
+              << std::setw(14) << "Sond. falha" << "Falha apos churn" << std::endl;
+    for (float load : {0.9f, 0.95f}) {
+        size_t n = static_cast<size_t>(load * CAPACITY);
+        std::vector<std::string> all = generate_random_string_vocabulary(n + (CAPACITY - n) / 2, 79);
+        std::vector<std::string> keys(all.begin(), all.begin() + n);
+        std::vector<std::string> churn(all.begin() + n, all.end());
+        std::vector<std::string> misses;
+        for (size_t i = 0; i < keys.size(); i += 4) misses.push_back(keys[i] + "#");
+
+        OpenAddressingHashTable<std::string, int, std::hash<std::string>, ModuloSizing> even(CAPACITY, 0.99f);
+        run_probe_lengths("modulo (par) / duplo hash", load, even, keys, misses, churn, 30);
+        OpenAddressingHashTable<std::string, int, std::hash<std::string>, PrimeTableSizing> primes(CAPACITY, 0.99f);
+        run_probe_lengths("primo / duplo hash", load, primes, keys, misses, churn, 30);
+        OpenAddressingHashTable<std::string, int, std::hash<std::string>, PowerOfTwoSizing> odd_step(CAPACITY, 0.99f);
+        run_probe_lengths("potencia de 2 / duplo hash", load, odd_step, keys, misses, churn, 30);
+        OpenAddressingHashTable<std::string, int, std::hash<std::string>, PowerOfTwoSizing, TriangularProbing> triangular(CAPACITY, 0.99f);
+        run_probe_lengths("potencia de 2 / triangular", load, triangular, keys, misses, churn, 30);
+        OpenAddressingHashTable<std::string, int, std::hash<std::string>, PrimeTableSizing, LinearProbing> linear(CAPACITY, 0.99f);
+        run_probe_lengths("primo / linear", load, linear, keys, misses, churn, 30);
+    }
+}
+
+// --- Benchmark: disposição dos slots no endereçamento aberto (vetor de structs x vetores separados) ---
+template <typename Table>
+void run_slot_layout(const std::string& name, float load, Table& table, const std::vector<std::string>& keys, const std::vector<std::string>& misses) {
+    double insert_ms = time_ms([&]() { for (const auto& k : keys) table.add(k, 1); });
+
+    size_t found = 0;
+    double hit_ms = 0;
+    long long hit_cache = count_cache_misses([&]() { hit_ms = time_ms([&]() { for (const auto& k : keys) found += table.contains(k); }); });
+    if (found != keys.size()) std::cerr << "  -> consulta incorreta no benchmark de disposicao dos slots" << std::endl;
+
+    double miss_ms = 0;
+    long long before = table.get_comparisons();
+    long long miss_cache = count_cache_misses([&]() { miss_ms = time_ms([&]() { for (const auto& k : misses) found += table.contains(k); }); });
+    double mean_miss = static_cast<double>(table.get_comparisons() - before) / misses.size();
+
+    auto per_lookup = [](long long cache_misses, size_t lookups) {
+        return cache_misses < 0 ? std::string("n/d") : std::to_string(static_cast<double>(cache_misses) / lookups).substr(0, 5);
+    };
+    std::cout << std::left << std::setw(8) << load << std::setw(22) << name << std::setw(10) << table.get_node_bytes()
+              << std::setw(16) << keys.size() / (insert_ms * 1e3) << std::setw(16) << keys.size() / (hit_ms * 1e3)
+              << std::setw(16) << misses.size() / (miss_ms * 1e3) << std::setw(14) << mean_miss
+              << std::setw(16) << per_lookup(hit_cache, keys.size()) << per_lookup(miss_cache, misses.size()) << std::endl;
+}
+
+void benchmark_slot_layout() {
+    const size_t CAPACITY = size_t(1) << 19;
+
+    std::cout << "\n--- Endereçamento aberto: vetor de structs x vetores separados (" << CAPACITY << " slots pedidos; falhas de cache: n/d sem contador de hardware) ---\n";
+    std::cout << std::left << std::setw(8) << "Carga" << std::setw(22) << "Disposicao" << std::setw(10) << "Bytes" << std::setw(16) << "Insercao (M/s)"
+              << std::setw(16) << "Acerto (M/s)" << std::setw(16) << "Falha (M/s)" << std::setw(14) << "Sond. falha"
+              << std::setw(16) << "Cache/acerto" << "Cache/falha" << std::endl;
+    for (float load : {0.5f, 0.9f}) {
+        size_t n = static_cast<size_t>(load * CAPACITY);
+        std::vector<std::string> keys = generate_random_string_vocabulary(n, 89);
+        std::vector<std::string> misses;
+        for (size_t i = 0; i < keys.size(); i += 2) misses.push_back(keys[i] + "#");
+
+        OpenAddressingHashTable<std::string, int> interleaved(CAPACITY, 0.99f);
+        run_slot_layout("structs (AoS)", load, interleaved, keys, misses);
+        OpenAddressingHashTable<std::string, int, std::hash<std::string>, PrimeTableSizing, DoubleHashProbing, SplitSlots> split(CAPACITY, 0.99f);
+        run_slot_layout("vetores (SoA)", load, split, keys, misses);
+    }
+}
+
+// --- Benchmark: rotatividade (remove + insere) no endereçamento aberto, com os tombstones contando para a carga ---
+void benchmark_tombstone_churn() {
+    const size_t CAPACITY = size_t(1) << 17;
+    const size_t LIVE = 3 * CAPACITY / 8; // a carga 0,75 é atingida quando os tombstones igualam as chaves vivas: purge em vez de dobra
+    const size_t WINDOWS = 8;
+    const size_t OPS_PER_WINDOW = 2 * LIVE;
+
+    // Janela deslizante sobre 2 * LIVE chaves: cada ciclo remove a chave mais antiga e insere a de LIVE posições à frente
+    std::vector<std::string> pool = generate_random_string_vocabulary(2 * LIVE, 83);
+    std::vector<std::string> misses;
+    for (size_t i = 0; i < LIVE; i += 4) misses.push_back(pool[i] + "#");
+
+    OpenAddressingHashTable<std::string, int> table(CAPACITY, 0.75f);
+    for (size_t i = 0; i < LIVE; ++i) table.add(pool[i], 1);
+
+    std::cout << "\n--- Endereçamento aberto: rotatividade com " << LIVE << " chaves vivas (" << OPS_PER_WINDOW << " ciclos remove + insere por janela) ---\n";
+    std::cout << std::left << std::setw(8) << "Janela" << std::setw(16) << "Ciclos (M/s)" << std::setw(14) << "Tombstones"
+              << std::setw(14) << "Sond. falha" << std::setw(10) << "Purges" << std::setw(10) << "Rehashes" << "Heap extra (KiB)" << std::endl;
+    size_t next = 0;
+    for (size_t w = 1; w <= WINDOWS; ++w) {
+        g_heap_live = 0;
+        g_heap_peak = 0;
+        g_track_heap = true;
+        double churn_ms = time_ms([&]() {
+            for (size_t i = 0; i < OPS_PER_WINDOW; ++i, ++next) {
+                table.remove(pool[next % pool.size()]);
+                table.add(pool[(next + LIVE) % pool.size()], 1);
+            }
+        });
+        g_track_heap = false;
+        if (table.size() != LIVE) std::cerr << "  -> tamanho incorreto no benchmark de rotatividade" << std::endl;
+
+        long long before = table.get_comparisons();
+        for (const auto& k : misses) table.contains(k);
+        double mean_miss = static_cast<double>(table.get_comparisons() - before) / misses.size();
+
+        std::cout << std::left << std::setw(8) << w << std::setw(16) << OPS_PER_WINDOW / (churn_ms * 1e3) << std::setw(14) << table.get_tombstone_ratio()
+                  << std::setw(14) << mean_miss << std::setw(10) << table.get_purges() << std::setw(10) << table.get_rehashes() << g_heap_peak / 1024.0 << std::endl;
+    }
+}
+
+// --- Benchmark: SwissTable (grupos de 16 slots com SSE2) x duplo hash x Robin Hood em cargas altas ---
+void benchmark_swiss_table() {
+    const size_t PRIME_CAPACITY = 131071;
+    const size_t POWER_CAPACITY = size_t(1) << 17;
+
+    std::cout << "\n--- SwissTable (grupos de 16 slots) x duplo hash x Robin Hood (" << POWER_CAPACITY << " slots; SwissTable: comparacoes = grupos + impressoes digitais iguais) ---\n";
+    std::cout << std::left << std::setw(8) << "Carga" << std::setw(16) << "Estrutura" << std::setw(16) << "Insercao (M/s)"
+              << std::setw(16) << "Busca (M/s)" << std::setw(14) << "Sond. media" << std::setw(12) << "Sond. max"
+              << std::setw(14) << "Sond. falha" << "Falha apos churn" << std::endl;
+    for (float load : {0.75f, 0.875f}) {
+        size_t n = static_cast<size_t>(load * PRIME_CAPACITY);
+        std::vector<std::string> all = generate_random_string_vocabulary(n + (PRIME_CAPACITY - n) / 2, 73);
+        std::vector<std::string> keys(all.begin(), all.begin() + n);
+        std::vector<std::string> churn(all.begin() + n, all.end());
+        std::vector<std::string> misses;
+        for (size_t i = 0; i < keys.size(); i += 4) misses.push_back(keys[i] + "#");
+
+        OpenAddressingHashTable<std::string, int> double_hashing(PRIME_CAPACITY, 0.99f);
+        run_probe_lengths("duplo hash", load, double_hashing, keys, misses, churn);
+        RobinHoodHashTable<std::string, int> robin_hood(POWER_CAPACITY, 0.99f);
+        run_probe_lengths("Robin Hood", load, robin_hood, keys, misses, churn);
+        SwissHashTable<std::string, int> swiss(POWER_CAPACITY, 0.99f);
+        run_probe_lengths("SwissTable", load, swiss, keys, misses, churn);
+    }
+}
+
+// --- Benchmark: hash completo guardado em cada entrada (comparações evitadas e custo do rehash) ---
+template <typename Table>
+void run_stored_hash(const std::string& name, const std::vector<std::string>& vocabulary) {
+    std::unique_ptr<Table> presized(new Table(vocabulary.size() * 2));
+    double presized_ms = time_ms([&]() { for (const auto& w : vocabulary) presized->add(w, 1); });
+
+    Table growing;
+    CountingHash::calls = 0;
+    double growing_ms = time_ms([&]() { for (const auto& w : vocabulary) growing.add(w, 1); });
+    long long hash_calls = CountingHash::calls;
+
+    long long comparisons_before = growing.get_comparisons();
+    long long skipped_before = growing.get_skipped_comparisons();
+    size_t found = 0;
+    double hit_ms = time_ms([&]() { for (const auto& w : vocabulary) found += growing.contains(w); });
+    if (found != vocabulary.size()) std::cerr << "  -> consulta incorreta no benchmark de hash guardado" << std::endl;
+
+    long long visited = growing.get_comparisons() - comparisons_before;
+    long long skipped = growing.get_skipped_comparisons() - skipped_before;
+    std::cout << std::left << std::setw(24) << name << std::setw(18) << hash_calls
+              << std::setw(18) << growing_ms - presized_ms << std::setw(18) << hit_ms * 1e6 / vocabulary.size()
+              << std::setw(22) << visited << skipped << std::endl;
+}
+
+void benchmark_stored_hash(size_t vocabulary_size) {
+    std::vector<std::string> vocabulary = generate_random_string_vocabulary(vocabulary_size, 37);
+
+    std::cout << "\n--- Hash guardado nas entradas (" << vocabulary.size() << " palavras distintas) ---\n";
+    std::cout << "Rehash (ms) = insercao partindo de 19 slots - insercao com a tabela ja dimensionada\n";
+    std::cout << std::left << std::setw(24) << "Estrutura" << std::setw(18) << "Chamadas de hash" << std::setw(18) << "Rehash (ms)"
+              << std::setw(18) << "Acerto (ns)" << std::setw(22) << "Entradas visitadas" << "Comparacoes evitadas" << std::endl;
+    run_stored_hash<ChainedHashTable<std::string, int, CountingHash>>("Chained Hash Table", vocabulary);
+    run_stored_hash<FlatChainedHashTable<std::string, int, CountingHash>>("Flat Chained Hash", vocabulary);
+    run_stored_hash<OpenAddressingHashTable<std::string, int, CountingHash>>("Open Addressing Hash", vocabulary);
+}
+
+// --- Benchmark: pico de memória do heap durante a ingestão com rehash (relativo à tabela final) ---
+template <typename Table>
+void run_rehash_memory(const std::string& name, const std::vector<std::string>& vocabulary) {
+    std::unique_ptr<Table> presized(new Table(vocabulary.size() * 2));
+    double presized_ms = time_ms([&]() { for (const auto& w : vocabulary) presized->add(w, 1); });
+    presized.reset();
+
+    g_heap_live = 0;
+    g_heap_peak = 0;
+    g_track_heap = true;
+    std::unique_ptr<Table> growing(new Table());
+    double growing_ms = time_ms([&]() { for (const auto& w : vocabulary) growing->add(w, 1); });
+    g_track_heap = false;
+    long long final_bytes = g_heap_live;
+    long long peak_bytes = g_heap_peak;
+
+    std::cout << std::left << std::setw(24) << name << std::setw(16) << final_bytes / (1024.0 * 1024.0)
+              << std::setw(16) << peak_bytes / (1024.0 * 1024.0) << std::setw(16) << static_cast<double>(peak_bytes) / final_bytes
+              << growing_ms - presized_ms << std::endl;
+}
+
+void benchmark_rehash_memory(size_t vocabulary_size) {
+    std::vector<std::string> vocabulary = generate_random_string_vocabulary(vocabulary_size, 41);
+
+    std::cout << "\n--- Pico de memoria durante o rehash (" << vocabulary.size() << " palavras distintas, partindo de 19 slots) ---\n";
+    std::cout << std::left << std::setw(24) << "Estrutura" << std::setw(16) << "Final (MiB)" << std::setw(16) << "Pico (MiB)"
+              << std::setw(16) << "Pico/final" << "Rehash (ms)" << std::endl;
+    run_rehash_memory<ChainedHashTable<std::string, int>>("Chained Hash Table", vocabulary);
+    run_rehash_memory<FlatChainedHashTable<std::string, int>>("Flat Chained Hash", vocabulary);
+    run_rehash_memory<OpenAddressingHashTable<std::string, int>>("Open Addressing Hash", vocabulary);
+}
+
+// --- Benchmark: latência de cauda das inserções com rehash de uma vez x rehash incremental ---
+template <typename Table>
+void run_insert_latency(const std::string& name, size_t step, const std::vector<std::string>& vocabulary) {
+    Table table;
+    if (step > 0) table.enable_incremental_rehash(step);
+
+    std::vector<double> latency_us;
+    latency_us.reserve(vocabulary.size());
+    for (const auto& w : vocabulary) {
+        auto start = std::chrono::high_resolution_clock::now();
+        table.add(w, 1);
+        auto end = std::chrono::high_resolution_clock::now();
+        latency_us.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+    }
+    double total_ms = std::accumulate(latency_us.begin(), latency_us.end(), 0.0) / 1000.0;
+    std::sort(latency_us.begin(), latency_us.end());
+    auto percentile = [&](double p) { return latency_us[static_cast<size_t>(p * (latency_us.size() - 1))]; };
+
+    std::cout << std::left << std::setw(24) << name << std::setw(14) << (step > 0 ? "incremental" : "de uma vez")
+              << std::setw(12) << percentile(0.5) << std::setw(12) << percentile(0.99) << std::setw(12) << percentile(0.999)
+              << std::setw(14) << latency_us.back() << total_ms << std::endl;
+}
+
+void benchmark_incremental_rehash(size_t vocabulary_size) {
+    std::vector<std::string> vocabulary = generate_random_string_vocabulary(vocabulary_size, 43);
+
+    std::cout << "\n--- Latencia das insercoes (us) com rehash de uma vez x incremental (" << vocabulary.size() << " palavras, partindo de 19 slots) ---\n";
+    std::cout << std::left << std::setw(24) << "Estrutura" << std::setw(14) << "Rehash" << std::setw(12) << "p50"
+              << std::setw(12) << "p99" << std::setw(12) << "p99.9" << std::setw(14) << "Maximo" << "Total (ms)" << std::endl;
+    run_insert_latency<ChainedHashTable<std::string, int>>("Chained Hash Table", 0, vocabulary);
+    run_insert_latency<ChainedHashTable<std::string, int>>("Chained Hash Table", 8, vocabulary);
+    run_insert_latency<OpenAddressingHashTable<std::string, int>>("Open Addressing Hash", 0, vocabulary);
+    run_insert_latency<OpenAddressingHashTable<std::string, int>>("Open Addressing Hash", 16, vocabulary);
+}
+
+// --- Benchmark: ingestão pelo ReadTxt com e sem o dimensionamento prévio pelo vocabulário estimado ---
+template <typename Dict, typename KeyType>
+void run_presize(const std::string& name, const std::string& path) {
+    ReadTxt<KeyType> reader;
+    Dict growing;
+    Dict presized;
+    double growing_ms = time_ms([&]() { reader.processFile(path, growing, false); });
+    // O mesmo que processFile(path, presized, true), com a estimativa medida à parte da ingestão
+    size_t estimate = 0;
+    double estimate_ms = time_ms([&]() { estimate = reader.estimate_distinct_words(path); });
+    double presized_ms = time_ms([&]() { presized.reserve(estimate); reader.processFile(path, presized, false); });
+    if (growing.size() != presized.size()) std::cerr << "  -> contagem incorreta no benchmark de dimensionamento previo" << std::endl;
+
+    std::cout << std::left << std::setw(24) << name << std::setw(12) << growing.get_rehashes() << std::setw(12) << presized.get_rehashes()
+              << std::setw(14) << growing_ms << std::setw(16) << estimate_ms << std::setw(16) << presized_ms << estimate_ms + presized_ms << std::endl;
+}
+
+void benchmark_presize(const std::string& corpus, size_t vocabulary_size) {
+    std::string path = corpus.empty() ? write_zipf_text("benchmark_presize.txt", vocabulary_size, 4 * vocabulary_size, 47) : corpus;
+
+    ReadTxt<std::string> reader;
+    size_t estimate = 0;
+    double estimate_ms = time_ms([&]() { estimate = reader.estimate_distinct_words(path); });
+    ChainedHashTable<std::string, size_t> exact;
+    reader.processFile(path, exact, false);
+
+    std::cout << "\n--- Dimensionamento previo pelo vocabulario estimado (" << (corpus.empty() ? "texto Zipf s=1.0, " + std::to_string(4 * vocabulary_size) + " palavras" : corpus) << ") ---\n";
+    std::cout << "Palavras distintas: estimadas " << estimate << ", reais " << exact.size() << " (estimativa em " << estimate_ms << " ms)\n";
+    std::cout << std::left << std::setw(24) << "Estrutura" << std::setw(12) << "Rehash sem" << std::setw(12) << "Rehash com"
+              << std::setw(14) << "Sem (ms)" << std::setw(16) << "Estimativa (ms)" << std::setw(16) << "Ingestao (ms)" << "Com, total (ms)" << std::endl;
+    run_presize<ChainedHashTable<std::string, size_t>, std::string>("Chained Hash Table", path);
+    run_presize<FlatChainedHashTable<std::string, size_t>, std::string>("Flat Chained Hash", path);
+    run_presize<OpenAddressingHashTable<std::string, size_t>, std::string>("Open Addressing Hash", path);
+    run_presize<AVL<lexicalStr, size_t>, lexicalStr>("AVL Tree", path);
+    run_presize<RB<lexicalStr, size_t>, lexicalStr>("Red-Black Tree", path);
+
+    if (corpus.empty()) std::remove(path.c_str());
+}
+
+// --- Benchmark: funções de hash de strings (vazão, colisões e ingestão) ---
+template <typename Hash>
+void run_string_hash(const std::string& name, const std::vector<std::string>& vocabulary, const std::vector<std::string>& stream, const std::string& corpus) {
+    Hash hasher;
+    size_t bytes = 0;
+    for (const auto& w : vocabulary) bytes += w.size();
+    const int PASSES = 20;
+    size_t sink = 0;
+    double hash_ms = time_ms([&]() { for (int r = 0; r < PASSES; ++r) for (const auto& w : vocabulary) sink += hasher(w); });
+    if (sink == 1) std::cout << ""; // impede que o laço seja descartado pelo compilador
+
+    ChainedHashTable<std::string, size_t, Hash> chained;
+    OpenAddressingHashTable<std::string, size_t, Hash> open;
+    for (const auto& w : vocabulary) { chained.add(w, 1); open.add(w, 1); }
+
+    ChainedHashTable<std::string, size_t, Hash> chained_ingest;
+    OpenAddressingHashTable<std::string, size_t, Hash> open_ingest;
+    double chained_ms;
+    double open_ms;
+    if (corpus.empty()) {
+        chained_ms = time_ms([&]() { count_like_readtxt(chained_ingest, stream); });
+        open_ms = time_ms([&]() { count_like_readtxt(open_ingest, stream); });
+    } else {
+        ReadTxt<std::string> reader;
+        chained_ms = time_ms([&]() { reader.processFile(corpus, chained_ingest); });
+        open_ms = time_ms([&]() { reader.processFile(corpus, open_ingest); });
+    }
+
+    std::cout << std::left << std::setw(12) << name << std::setw(12) << PASSES * bytes / (hash_ms * 1e6)
+              << std::setw(20) << chained.get_collisions() << std::setw(20) << open.get_collisions()
+              << std::setw(24) << chained_ms << open_ms << std::endl;
+}
+
+void benchmark_string_hash(const std::string& corpus, size_t vocabulary_size) {
+    std::vector<std::string> vocabulary = generate_random_string_vocabulary(vocabulary_size, 59);
+    std::vector<std::string> stream;
+    if (corpus.empty()) stream = generate_zipf_stream(50000, 1000000, 1.0, 61);
+
+    std::cout << "\n--- Funcoes de hash de strings (" << vocabulary.size() << " palavras distintas; ingestao: "
+              << (corpus.empty() ? "fluxo Zipf s=1.0, 1000000 palavras" : corpus) << ") ---\n";
+    std::cout << std::left << std::setw(12) << "Hash" << std::setw(12) << "GB/s" << std::setw(20) << "Colisoes encad."
+              << std::setw(20) << "Colisoes aberta" << std::setw(24) << "Ingestao encad. (ms)" << "Ingestao aberta (ms)" << std::endl;
+    run_string_hash<std::hash<std::string>>("std::hash", vocabulary, stream, corpus);
+    run_string_hash<Fnv1aHash>("FNV-1a", vocabulary, stream, corpus);
+    run_string_hash<WyHash>("wyhash", vocabulary, stream, corpus);
+    run_string_hash<Crc32cHash>("CRC32C", vocabulary, stream, corpus);
+}
+
+// --- Benchmark: custo por consulta das políticas de dimensionamento (redução do hash a um slot) ---
+template <typename Table>
+void run_sizing_policy(const std::string& name, const std::string& policy, const std::vector<std::string>& data, const std::vector<std::string>& misses) {
+    Table ht;
+    double insert_ms = time_ms([&]() { for (const auto& val : data) ht.add(val, 1); });
+    long long before = ht.get_comparisons();
+    size_t found = 0;
+    double hit_ms = time_ms([&]() { for (int r = 0; r < 5; ++r) for (const auto& val : data) found += ht.contains(val); });
+    double comparisons = static_cast<double>(ht.get_comparisons() - before) / (5.0 * data.size());
+    double miss_ms = time_ms([&]() { for (int r = 0; r < 5; ++r) for (const auto& val : misses) found += ht.contains(val); });
+    if (found != 5 * data.size()) std::cerr << "  -> consulta incorreta no benchmark de dimensionamento" << std::endl;
+
+    std::cout << std::left << std::setw(24) << name << std::setw(20) << policy << std::setw(16) << insert_ms * 1e6 / data.size()
+              << std::setw(16) << hit_ms * 1e6 / (5.0 * data.size()) << std::setw(16) << miss_ms * 1e6 / (5.0 * misses.size()) << comparisons << std::endl;
+}
+
+void benchmark_sizing_policy(const std::vector<std::string>& data) {
+    std::vector<std::string> misses;
+    misses.reserve(data.size());
+    for (const auto& val : data) misses.push_back(val + "#");
+
+    std::cout << "\n--- Politicas de dimensionamento (" << data.size() << " chaves, partindo do tamanho padrao) ---\n";
+    std::cout << std::left << std::setw(24) << "Estrutura" << std::setw(20) << "Politica" << std::setw(16) << "Insercao (ns)"
+              << std::setw(16) << "Acerto (ns)" << std::setw(16) << "Falha (ns)" << "Comp./acerto" << std::endl;
+    run_sizing_policy<ChainedHashTable<std::string, int, std::hash<std::string>, TrialDivisionPrimeSizing>>("Chained Hash Table", "primo (divisao)", data, misses);
+    run_sizing_policy<ChainedHashTable<std::string, int, std::hash<std::string>, PrimeTableSizing>>("Chained Hash Table", "tabela de primos", data, misses);
+    run_sizing_policy<ChainedHashTable<std::string, int, std::hash<std::string>, PowerOfTwoSizing>>("Chained Hash Table", "potencia de 2", data, misses);
+    run_sizing_policy<OpenAddressingHashTable<std::string, int, std::hash<std::string>, ModuloSizing>>("Open Addressing Hash", "modulo", data, misses);
+    run_sizing_policy<OpenAddressingHashTable<std::string, int, std::hash<std::string>, PrimeTableSizing>>("Open Addressing Hash", "tabela de primos", data, misses);
+    run_sizing_policy<OpenAddressingHashTable<std::string, int, std::hash<std::string>, PowerOfTwoSizing>>("Open Addressing Hash", "potencia de 2", data, misses);
+}
+
+// --- Benchmark: escalabilidade da AVL concorrente com leituras e escritas misturadas ---
+template <typename Op>
+double run_threads(int threads, Op op) {
+    std::vector<std::thread> pool;
+    return time_ms([&]() {
+        for (int t = 0; t < threads; ++t) pool.emplace_back(op, t);
+        for (auto& th : pool) th.join();
+    });
+}
+
+void benchmark_concurrent_avl(const std::vector<std::string>& data) {
+    const int TOTAL_OPS = 400000;
+    int max_threads = std::max(4u, std::thread::hardware_concurrency());
+
+    std::cout << "\n--- AVL concorrente: " << TOTAL_OPS << " operacoes divididas entre as threads (Mops/s) ---\n";
+    std::cout << "(hardware_concurrency = " << std::thread::hardware_concurrency() << ")\n";
+    std::cout << std::left << std::setw(12) << "Threads" << std::setw(12) << "Leituras"
+              << std::setw(22) << "ConcurrentAVL" << "AVL + mutex" << std::endl;
+
+    for (int read_pct : {90, 50}) {
+        for (int threads = 1; threads <= max_threads; threads *= 2) {
+            int ops_per_thread = TOTAL_OPS / threads;
+
+            // Metade das chaves é inserida antes; as escritas inserem ou removem chaves quaisquer
+            ConcurrentAVL<std::string, int> concurrent;
+            // Referência com trava exclusiva também nas leituras: AVL::contains atualiza os contadores de
+            // comparações (e do cache de chaves), então leitores simultâneos sob shared_lock teriam corrida de dados
+            AVL<std::string, int> locked;
+            std::mutex lock;
+            for (size_t i = 0; i < data.size() / 2; ++i) {
+                concurrent.add(data[i], 1);
+                locked.add(data[i], 1);
+            }
+
+            double concurrent_ms = run_threads(threads, [&](int t) {
+                std::mt19937 gen(t);
+                int value;
+                for (int i = 0; i < ops_per_thread; ++i) {
+                    const std::string& key = data[gen() % data.size()];
+                    int dice = gen() % 100;
+                    if (dice < read_pct) concurrent.find(key, value);
+                    else if (dice % 2) concurrent.add(key, i);
+                    else concurrent.remove(key);
+                }
+            });
+
+            double locked_ms = run_threads(threads, [&](int t) {
+                std::mt19937 gen(t);
+                for (int i = 0; i < ops_per_thread; ++i) {
+                    const std::string& key = data[gen() % data.size()];
+                    int dice = gen() % 100;
+                    std::lock_guard<std::mutex> guard(lock);
+                    if (dice < read_pct) locked.contains(key);
+                    else if (dice % 2) locked.add(key, i);
+                    else locked.remove(key);
+                }
+            });
+
+            double total = static_cast<double>(ops_per_thread) * threads;
+            std::cout << std::left << std::setw(12) << threads
+                      << std::setw(12) << (std::to_string(read_pct) + "%")
+                      << std::setw(22) << total / concurrent_ms / 1000.0
+                      << total / locked_ms / 1000.0 << std::endl;
+        }
+    }
+}
+
+// --- Benchmark: consultas durante a ingestão (um escritor, vários leitores) ---
+// Cada leitor consulta até o fim da ingestão ou até QUERY_LIMIT consultas; o limite evita que um
+// escritor disputando a trava com os leitores prolongue o benchmark indefinidamente.
+template <typename Lookup, typename Insert>
+void run_query_during_ingest(const std::string& name, int readers, const std::vector<std::string>& data, Lookup lookup, Insert insert) {
+    const long long QUERY_LIMIT = 50000;
+    std::atomic<bool> done{false};
+    std::atomic<long long> queries{0};
+    std::vector<std::thread> pool;
+    double writer_ms = 0;
+
+    double total_ms = time_ms([&]() {
+        for (int r = 0; r < readers; ++r) {
+            pool.emplace_back([&, r]() {
+                std::mt19937 gen(r);
+                long long local = 0;
+                while (!done.load(std::memory_order_relaxed) && local < QUERY_LIMIT) {
+                    lookup(data[gen() % data.size()]);
+                    local++;
+                }
+                queries += local;
+            });
+        }
+        writer_ms = time_ms([&]() { for (size_t i = 0; i < data.size(); ++i) insert(data[i], static_cast<int>(i)); });
+        done = true;
+        for (auto& t : pool) t.join();
+    });
+
+    std::cout << std::left << std::setw(12) << readers << std::setw(25) << name
+              << std::setw(22) << queries.load() / (total_ms / 1000.0) / 1e6
+              << data.size() / (writer_ms / 1000.0) / 1e3 << std::endl;
+}
+
+void benchmark_concurrent_rb(const std::vector<std::string>& all_data) {
+    std::vector<std::string> data(all_data.begin(), all_data.begin() + std::min<size_t>(20000, all_data.size()));
+
+    std::cout << "\n--- RB: consultas durante a ingestao de " << data.size() << " chaves (1 escritor) ---\n";
+    std::cout << "(hardware_concurrency = " << std::thread::hardware_concurrency() << ")\n";
+    std::cout << std::left << std::setw(12) << "Leitores" << std::setw(25) << "Estrutura"
+              << std::setw(22) << "Leitores (Mops/s)" << "Escritor (Kins/s)" << std::endl;
+
+    for (int readers = 1; readers <= 32; readers *= 2) {
+        ConcurrentRB<std::string, int> concurrent;
+        run_query_during_ingest("ConcurrentRB (seqlock)", readers, data,
+            [&](const std::string& key) { return concurrent.contains(key); },
+            [&](const std::string& key, int value) { concurrent.add(key, value); });
+
+        // Leituras também com trava exclusiva: RB::contains atualiza os contadores de comparações (e do
+        // cache de chaves), então leitores simultâneos sob shared_lock teriam corrida de dados
+        RB<std::string, int> locked;
+        std::mutex lock;
+        run_query_during_ingest("RB + mutex", readers, data,
+            [&](const std::string& key) { std::lock_guard<std::mutex> guard(lock); return locked.contains(key); },
+            [&](const std::string& key, int value) { std::lock_guard<std::mutex> guard(lock); locked.add(key, value); });
+    }
+}
+
+// --- Benchmark: contagem paralela de um fluxo Zipf em uma tabela compartilhada x tabelas por thread + fusão ---
+void benchmark_concurrent_hash_counting() {
+    const size_t TOKENS = 1000000;
+    const size_t VOCABULARY = 50000;
+    std::vector<std::string> stream = generate_zipf_stream(VOCABULARY, TOKENS, 1.0, 53);
+
+    std::cout << "\n--- Contagem paralela: " << TOKENS << " palavras (Zipf s=1.0 sobre " << VOCABULARY << "), Mpalavras/s ---\n";
+    std::cout << "(hardware_concurrency = " << std::thread::hardware_concurrency() << ")\n";
+    std::cout << std::left << std::setw(12) << "Threads" << std::setw(20) << "Compart. 1 trava" << std::setw(22) << "Compart. 64 faixas"
+              << std::setw(22) << "Por thread + fusao" << "Fusao (ms)" << std::endl;
+
+    for (int threads = 1; threads <= 32; threads *= 2) {
+        auto slice = [&](int t, auto&& count) {
+            for (size_t i = TOKENS * t / threads; i < TOKENS * (t + 1) / threads; ++i) count(stream[i]);
+        };
+
+        ConcurrentChainedHashTable<std::string, size_t> single(1);
+        double single_ms = run_threads(threads, [&](int t) { slice(t, [&](const std::string& w) { single.increment(w); }); });
+
+        ConcurrentChainedHashTable<std::string, size_t> striped(64);
+        double striped_ms = run_threads(threads, [&](int t) { slice(t, [&](const std::string& w) { striped.increment(w); }); });
+
+        std::vector<ChainedHashTable<std::string, size_t>> locals(threads);
+        double local_ms = run_threads(threads, [&](int t) {
+            slice(t, [&](const std::string& w) {
+                ChainedHashTable<std::string, size_t>& own = locals[t];
+                own.add(w, own.contains(w) ? own.get(w) + 1 : 1);
+            });
+        });
+        ChainedHashTable<std::string, size_t>& merged = locals[0];
+        double merge_ms = time_ms([&]() {
+            for (int t = 1; t < threads; ++t) {
+                locals[t].for_each([&](const std::string& w, size_t n) { merged.add(w, merged.contains(w) ? merged.get(w) + n : n); });
+            }
+        });
+
+        if (single.size() != merged.size() || striped.size() != merged.size() || striped.get(stream[0]) != merged.get(stream[0]))
+            std::cerr << "  -> contagem incorreta no benchmark de contagem paralela" << std::endl;
+
+        std::cout << std::left << std::setw(12) << threads << std::setw(20) << TOKENS / (single_ms * 1000.0)
+                  << std::setw(22) << TOKENS / (striped_ms * 1000.0) << std::setw(22) << TOKENS / ((local_ms + merge_ms) * 1000.0)
+                  << merge_ms << std::endl;
+    }
+}
+
 // --- Função para Imprimir a Tabela de Resultados ---
 void print_results_table(const std::map<std::string, BenchmarkResults>& all_results) {
     std::cout << "\n===================================================================================================================\n";
@@ -225,19 +1408,49 @@ void print_results_table(const std::map<std::string, BenchmarkResults>& all_resu
     std::cout << "===================================================================================================================\n";
 }
 
-// --- Função para gerar strings aleatórias ---
-std::string generate_random_string(size_t length) {
+// --- Função para gerar strings aleatórias com o gerador dado ---
+std::string generate_random_string(size_t length, std::mt19937& gen) {
     const char charset[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
     const size_t max_index = (sizeof(charset) - 1);
-    static std::mt19937 gen(std::random_device{}());
     std::uniform_int_distribution<> distrib(0, max_index - 1);
     std::string str(length, 0);
     std::generate_n(str.begin(), length, [&]() { return charset[distrib(gen)]; });
     return str;
 }
 
+// --- Função para gerar strings aleatórias ---
+std::string generate_random_string(size_t length) {
+    static std::mt19937 gen(std::random_device{}());
+    return generate_random_string(length, gen);
+}
+
+// --- Gera um vocabulário de palavras aleatórias distintas, com 3 a 10 caracteres, determinado pela semente ---
+std::vector<std::string> generate_random_string_vocabulary(size_t vocabulary, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<size_t> length(3, 10);
+    std::vector<std::string> words;
+    std::unordered_set<std::string> seen;
+    words.reserve(vocabulary);
+    while (words.size() < vocabulary) {
+        std::string word = generate_random_string(length(gen), gen);
+        if (seen.insert(word).second) words.push_back(word);
+    }
+    return words;
+}
+
+int main(int argc, char* argv[]) {
+    // Uso opcional: ./teste_runner --corpus <arquivo.txt> para medir benchmarks de ingestão em um texto real
+    //              ./teste_runner --descent-keys <n> para mudar o número de chaves do benchmark da RB compacta
+    //              ./teste_runner --vocabulary <n> para mudar o vocabulário dos benchmarks de hash guardado, de rehash, de latência, de dimensionamento prévio e de funções de hash
+    std::string corpus;
+    size_t descent_keys = 5000000;
+    size_t vocabulary = 500000;
+    for (int i = 1; i + 1 < argc; ++i) {
+        if (std::string(argv[i]) == "--corpus") corpus = argv[i + 1];
+        if (std::string(argv[i]) == "--descent-keys") descent_keys = std::stoul(argv[i + 1]);
+        if (std::string(argv[i]) == "--vocabulary") vocabulary = std::stoul(argv[i + 1]);
+    }
 
-int main() {
     // 1. Executa primeiro os testes de correção para garantir que tudo está funcional
     test_all_structures();
     if (tests_failed > 0) {
@@ -303,5 +1516,31 @@ int main() {
     // 5. Exibição dos Resultados Finais (Média)
     print_results_table(final_averaged_results);
 
+    // 6. Benchmarks específicos
+    benchmark_persistent_snapshots(benchmark_data);
+    benchmark_three_way_compare(benchmark_data);
+    benchmark_frozen_layout(benchmark_data);
+    benchmark_front_cache(corpus);
+    benchmark_concurrent_avl(benchmark_data);
+    benchmark_rb_insert_policy(benchmark_data);
+    benchmark_sorted_load(benchmark_data);
+    benchmark_concurrent_rb(benchmark_data);
+    benchmark_concurrent_hash_counting();
+    benchmark_top_k();
+    benchmark_flat_chaining(benchmark_data);
+    benchmark_treeified_buckets();
+    benchmark_robin_hood();
+    benchmark_swiss_table();
+    benchmark_probe_coverage();
+    benchmark_tombstone_churn();
+    benchmark_slot_layout();
+    benchmark_stored_hash(vocabulary);
+    benchmark_rehash_memory(vocabulary);
+    benchmark_incremental_rehash(vocabulary);
+    benchmark_sizing_policy(benchmark_data);
+    benchmark_presize(corpus, vocabulary);
+    benchmark_string_hash(corpus, vocabulary);
+    benchmark_rb_compact_nodes(descent_keys);
+
     return 0;
 }
\ No newline at end of file